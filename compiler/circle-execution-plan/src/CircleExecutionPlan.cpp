@@ -59,6 +59,13 @@ int entry(int argc, char **argv)
     .default_value(true)
     .help("Whether or not to take into account inputs in memory allocation. "
           "Default value - true, inputs are counted when allocating memory");
+  arser.add_argument("--search_order")
+    .nargs(1)
+    .type(arser::DataType::BOOL)
+    .required(false)
+    .default_value(true)
+    .help("Whether or not to search execution order that requires less memory. "
+          "Default value - true, default order is kept if no order requires less memory");
   arser.add_argument("--use_dsp")
     .nargs(1)
     .type(arser::DataType::BOOL)
@@ -92,6 +99,7 @@ int entry(int argc, char **argv)
   const bool use_dsp = arser.get<bool>("--use_dsp");
   const bool is_allocate_const = arser.get<bool>("--allocate_const");
   const bool is_allocate_input = arser.get<bool>("--allocate_input");
+  const bool is_search_order = arser.get<bool>("--search_order");
   const std::string json_path = arser.get<std::string>("--save_allocations");
 
   if (platform_name != "cmsisnn" && use_dsp)
@@ -176,6 +184,7 @@ int entry(int argc, char **argv)
   circle_planner::ExecutionPlanner execution_planner(module->graph(), {platform_type, use_dsp},
                                                      runtime_type, allocating_mode);
   execution_planner.change_planning_mode(is_allocate_const, is_allocate_input, true);
+  execution_planner.change_order_mode(is_search_order);
   execution_planner.make_execution_plan();
 
   if (is_save_allocations)
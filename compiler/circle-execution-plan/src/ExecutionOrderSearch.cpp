@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExecutionOrderSearch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace circle_planner
+{
+namespace
+{
+
+constexpr uint32_t unit_done = std::numeric_limits<uint32_t>::max();
+
+// Upper bound of the search work, to keep planning time of large graphs reasonable
+constexpr uint64_t max_search_work = 1ull << 26;
+
+// Nodes executed together: a node and the nodes executed with it
+struct Unit
+{
+  std::vector<uint32_t> members;
+  std::vector<uint32_t> pred_units;
+  std::vector<uint32_t> succ_units;
+};
+
+struct SearchState
+{
+  std::vector<uint32_t> remaining_uses;
+  // number of predecessor units not executed yet, or unit_done if executed
+  std::vector<uint32_t> missing_preds;
+  uint64_t live = 0;
+  uint64_t peak = 0;
+  uint64_t hash = 0;
+  std::vector<uint32_t> order;
+};
+
+struct Candidate
+{
+  uint64_t peak;
+  uint64_t live;
+  size_t state;
+  uint32_t unit;
+  uint64_t hash;
+
+  bool operator<(const Candidate &other) const
+  {
+    if (peak != other.peak)
+      return peak < other.peak;
+    if (live != other.live)
+      return live < other.live;
+    if (state != other.state)
+      return state < other.state;
+    return unit < other.unit;
+  }
+};
+
+std::vector<uint32_t> count_uses(const std::vector<OrderSearchNode> &nodes)
+{
+  std::vector<uint32_t> uses(nodes.size(), 0);
+  for (const auto &node : nodes)
+  {
+    for (const auto pred : node.preds)
+    {
+      assert(pred < nodes.size());
+      uses[pred]++;
+    }
+  }
+  return uses;
+}
+
+uint64_t initial_live(const std::vector<OrderSearchNode> &nodes)
+{
+  uint64_t live = 0;
+  for (const auto &node : nodes)
+  {
+    if (node.is_alive_from_start)
+      live += node.size;
+  }
+  return live;
+}
+
+// Update live and peak memory by execution of the node
+void execute_node(const std::vector<OrderSearchNode> &nodes, uint32_t index,
+                  std::vector<uint32_t> &remaining_uses, uint64_t &live, uint64_t &peak)
+{
+  const auto &node = nodes[index];
+  if (not node.is_alive_from_start)
+    live += node.size;
+  peak = std::max(peak, live + node.temp_size);
+
+  for (const auto pred : node.preds)
+  {
+    assert(remaining_uses[pred] > 0);
+    if (--remaining_uses[pred] == 0 and not nodes[pred].is_alive_till_end)
+      live -= nodes[pred].size;
+  }
+}
+
+// Update live and peak memory by execution of the unit, without changing remaining uses
+void evaluate_unit(const std::vector<OrderSearchNode> &nodes, const Unit &unit,
+                   const std::vector<uint32_t> &remaining_uses, uint64_t &live, uint64_t &peak)
+{
+  // Units have only a few members, so count uses of each pred in a small vector
+  std::vector<std::pair<uint32_t, uint32_t>> used;
+  for (const auto member : unit.members)
+  {
+    const auto &node = nodes[member];
+    if (not node.is_alive_from_start)
+      live += node.size;
+    peak = std::max(peak, live + node.temp_size);
+
+    for (const auto pred : node.preds)
+    {
+      auto it = std::find_if(used.begin(), used.end(),
+                             [pred](const auto &elem) { return elem.first == pred; });
+      if (it == used.end())
+        it = used.insert(used.end(), {pred, 0});
+      if (++it->second == remaining_uses[pred] and not nodes[pred].is_alive_till_end)
+        live -= nodes[pred].size;
+    }
+  }
+}
+
+std::vector<Unit> make_units(const std::vector<OrderSearchNode> &nodes)
+{
+  std::vector<uint32_t> unit_of(nodes.size());
+  std::vector<Unit> units;
+  for (uint32_t i = 0; i < nodes.size(); ++i)
+  {
+    if (nodes[i].executed_with >= 0)
+      continue;
+    unit_of[i] = units.size();
+    units.emplace_back();
+    units.back().members.push_back(i);
+  }
+  for (uint32_t i = 0; i < nodes.size(); ++i)
+  {
+    const auto with = nodes[i].executed_with;
+    if (with < 0)
+      continue;
+    if (static_cast<size_t>(with) >= nodes.size() or nodes[with].executed_with >= 0)
+      throw std::runtime_error("Node " + std::to_string(i) + " is executed with invalid node");
+    unit_of[i] = unit_of[with];
+    units[unit_of[i]].members.push_back(i);
+  }
+
+  for (uint32_t u = 0; u < units.size(); ++u)
+  {
+    auto &unit = units[u];
+    for (const auto member : unit.members)
+    {
+      for (const auto pred : nodes[member].preds)
+      {
+        const auto pred_unit = unit_of[pred];
+        if (pred_unit == u)
+          continue;
+        if (std::find(unit.pred_units.begin(), unit.pred_units.end(), pred_unit) ==
+            unit.pred_units.end())
+        {
+          unit.pred_units.push_back(pred_unit);
+          units[pred_unit].succ_units.push_back(u);
+        }
+      }
+    }
+  }
+  return units;
+}
+
+} // namespace
+
+uint64_t estimate_peak_memory(const std::vector<OrderSearchNode> &nodes,
+                              const std::vector<uint32_t> &order)
+{
+  auto remaining_uses = count_uses(nodes);
+  uint64_t live = initial_live(nodes);
+  uint64_t peak = live;
+  for (const auto index : order)
+    execute_node(nodes, index, remaining_uses, live, peak);
+  return peak;
+}
+
+std::vector<uint32_t> search_execution_order(const std::vector<OrderSearchNode> &nodes,
+                                             uint32_t beam_width)
+{
+  const auto units = make_units(nodes);
+  const uint64_t num_units = units.size();
+  if (num_units == 0)
+    return {};
+
+  // Each step copies states of size about (nodes + units)
+  const uint64_t state_size = nodes.size() + num_units;
+  beam_width = std::max<uint64_t>(
+    1, std::min<uint64_t>(beam_width, max_search_work / (num_units * state_size)));
+
+  // Hash of the set of executed units, to drop duplicated partial orders
+  std::mt19937_64 random(0);
+  std::vector<uint64_t> keys(num_units);
+  for (auto &key : keys)
+    key = random();
+
+  SearchState initial_state;
+  initial_state.remaining_uses = count_uses(nodes);
+  for (const auto &unit : units)
+    initial_state.missing_preds.push_back(unit.pred_units.size());
+  initial_state.live = initial_live(nodes);
+  initial_state.peak = initial_state.live;
+
+  std::vector<SearchState> beam{initial_state};
+  for (uint64_t step = 0; step < num_units; ++step)
+  {
+    std::vector<Candidate> candidates;
+    for (size_t s = 0; s < beam.size(); ++s)
+    {
+      const auto &state = beam[s];
+      for (uint32_t u = 0; u < num_units; ++u)
+      {
+        if (state.missing_preds[u] != 0)
+          continue;
+
+        uint64_t live = state.live;
+        uint64_t peak = state.peak;
+        evaluate_unit(nodes, units[u], state.remaining_uses, live, peak);
+        candidates.push_back({peak, live, s, u, state.hash ^ keys[u]});
+      }
+    }
+    if (candidates.empty())
+      throw std::runtime_error("Graph has a cycle");
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<SearchState> next;
+    std::unordered_set<uint64_t> hashes;
+    for (const auto &candidate : candidates)
+    {
+      if (next.size() == beam_width)
+        break;
+      if (not hashes.insert(candidate.hash).second)
+        continue;
+
+      next.push_back(beam[candidate.state]);
+      auto &state = next.back();
+      for (const auto member : units[candidate.unit].members)
+      {
+        execute_node(nodes, member, state.remaining_uses, state.live, state.peak);
+        state.order.push_back(member);
+      }
+      for (const auto succ : units[candidate.unit].succ_units)
+        state.missing_preds[succ]--;
+      state.missing_preds[candidate.unit] = unit_done;
+      state.hash = candidate.hash;
+    }
+    beam = std::move(next);
+  }
+
+  // States are sorted by peak memory
+  return beam.front().order;
+}
+
+} // namespace circle_planner
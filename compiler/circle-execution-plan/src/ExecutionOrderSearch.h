@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CIRCLE_EXECUTION_ORDER_SEARCH_H
+#define CIRCLE_EXECUTION_ORDER_SEARCH_H
+
+#include <cstdint>
+#include <vector>
+
+namespace circle_planner
+{
+
+// struct for the node information used to search execution order
+struct OrderSearchNode
+{
+  // indices of the nodes this node uses
+  std::vector<uint32_t> preds;
+  // size of the node tensor
+  uint32_t size = 0;
+  // size of the temporary tensors while the node is executed
+  uint32_t temp_size = 0;
+  // is the node allocated before execution or not, e.g. inputs and constants
+  bool is_alive_from_start = false;
+  // is the node kept until the end of execution or not, e.g. inputs and outputs
+  bool is_alive_till_end = false;
+  // index of the node this node is executed with, e.g. the node of *Out node, or -1
+  int32_t executed_with = -1;
+};
+
+// Method searches an execution order of nodes with low peak memory, using beam search over the
+// sets of nodes ready to execute. beam_width partial orders with the lowest peak and current
+// memory are kept at each step. Nodes executed with another node follow it right away.
+// Return: searched order as indices of nodes.
+std::vector<uint32_t> search_execution_order(const std::vector<OrderSearchNode> &nodes,
+                                             uint32_t beam_width);
+
+// Method estimates peak memory of the nodes executed in the given order.
+// Return: sum of alive tensor sizes at the moment of the most memory consuming node.
+uint64_t estimate_peak_memory(const std::vector<OrderSearchNode> &nodes,
+                              const std::vector<uint32_t> &order);
+
+} // namespace circle_planner
+
+#endif // CIRCLE_EXECUTION_ORDER_SEARCH_H
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExecutionOrderSearch.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace circle_planner;
+
+namespace
+{
+
+OrderSearchNode make_node(std::vector<uint32_t> preds, uint32_t size)
+{
+  OrderSearchNode node;
+  node.preds = std::move(preds);
+  node.size = size;
+  return node;
+}
+
+// input -> a1 (large) -> a2 (small) -> out
+//       -> b1 (large) -> b2 (small) ->
+std::vector<OrderSearchNode> two_branches()
+{
+  std::vector<OrderSearchNode> nodes;
+  nodes.push_back(make_node({}, 10));
+  nodes.back().is_alive_from_start = true;
+  nodes.back().is_alive_till_end = true;
+  nodes.push_back(make_node({0}, 100));
+  nodes.push_back(make_node({0}, 100));
+  nodes.push_back(make_node({1}, 1));
+  nodes.push_back(make_node({2}, 1));
+  nodes.push_back(make_node({3, 4}, 1));
+  nodes.back().is_alive_till_end = true;
+  return nodes;
+}
+
+bool is_topological(const std::vector<OrderSearchNode> &nodes, const std::vector<uint32_t> &order)
+{
+  if (order.size() != nodes.size())
+    return false;
+  std::vector<bool> executed(nodes.size(), false);
+  for (const auto index : order)
+  {
+    for (const auto pred : nodes[index].preds)
+    {
+      if (not executed[pred])
+        return false;
+    }
+    executed[index] = true;
+  }
+  return true;
+}
+
+} // namespace
+
+TEST(ExecutionOrderSearchTest, estimate_peak_memory)
+{
+  const auto nodes = two_branches();
+
+  // Both large tensors are alive before either branch ends
+  EXPECT_EQ(211, estimate_peak_memory(nodes, {0, 1, 2, 3, 4, 5}));
+  // Each branch ends before the other starts
+  EXPECT_EQ(112, estimate_peak_memory(nodes, {0, 1, 3, 2, 4, 5}));
+}
+
+TEST(ExecutionOrderSearchTest, search_lowers_peak)
+{
+  const auto nodes = two_branches();
+
+  const auto order = search_execution_order(nodes, 4);
+
+  EXPECT_TRUE(is_topological(nodes, order));
+  EXPECT_EQ(112, estimate_peak_memory(nodes, order));
+}
+
+TEST(ExecutionOrderSearchTest, temp_size)
+{
+  // A node with a large scratchpad should run while the fewest tensors are alive, i.e. its
+  // branch should run first
+  auto nodes = two_branches();
+  nodes[4].temp_size = 1000;
+
+  const auto order = search_execution_order(nodes, 4);
+
+  EXPECT_TRUE(is_topological(nodes, order));
+  EXPECT_EQ(1111, estimate_peak_memory(nodes, order));
+  EXPECT_EQ(2, order[1]);
+}
+
+TEST(ExecutionOrderSearchTest, executed_with)
+{
+  // node 2 is an output of node 1, e.g. a *Out node
+  auto nodes = two_branches();
+  nodes[2].preds = {1};
+  nodes[2].executed_with = 1;
+
+  const auto order = search_execution_order(nodes, 4);
+
+  EXPECT_TRUE(is_topological(nodes, order));
+  const auto pos = std::find(order.begin(), order.end(), 1);
+  ASSERT_NE(order.end(), pos);
+  ASSERT_NE(order.end(), pos + 1);
+  EXPECT_EQ(2, *(pos + 1));
+}
+
+TEST(ExecutionOrderSearchTest, beam_width_one)
+{
+  const auto nodes = two_branches();
+
+  const auto order = search_execution_order(nodes, 1);
+
+  EXPECT_TRUE(is_topological(nodes, order));
+}
+
+TEST(ExecutionOrderSearchTest, empty)
+{
+  std::vector<OrderSearchNode> nodes;
+
+  EXPECT_TRUE(search_execution_order(nodes, 4).empty());
+  EXPECT_EQ(0, estimate_peak_memory(nodes, {}));
+}
+
+TEST(ExecutionOrderSearchTest, cycle_NEG)
+{
+  std::vector<OrderSearchNode> nodes;
+  nodes.push_back(make_node({1}, 1));
+  nodes.push_back(make_node({0}, 1));
+
+  EXPECT_THROW(search_execution_order(nodes, 4), std::runtime_error);
+}
+
+TEST(ExecutionOrderSearchTest, invalid_executed_with_NEG)
+{
+  auto nodes = two_branches();
+  nodes[3].executed_with = 100;
+
+  EXPECT_THROW(search_execution_order(nodes, 4), std::runtime_error);
+}
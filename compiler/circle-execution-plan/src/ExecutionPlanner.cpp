@@ -15,6 +15,7 @@
  */
 
 #include "ExecutionPlanner.h"
+#include "ExecutionOrderSearch.h"
 #include <loco/IR/Algorithm.h>
 #include <luci/UserSettings.h>
 #include <luci/Log.h>
@@ -22,7 +23,9 @@
 #include <json.h>
 #include <fstream>
 
-#include <limits> // std::numeric_limits
+#include <limits>  // std::numeric_limits
+#include <numeric> // std::iota
+#include <unordered_map>
 
 namespace circle_planner
 {
@@ -31,6 +34,9 @@ namespace
 
 constexpr uint32_t node_not_assigned = std::numeric_limits<int32_t>::max();
 
+// Number of partial execution orders kept while searching execution order
+constexpr uint32_t order_search_beam_width = 8;
+
 bool isExecutableNode(const luci::CircleNode *node)
 {
   switch (node->opcode())
@@ -174,6 +180,7 @@ void ExecutionPlanner::make_execution_plan_onert_micro_split_buffer()
 
   // Make execution plan for intermediates calculations
   get_default_execution_order_plan_without_inputs_and_outputs();
+  search_execution_order_plan();
   write_execution_plan(input_size + output_size);
   dump_inform();
   VERBOSE(l, 0) << "Main graph buffer required memory = " << _required_size << std::endl;
@@ -184,6 +191,7 @@ void ExecutionPlanner::make_execution_plan_onert_micro_common_buffer()
   LOGGER(l);
 
   get_default_execution_order_plan();
+  search_execution_order_plan();
   _required_size = get_offsets_with_greedy_by_size();
 
   // Find prev nodes for output nodes (actual graph output node, not luci::CircleOutput)
@@ -246,6 +254,7 @@ void ExecutionPlanner::make_execution_plan_luci_interpreter()
   LOGGER(l);
 
   get_default_execution_order_plan();
+  search_execution_order_plan();
   _required_size = get_offsets_with_greedy_by_size();
   for (uint32_t i = 0; i < _ordered_nodes.size(); i++)
   {
@@ -354,6 +363,85 @@ void ExecutionPlanner::get_default_execution_order_plan_without_inputs_and_outpu
     _ordered_nodes.end());
 }
 
+void ExecutionPlanner::search_execution_order_plan()
+{
+  LOGGER(l);
+
+  if (not _is_search_order)
+    return;
+
+  std::unordered_map<loco::Node *, uint32_t> node_indices;
+  for (uint32_t i = 0; i < _ordered_nodes.size(); i++)
+    node_indices[_ordered_nodes[i]] = i;
+
+  const auto input_nodes = loco::input_nodes(_graph);
+  const auto output_nodes = loco::output_nodes(_graph);
+  auto contains = [](const std::vector<loco::Node *> &nodes, loco::Node *node) {
+    return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+  };
+
+  // Describe nodes in the same way as get_usage_interval() and create_alloc_node_inform_vector()
+  std::vector<OrderSearchNode> search_nodes(_ordered_nodes.size());
+  for (uint32_t i = 0; i < _ordered_nodes.size(); i++)
+  {
+    const auto node = _ordered_nodes[i];
+    const auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    auto &search_node = search_nodes[i];
+
+    for (const auto prev_node : loco::preds(node))
+    {
+      const auto it = node_indices.find(prev_node);
+      if (it != node_indices.end())
+        search_node.preds.push_back(it->second);
+    }
+
+    search_node.size = get_node_size(circle_node);
+    for (const auto scratchpad_size : get_scratchpad_sizes(circle_node))
+      search_node.temp_size += scratchpad_size;
+
+    const bool is_input = contains(input_nodes, node);
+    search_node.is_alive_from_start =
+      is_input or dynamic_cast<const luci::CircleConst *>(circle_node) != nullptr;
+    search_node.is_alive_till_end = is_input or contains(output_nodes, node);
+
+    if (!isExecutableNode(circle_node) and search_node.preds.size() == 1)
+      search_node.executed_with = search_node.preds[0];
+  }
+
+  std::vector<uint32_t> default_order(_ordered_nodes.size());
+  std::iota(default_order.begin(), default_order.end(), 0);
+  const auto order = search_execution_order(search_nodes, order_search_beam_width);
+  VERBOSE(l, 0) << "Execution order search: peak memory "
+                << estimate_peak_memory(search_nodes, default_order) << " -> "
+                << estimate_peak_memory(search_nodes, order) << std::endl;
+
+  // Keep the default order unless the searched order requires less memory in fact
+  const auto default_nodes = _ordered_nodes;
+  const auto default_size = get_required_size_of_order();
+
+  std::vector<loco::Node *> searched_nodes;
+  for (const auto index : order)
+    searched_nodes.push_back(default_nodes[index]);
+  _ordered_nodes = searched_nodes;
+  const auto searched_size = get_required_size_of_order();
+
+  VERBOSE(l, 0) << "Execution order search: required memory " << default_size << " -> "
+                << searched_size << std::endl;
+  if (searched_size >= default_size)
+    _ordered_nodes = default_nodes;
+}
+
+uint32_t ExecutionPlanner::get_required_size_of_order()
+{
+  const auto required_size = get_offsets_with_greedy_by_size();
+
+  _alloc_node_inform_vector.clear();
+  _dealloc_node.clear();
+  _alloc_node.clear();
+  _offsets.clear();
+  return required_size;
+}
+
 void ExecutionPlanner::get_usage_interval()
 {
   // Initialize vectors of first and last nodes for usage interval
@@ -550,82 +638,14 @@ void ExecutionPlanner::create_alloc_node_inform_vector()
   for (size_t i = 0; i < _ordered_nodes.size(); i++)
   {
     auto circle_node = loco::must_cast<luci::CircleNode *>(_ordered_nodes[i]);
-    auto node_size = 1;
-    for (uint32_t axis = 0; axis < circle_node->rank(); ++axis)
-    {
-      node_size *= circle_node->dim(axis).value();
-    }
-    node_size *= size(circle_node->dtype());
 
     _alloc_node_inform_vector[i].node_num = i;
     _alloc_node_inform_vector[i].first_node = _alloc_node[i];
     _alloc_node_inform_vector[i].last_node = _dealloc_node[i];
-
-    const auto *const_node = dynamic_cast<const luci::CircleConst *>(circle_node);
-    if (circle_node->opcode() == luci::CircleOpcode::CIRCLEINPUT && not _is_allocate_inputs)
-    {
-      _alloc_node_inform_vector[i].size = 0;
-    }
-    else if (circle_node->opcode() == luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE)
-    {
-      _alloc_node_inform_vector[i].size = 0;
-    }
-    else if (const_node && not _is_allocate_consts)
-    {
-      _alloc_node_inform_vector[i].size = 0;
-    }
-    else if (!isTensorProducingNode(circle_node))
-    {
-      _alloc_node_inform_vector[i].size = 0;
-    }
-    else
-    {
-      _alloc_node_inform_vector[i].size = node_size;
-    }
+    _alloc_node_inform_vector[i].size = get_node_size(circle_node);
 
     // Scratchpad If needed
-    std::vector<uint32_t> scratchpad_sizes;
-    if (_is_allocate_scratchpads)
-    {
-      switch (circle_node->opcode())
-      {
-        case luci::CircleOpcode::AVERAGE_POOL_2D:
-        {
-          const auto avg_pool = loco::must_cast<const luci::CircleAveragePool2D *>(circle_node);
-          scratchpad_sizes.push_back(
-            _scratchpad_helper->ComputeScratchpadSizeAveragePool2d(avg_pool));
-          break;
-        }
-        case luci::CircleOpcode::BATCH_MATMUL:
-        {
-          const auto batch_mat_mul = loco::must_cast<const luci::CircleBatchMatMul *>(circle_node);
-          scratchpad_sizes = _scratchpad_helper->ComputeScratchpadSizeBatchMatMul(batch_mat_mul);
-          break;
-        }
-        case luci::CircleOpcode::CONV_2D:
-        {
-          const auto conv = loco::must_cast<const luci::CircleConv2D *>(circle_node);
-          scratchpad_sizes.push_back(_scratchpad_helper->ComputeScratchpadSizeConv2d(conv));
-          break;
-        }
-        case luci::CircleOpcode::DEPTHWISE_CONV_2D:
-        {
-          const auto depthwise_conv =
-            loco::must_cast<const luci::CircleDepthwiseConv2D *>(circle_node);
-          scratchpad_sizes.push_back(
-            _scratchpad_helper->ComputeScratchpadSizeDepthwiseConv2d(depthwise_conv));
-          break;
-        }
-        case luci::CircleOpcode::SVDF:
-        {
-          const auto svdf = loco::must_cast<const luci::CircleSVDF *>(circle_node);
-          scratchpad_sizes = _scratchpad_helper->ComputeScratchpadSizeSVDF(svdf);
-          break;
-        }
-        default:
-          break;
-      }
-    }
+    const auto scratchpad_sizes = get_scratchpad_sizes(circle_node);
 
     for (const auto scratchpad_size : scratchpad_sizes)
     {
@@ -649,6 +669,81 @@ void ExecutionPlanner::create_alloc_node_inform_vector()
   std::sort(_alloc_node_inform_vector.begin(), _alloc_node_inform_vector.end(), node_compare);
 }
 
+uint32_t ExecutionPlanner::get_node_size(const luci::CircleNode *circle_node) const
+{
+  const auto *const_node = dynamic_cast<const luci::CircleConst *>(circle_node);
+  if (circle_node->opcode() == luci::CircleOpcode::CIRCLEINPUT && not _is_allocate_inputs)
+  {
+    return 0;
+  }
+  else if (circle_node->opcode() == luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE)
+  {
+    return 0;
+  }
+  else if (const_node && not _is_allocate_consts)
+  {
+    return 0;
+  }
+  else if (!isTensorProducingNode(circle_node))
+  {
+    return 0;
+  }
+
+  uint32_t node_size = 1;
+  for (uint32_t axis = 0; axis < circle_node->rank(); ++axis)
+  {
+    node_size *= circle_node->dim(axis).value();
+  }
+  node_size *= size(circle_node->dtype());
+  return node_size;
+}
+
+std::vector<uint32_t>
+ExecutionPlanner::get_scratchpad_sizes(const luci::CircleNode *circle_node) const
+{
+  std::vector<uint32_t> scratchpad_sizes;
+  if (not _is_allocate_scratchpads)
+    return scratchpad_sizes;
+
+  switch (circle_node->opcode())
+  {
+    case luci::CircleOpcode::AVERAGE_POOL_2D:
+    {
+      const auto avg_pool = loco::must_cast<const luci::CircleAveragePool2D *>(circle_node);
+      scratchpad_sizes.push_back(_scratchpad_helper->ComputeScratchpadSizeAveragePool2d(avg_pool));
+      break;
+    }
+    case luci::CircleOpcode::BATCH_MATMUL:
+    {
+      const auto batch_mat_mul = loco::must_cast<const luci::CircleBatchMatMul *>(circle_node);
+      scratchpad_sizes = _scratchpad_helper->ComputeScratchpadSizeBatchMatMul(batch_mat_mul);
+      break;
+    }
+    case luci::CircleOpcode::CONV_2D:
+    {
+      const auto conv = loco::must_cast<const luci::CircleConv2D *>(circle_node);
+      scratchpad_sizes.push_back(_scratchpad_helper->ComputeScratchpadSizeConv2d(conv));
+      break;
+    }
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+    {
+      const auto depthwise_conv = loco::must_cast<const luci::CircleDepthwiseConv2D *>(circle_node);
+      scratchpad_sizes.push_back(
+        _scratchpad_helper->ComputeScratchpadSizeDepthwiseConv2d(depthwise_conv));
+      break;
+    }
+    case luci::CircleOpcode::SVDF:
+    {
+      const auto svdf = loco::must_cast<const luci::CircleSVDF *>(circle_node);
+      scratchpad_sizes = _scratchpad_helper->ComputeScratchpadSizeSVDF(svdf);
+      break;
+    }
+    default:
+      break;
+  }
+  return scratchpad_sizes;
+}
+
 void ExecutionPlanner::dump_inform()
 {
   LOGGER(l);
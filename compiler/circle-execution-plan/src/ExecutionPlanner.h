@@ -107,6 +107,10 @@ public:
     _is_allocate_scratchpads = is_allocate_scratchpads;
   };
 
+  // Method change execution order mode:
+  // is_search_order = true - search execution order that requires less memory than default one
+  void change_order_mode(bool is_search_order) { _is_search_order = is_search_order; };
+
   void create_json_allocation_file(const std::string &json_path);
 
 private:
@@ -134,6 +138,14 @@ private:
   // but without inputs and output nodes and saves it in _ordered_nodes vector
   void get_default_execution_order_plan_without_inputs_and_outputs();
 
+  // Method searches execution order of _ordered_nodes with low peak memory, and replaces
+  // _ordered_nodes with it if it requires less memory with greedy by size approach.
+  void search_execution_order_plan();
+
+  // Method finds required size of buffer for current _ordered_nodes,
+  // and clears allocation information used to find it.
+  uint32_t get_required_size_of_order();
+
   // Method provides nodes with usage interval information.
   void get_usage_interval();
 
@@ -160,6 +172,12 @@ private:
   // experiments.
   void create_alloc_node_inform_vector();
 
+  // Method returns size of node to allocate in current planning mode.
+  uint32_t get_node_size(const luci::CircleNode *circle_node) const;
+
+  // Method returns sizes of scratchpad tensors of node in current planning mode.
+  std::vector<uint32_t> get_scratchpad_sizes(const luci::CircleNode *circle_node) const;
+
   // Stores allocation additional information for the all nodes from _graph.
   std::vector<AllocationNodeInformation> _alloc_node_inform_vector;
 
@@ -204,6 +222,9 @@ private:
   bool _is_allocate_consts = true;
   bool _is_allocate_inputs = true;
   bool _is_allocate_scratchpads = true;
+
+  // Flag for searching execution order with low memory instead of default one
+  bool _is_search_order = true;
 };
 
 } // namespace circle_planner
@@ -144,6 +144,12 @@ int entry(int argc, char **argv)
     .required(false)
     .help("path to save intermediate results");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .required(false)
+    .help("Number of threads used for evaluation (default: 1)");
+
   try
   {
     arser.parse(argc, argv);
@@ -172,6 +178,13 @@ int entry(int argc, char **argv)
   auto TF_style_maxpool = arser["--TF-style_maxpool"] and arser.get<bool>("--TF-style_maxpool");
   auto save_min_max = arser["--save_min_max"] and arser.get<bool>("--save_min_max");
 
+  auto num_threads = arser.get<int32_t>("--num_threads");
+  if (num_threads < 1)
+  {
+    std::cerr << "ERROR: number of threads must be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
+
   float qerror_ratio = arser.get<float>("--qerror_ratio");
   if (qerror_ratio < 0.0 || qerror_ratio > 1.f)
   {
@@ -220,6 +233,7 @@ int entry(int argc, char **argv)
     auto input_data =
       std::make_unique<mpqsolver::core::H5FileDataProvider>(data_path, input_model_path);
     bi_solver->setInputData(std::move(input_data));
+    bi_solver->setNumThreads(static_cast<uint32_t>(num_threads));
 
     {
       auto value = arser.get<std::string>(bisection_str);
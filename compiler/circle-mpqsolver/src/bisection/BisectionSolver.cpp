@@ -73,6 +73,36 @@ bool front_has_higher_error(const NodeDepthType &nodes_depth, const std::string
   return error_at_input > error_at_output;
 }
 
+/**
+ * @brief Return names of nodes in the front part which are used by the rear part
+ * @details The front part is (<= cut_depth) if int16_front, otherwise (< cut_depth), so that
+ *          quantization of the front part is the same for the following cuts at the left.
+ */
+std::set<std::string> boundary_nodes(const NodeDepthType &nodes_depth, float cut_depth,
+                                     bool int16_front)
+{
+  auto is_front = [&](float depth) { return int16_front ? depth <= cut_depth : depth < cut_depth; };
+
+  std::set<std::string> names;
+  for (auto &iter : nodes_depth)
+  {
+    if (!is_front(iter.second))
+      continue;
+
+    for (auto succ : loco::succs(iter.first))
+    {
+      auto succ_node = loco::must_cast<luci::CircleNode *>(succ);
+      auto succ_iter = nodes_depth.find(succ_node);
+      if (succ_iter != nodes_depth.end() && !is_front(succ_iter->second))
+      {
+        names.insert(iter.first->name());
+        break;
+      }
+    }
+  }
+  return names;
+}
+
 } // namespace
 
 BisectionSolver::BisectionSolver(const mpqsolver::core::Quantizer::Context &ctx, float qerror_ratio)
@@ -80,9 +110,9 @@ BisectionSolver::BisectionSolver(const mpqsolver::core::Quantizer::Context &ctx,
 {
 }
 
-float BisectionSolver::evaluate(const core::DatasetEvaluator &evaluator,
-                                const std::string &flt_path, const std::string &def_quant,
-                                core::LayerParams &layers)
+float BisectionSolver::evaluate(core::DatasetEvaluator &evaluator, const std::string &flt_path,
+                                const std::string &def_quant, core::LayerParams &layers,
+                                const std::set<std::string> &cache_nodes)
 {
   auto model = readModule(flt_path);
   assert(model != nullptr);
@@ -93,13 +123,15 @@ float BisectionSolver::evaluate(const core::DatasetEvaluator &evaluator,
     throw std::runtime_error("Failed to produce fake-quantized model.");
   }
 
-  return evaluator.evaluate(model.get());
+  return evaluator.evaluateWithCache(model.get(), cache_nodes);
 }
 
 void BisectionSolver::algorithm(Algorithm algorithm) { _algorithm = algorithm; }
 
 void BisectionSolver::setVisqPath(const std::string &visq_path) { _visq_data_path = visq_path; }
 
+void BisectionSolver::setNumThreads(uint32_t num_threads) { _num_threads = num_threads; }
+
 void BisectionSolver::setInputData(std::unique_ptr<mpqsolver::core::DataProvider> &&data)
 {
   _input_data = std::move(data);
@@ -127,15 +159,52 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
   {
     throw std::runtime_error("no input data");
   }
-  core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get());
+  core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get(),
+                                   _num_threads);
+
+  // let's decide whether nodes at input are more suspectible to be quantized into Q16, than at
+  // output
+  bool int16_front = true;
+  switch (_algorithm)
+  {
+    case Algorithm::Auto:
+      int16_front =
+        front_has_higher_error(nodes_depth, _visq_data_path, 0.5f * (max_depth + min_depth));
+      break;
+    case Algorithm::ForceQ16Front:
+      SolverOutput::get() << "Front part will be Q16, while the rear will be Q8\n";
+      int16_front = true;
+      break;
+    case Algorithm::ForceQ16Back:
+      SolverOutput::get() << "Front part will be Q8, while the rear will be Q16\n";
+      int16_front = false;
+      break;
+  }
+
+  // Activations at the first cut are cached by the baseline model with the precision of the
+  // front part, which is evaluated last
+  const auto first_cut_nodes = boundary_nodes(
+    nodes_depth, static_cast<int>(std::floor(0.5f * (min_depth + max_depth))), int16_front);
+  const std::set<std::string> no_cache_nodes;
 
   core::LayerParams layer_params;
-  float int16_qerror =
-    evaluate(evaluator, module_path, "int16" /* default quant_dtype */, layer_params);
+  float int16_qerror = 0.f;
+  float uint8_qerror = 0.f;
+  if (int16_front)
+  {
+    uint8_qerror = evaluate(evaluator, module_path, "uint8" /* default quant_dtype */,
+                            layer_params, no_cache_nodes);
+    int16_qerror = evaluate(evaluator, module_path, "int16" /* default quant_dtype */,
+                            layer_params, first_cut_nodes);
+  }
+  else
+  {
+    int16_qerror = evaluate(evaluator, module_path, "int16" /* default quant_dtype */,
+                            layer_params, no_cache_nodes);
+    uint8_qerror = evaluate(evaluator, module_path, "uint8" /* default quant_dtype */,
+                            layer_params, first_cut_nodes);
+  }
   SolverOutput::get() << "Full int16 model qerror: " << int16_qerror << "\n";
-
-  float uint8_qerror =
-    evaluate(evaluator, module_path, "uint8" /* default quant_dtype */, layer_params);
   SolverOutput::get() << "Full uint8 model qerror: " << uint8_qerror << "\n";
   _quantizer->setHook(_hooks.get());
   if (_hooks)
@@ -208,25 +277,6 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
     active_nodes.erase(node);
   }
 
-  // let's decide whether nodes at input are more suspectible to be quantized into Q16, than at
-  // output
-  bool int16_front = true;
-  switch (_algorithm)
-  {
-    case Algorithm::Auto:
-      int16_front =
-        front_has_higher_error(nodes_depth, _visq_data_path, 0.5f * (max_depth + min_depth));
-      break;
-    case Algorithm::ForceQ16Front:
-      SolverOutput::get() << "Front part will be Q16, while the rear will be Q8\n";
-      int16_front = true;
-      break;
-    case Algorithm::ForceQ16Back:
-      SolverOutput::get() << "Front part will be Q8, while the rear will be Q16\n";
-      int16_front = false;
-      break;
-  }
-
   SolverOutput::get() << "\n";
 
   while (true)
@@ -273,7 +323,16 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
       }
     }
 
-    float cur_error = evaluate(evaluator, module_path, "uint8", layer_params);
+    // The front part of this cut is the same for the next cut at the right, and the front
+    // part of the next cut at the left is the same as in this cut
+    auto cache_nodes = boundary_nodes(nodes_depth, cut_depth, int16_front);
+    {
+      const int left_depth = static_cast<int>(std::floor(0.5f * (min_depth + cut_depth)));
+      const auto left_nodes = boundary_nodes(nodes_depth, left_depth, int16_front);
+      cache_nodes.insert(left_nodes.begin(), left_nodes.end());
+    }
+
+    float cur_error = evaluate(evaluator, module_path, "uint8", layer_params, cache_nodes);
 
     if (_hooks)
     {
@@ -23,6 +23,7 @@
 #include <luci/IR/Module.h>
 
 #include <memory>
+#include <set>
 #include <string>
 
 namespace mpqsolver
@@ -76,15 +77,26 @@ public:
    */
   void setVisqPath(const std::string &visq_path);
 
+  /**
+   * @brief set number of threads used for evaluation
+   */
+  void setNumThreads(uint32_t num_threads);
+
 private:
-  float evaluate(const core::DatasetEvaluator &evaluator, const std::string &module_path,
-                 const std::string &def_quant, core::LayerParams &layers);
+  /**
+   * @brief evaluate the model quantized with layers, activations of cache_nodes are kept
+   *        to be reused by the next evaluation
+   */
+  float evaluate(core::DatasetEvaluator &evaluator, const std::string &module_path,
+                 const std::string &def_quant, core::LayerParams &layers,
+                 const std::set<std::string> &cache_nodes);
 
 private:
   const float _qerror_ratio = 0.f; // quantization error ratio
   float _qerror = 0.f;             // quantization error
   Algorithm _algorithm = Algorithm::ForceQ16Front;
   std::string _visq_data_path;
+  uint32_t _num_threads = 1;
   std::unique_ptr<mpqsolver::core::DataProvider> _input_data;
 };
 
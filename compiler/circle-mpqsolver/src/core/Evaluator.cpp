@@ -18,12 +18,19 @@
 
 #include "core/DataProvider.h"
 
+#include <luci/IR/CircleNodes.h>
 #include <luci/IR/DataTypeHelper.h>
 
 #include <luci_interpreter/Interpreter.h>
+#include <luci_interpreter/core/DataType.h>
 
 #include <dio_hdf5/HDF5Importer.h>
 
+#include <exception>
+#include <limits>
+#include <string>
+#include <thread>
+
 using namespace mpqsolver::core;
 
 using Shape = std::vector<loco::Dimension>;
@@ -33,6 +40,9 @@ namespace
 
 using namespace luci;
 
+// Activations are not cached beyond this size
+const size_t max_cache_size_bytes = 1 * 1024 * 1024 * 1024UL;
+
 template <typename NodeT> size_t get_tensor_size(const NodeT *node)
 {
   uint32_t tensor_size = luci::size(node->dtype());
@@ -41,65 +51,404 @@ template <typename NodeT> size_t get_tensor_size(const NodeT *node)
   return tensor_size;
 }
 
-WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data_provider)
+/**
+ * @brief Observer to copy activations of target nodes for the current record
+ */
+class ActivationCollector final : public luci_interpreter::ExecutionObserver
 {
-  if (data_provider == nullptr)
+public:
+  using Targets = std::unordered_map<const luci::CircleNode *, std::vector<Buffer> *>;
+
+  explicit ActivationCollector(const Targets &targets) : _targets(targets) {}
+
+  void record(uint32_t record_idx) { _record_idx = record_idx; }
+
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override
   {
-    throw std::runtime_error("No data");
+    auto iter = _targets.find(node);
+    if (iter == _targets.end())
+      return;
+
+    const auto size = luci_interpreter::getDataTypeSize(tensor->element_type()) *
+                      tensor->shape().num_elements();
+    const auto data = tensor->data<char>();
+    iter->second->at(_record_idx).assign(data, data + size);
   }
 
-  const auto num_records = data_provider->numSamples();
-  if (num_records == 0)
-    throw std::runtime_error("The input data file does not contain any record.");
+private:
+  const Targets &_targets;
+  uint32_t _record_idx = 0;
+};
+
+/**
+ * @brief Interpret module for all records
+ *
+ * @param inputs  inputs[input_index][record_index] is fed to the graph input of input_index
+ * @param targets activations of these nodes are copied for each record
+ */
+WholeOutput compute_outputs(const luci::Module *module,
+                            const std::vector<const std::vector<Buffer> *> &inputs,
+                            uint32_t num_records, uint32_t num_threads,
+                            const ActivationCollector::Targets &targets)
+{
   const auto input_nodes = loco::input_nodes(module->graph());
   const auto num_inputs = input_nodes.size();
+  if (num_inputs != inputs.size())
+    throw std::runtime_error("Wrong number of inputs.");
 
-  WholeOutput dataset_output;
+  const auto run_threads = std::max(1u, std::min(num_threads, num_records));
 
-  // Create interpreter.
-  luci_interpreter::Interpreter interpreter(module);
-  for (uint32_t record_idx = 0; record_idx < num_records; record_idx++)
+  // Create interpreters. Each thread owns its interpreter and observer.
+  std::vector<std::unique_ptr<luci_interpreter::Interpreter>> interpreters;
+  std::vector<std::unique_ptr<ActivationCollector>> collectors;
+  for (uint32_t t = 0; t < run_threads; ++t)
   {
-    if (num_inputs != data_provider->numInputs(record_idx))
-      throw std::runtime_error("Wrong number of inputs.");
-    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    interpreters.emplace_back(std::make_unique<luci_interpreter::Interpreter>(module));
+    collectors.emplace_back(std::make_unique<ActivationCollector>(targets));
+    if (not targets.empty())
+      interpreters.back()->attachObserver(collectors.back().get());
+  }
+
+  WholeOutput dataset_output(num_records);
+  std::vector<std::exception_ptr> errors(run_threads);
+
+  auto interpret_batch = [&](uint32_t t, uint32_t begin, uint32_t end) {
+    try
     {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
+      auto &interpreter = *interpreters.at(t);
+      for (uint32_t record_idx = begin; record_idx < end; record_idx++)
+      {
+        for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+        {
+          const auto *input_node =
+            loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+          assert(input_node->index() == input_idx);
 
-      InputData input_data(get_tensor_size(input_node));
-      data_provider->getSampleInput(record_idx, input_idx, input_data);
+          const auto &input_data = inputs[input_idx]->at(record_idx);
+          interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
+        }
 
-      interpreter.writeInputTensor(input_node, input_data.data().data(), input_data.data().size());
-    }
+        collectors.at(t)->record(record_idx);
+        interpreter.interpret();
 
-    interpreter.interpret();
+        Output nn_output;
 
-    Output nn_output;
+        // Get output.
+        const auto output_nodes = loco::output_nodes(module->graph());
+        for (size_t i = 0; i < module->graph()->outputs()->size(); i++)
+        {
+          const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+          Buffer output_data(get_tensor_size(output_node));
+          interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
+          // output
+          nn_output.push_back(output_data);
+        }
+        dataset_output[record_idx] = std::move(nn_output);
+      }
+    }
+    catch (...)
+    {
+      errors[t] = std::current_exception();
+    }
+  };
 
-    // Get output.
-    const auto output_nodes = loco::output_nodes(module->graph());
-    for (size_t i = 0; i < module->graph()->outputs()->size(); i++)
+  const uint32_t records_batch = num_records / run_threads;
+  if (run_threads == 1)
+  {
+    interpret_batch(0, 0, num_records);
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < run_threads; ++t)
     {
-      const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
-      Buffer output_data(get_tensor_size(output_node));
-      interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
-      // output
-      nn_output.push_back(output_data);
+      const auto batch_end = t < run_threads - 1 ? records_batch * (t + 1) : num_records;
+      threads.emplace_back(interpret_batch, t, records_batch * t, batch_end);
     }
-    dataset_output.push_back(nn_output);
+    for (auto &thread : threads)
+      thread.join();
+  }
+
+  for (auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
   }
 
   return dataset_output;
 }
 
+/**
+ * @brief Bytes describing a node, which are compared to tell whether two nodes are the same
+ */
+class Description
+{
+public:
+  void add(const void *data, size_t size) { _bytes.append(static_cast<const char *>(data), size); }
+
+  template <typename T> void add(const T &value) { add(&value, sizeof(T)); }
+
+  template <typename T> void add(const std::vector<T> &values)
+  {
+    add(values.size());
+    add(values.data(), values.size() * sizeof(T));
+  }
+
+  void add(const std::string &str)
+  {
+    add(str.size());
+    add(str.data(), str.size());
+  }
+
+  const std::string &bytes() const { return _bytes; }
+  std::string &bytes() { return _bytes; }
+
+private:
+  std::string _bytes;
+};
+
+/**
+ * @brief Hash (FNV-1a) to compute signatures of nodes
+ */
+class Hasher
+{
+public:
+  void add(const void *data, size_t size)
+  {
+    const auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      _value ^= bytes[i];
+      _value *= 1099511628211ULL;
+    }
+  }
+
+  template <typename T> void add(const T &value) { add(&value, sizeof(T)); }
+
+  void add(const std::string &str) { add(str.data(), str.size()); }
+
+  uint64_t value() const { return _value; }
+
+private:
+  uint64_t _value = 14695981039346656037ULL;
+};
+
+template <loco::DataType DT> void add_const_data(Description &desc, const luci::CircleConst *node)
+{
+  const auto size = node->size<DT>();
+  desc.add(size);
+  if (size > 0)
+    desc.add(&node->at<DT>(0), size * sizeof(typename loco::DataTypeImpl<DT>::Type));
+}
+
+/**
+ * @brief Describe node itself apart from its inputs, i.e., name, opcode, dtype, shape,
+ *        quantization parameters and constant data. Attributes are not included as they are
+ *        not changed by quantization.
+ * @return false if the value of node should not be reused
+ */
+bool describe_node(const luci::CircleNode *node, Description &desc)
+{
+  desc.add(node->name());
+  desc.add(node->opcode());
+  desc.add(node->dtype());
+  desc.add(node->rank());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    desc.add(node->dim(i).known() ? node->dim(i).value() : 0u);
+
+  if (auto qparam = node->quantparam())
+  {
+    desc.add(qparam->min);
+    desc.add(qparam->max);
+    desc.add(qparam->scale);
+    desc.add(qparam->zerop);
+    desc.add(qparam->quantized_dimension);
+  }
+
+  if (auto const_node = dynamic_cast<const luci::CircleConst *>(node))
+  {
+    switch (const_node->dtype())
+    {
+      case loco::DataType::FLOAT32:
+        add_const_data<loco::DataType::FLOAT32>(desc, const_node);
+        break;
+      case loco::DataType::U8:
+        add_const_data<loco::DataType::U8>(desc, const_node);
+        break;
+      case loco::DataType::S8:
+        add_const_data<loco::DataType::S8>(desc, const_node);
+        break;
+      case loco::DataType::S16:
+        add_const_data<loco::DataType::S16>(desc, const_node);
+        break;
+      case loco::DataType::S32:
+        add_const_data<loco::DataType::S32>(desc, const_node);
+        break;
+      case loco::DataType::S64:
+        add_const_data<loco::DataType::S64>(desc, const_node);
+        break;
+      case loco::DataType::BOOL:
+        add_const_data<loco::DataType::BOOL>(desc, const_node);
+        break;
+      default:
+        return false;
+    }
+  }
+
+  // Subgraphs are not considered
+  if (dynamic_cast<const luci::CircleIf *>(node) || dynamic_cast<const luci::CircleWhile *>(node))
+    return false;
+
+  return true;
+}
+
+/**
+ * @brief Return whether the value of node can be cached and fed as a graph input
+ */
+bool is_cacheable(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CIRCLECONST:
+    case luci::CircleOpcode::CIRCLEINPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE:
+    case luci::CircleOpcode::CIRCLEVARIABLE:
+      return false;
+    default:
+      break;
+  }
+
+  if (node->shape_status() == luci::ShapeStatus::NOSHAPE)
+    return false;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (not node->dim(i).known())
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Compute signatures of nodes reachable from outputs
+ * @details The signature of a node is a hash of its description and the signatures of its
+ *          inputs, to find nodes that may be computed in the same way. Signature 0 means that
+ *          the node should not be cached.
+ */
+std::unordered_map<const loco::Node *, uint64_t> compute_signatures(loco::Graph *graph)
+{
+  std::unordered_map<const loco::Node *, uint64_t> signatures;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    Description desc;
+    bool valid = describe_node(loco::must_cast<const luci::CircleNode *>(node), desc);
+
+    Hasher hasher;
+    hasher.add(desc.bytes());
+    for (uint32_t i = 0; i < node->arity(); ++i)
+    {
+      const auto arg = node->arg(i);
+      const auto arg_signature = arg != nullptr ? signatures.at(arg) : 1;
+      valid = valid && arg_signature != 0;
+      hasher.add(arg_signature);
+    }
+
+    signatures[node] = valid && hasher.value() != 0 ? hasher.value() : 0;
+  }
+  return signatures;
+}
+
+/**
+ * @brief Describe how the value of node is computed, i.e., descriptions of node and all of its
+ *        predecessors in post-order, each followed by the positions of its inputs
+ * @note  Equal computations give the same value, unlike equal signatures which may collide
+ */
+std::vector<std::string> describe_computation(luci::CircleNode *node)
+{
+  std::vector<std::string> computation;
+  std::unordered_map<const loco::Node *, uint32_t> positions;
+  for (auto pred : loco::postorder_traversal(std::vector<loco::Node *>{node}))
+  {
+    Description desc;
+    describe_node(loco::must_cast<const luci::CircleNode *>(pred), desc);
+    for (uint32_t i = 0; i < pred->arity(); ++i)
+    {
+      const auto arg = pred->arg(i);
+      desc.add(arg != nullptr ? positions.at(arg) : std::numeric_limits<uint32_t>::max());
+    }
+    positions[pred] = static_cast<uint32_t>(computation.size());
+    computation.emplace_back(std::move(desc.bytes()));
+  }
+  return computation;
+}
+
+/**
+ * @brief Replace node with a new graph input having the same dtype and shape
+ * @return index of the new graph input
+ */
+uint32_t replace_with_input(loco::Graph *graph, luci::CircleNode *node)
+{
+  auto input = graph->nodes()->create<luci::CircleInput>();
+  auto graph_input = graph->inputs()->create();
+  luci::link(graph_input, input);
+
+  input->name(node->name());
+  input->dtype(node->dtype());
+  input->rank(node->rank());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    input->dim(i) = node->dim(i);
+  input->shape_status(luci::ShapeStatus::VALID);
+  luci::copy_quantparam(node, input);
+
+  graph_input->name(node->name());
+  graph_input->dtype(node->dtype());
+
+  loco::replace(node).with(input);
+
+  return graph_input->index();
+}
+
 } // namespace
 
 DatasetEvaluator::DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
-                                   const ErrorMetric &metric)
-  : _ref_module(ref_module), _provider(&provider), _metric(&metric)
+                                   const ErrorMetric &metric, uint32_t num_threads)
+  : _ref_module(ref_module), _provider(&provider), _metric(&metric), _num_threads(num_threads)
 {
-  _ref_output = compute_outputs(_ref_module, _provider);
+  if (_num_threads == 0)
+    throw std::runtime_error("Number of threads should be positive");
+
+  if (_ref_module == nullptr)
+    throw std::runtime_error("Invalid reference module");
+
+  const auto num_records = _provider->numSamples();
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+  const auto input_nodes = loco::input_nodes(_ref_module->graph());
+  const auto num_inputs = input_nodes.size();
+
+  // Read all records at once, data provider is not thread-safe
+  _inputs.resize(num_inputs);
+  for (uint32_t record_idx = 0; record_idx < num_records; record_idx++)
+  {
+    if (num_inputs != _provider->numInputs(record_idx))
+      throw std::runtime_error("Wrong number of inputs.");
+    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      assert(input_node->index() == input_idx);
+
+      InputData input_data(get_tensor_size(input_node));
+      _provider->getSampleInput(record_idx, input_idx, input_data);
+
+      _inputs[input_idx].emplace_back(std::move(input_data.data()));
+    }
+  }
+
+  std::vector<const std::vector<Buffer> *> inputs;
+  for (const auto &input : _inputs)
+    inputs.push_back(&input);
+  _ref_output = compute_outputs(_ref_module, inputs, num_records, _num_threads, {});
 }
 
 void DatasetEvaluator::validate(const luci::Module *trgt_fq_module) const
@@ -124,7 +473,152 @@ float DatasetEvaluator::evaluate(const luci::Module *trgt_fq_module) const
 
   validate(trgt_fq_module);
 
-  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _provider);
+  std::vector<const std::vector<Buffer> *> inputs;
+  for (const auto &input : _inputs)
+    inputs.push_back(&input);
+
+  const WholeOutput &cur_output =
+    compute_outputs(trgt_fq_module, inputs, _ref_output.size(), _num_threads, {});
+  float error = _metric->compute(_ref_output, cur_output);
+  return error;
+}
+
+float DatasetEvaluator::evaluateWithCache(luci::Module *trgt_fq_module,
+                                          const std::set<std::string> &cache_nodes)
+{
+  if (trgt_fq_module == nullptr)
+    throw std::runtime_error("Invalid target module");
+
+  if (_metric == nullptr)
+    throw std::runtime_error("Invalid metric");
+
+  validate(trgt_fq_module);
+
+  const auto num_records = static_cast<uint32_t>(_ref_output.size());
+  auto graph = trgt_fq_module->graph();
+  const auto signatures = compute_signatures(graph);
+
+  // Find nodes by name, names used by several nodes are ignored
+  std::unordered_map<std::string, luci::CircleNode *> name_to_node;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    auto result = name_to_node.emplace(circle_node->name(), circle_node);
+    if (not result.second)
+      result.first->second = nullptr;
+  }
+
+  auto find_node = [&](const std::string &name) -> luci::CircleNode * {
+    auto iter = name_to_node.find(name);
+    if (iter == name_to_node.end() || iter->second == nullptr)
+      return nullptr;
+    if (not is_cacheable(iter->second) || signatures.at(iter->second) == 0)
+      return nullptr;
+    return iter->second;
+  };
+
+  std::vector<const std::vector<Buffer> *> inputs;
+  for (const auto &input : _inputs)
+    inputs.push_back(&input);
+
+  // Replace nodes with cached activations, starting from the one closest to outputs so that
+  // cached nodes which are no longer used are not fed
+  std::vector<luci::CircleNode *> reused_nodes;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    auto cached = _cache.find(circle_node->name());
+    if (cached == _cache.end() || find_node(circle_node->name()) != circle_node)
+      continue;
+    // Signatures of different computations may collide, so the computations are compared too
+    if (cached->second.signature != signatures.at(circle_node) ||
+        cached->second.computation != describe_computation(circle_node))
+      continue;
+    reused_nodes.push_back(circle_node);
+  }
+
+  // Computations of nodes to be cached are described before nodes are replaced with inputs
+  std::unordered_map<std::string, std::vector<std::string>> computations;
+  for (const auto &name : cache_nodes)
+  {
+    if (auto node = find_node(name))
+      computations[name] = describe_computation(node);
+  }
+
+  std::set<std::string> reused_names;
+  for (auto iter = reused_nodes.rbegin(); iter != reused_nodes.rend(); ++iter)
+  {
+    auto node = *iter;
+    const auto active_nodes = loco::active_nodes(loco::output_nodes(graph));
+    if (active_nodes.find(node) == active_nodes.end())
+      continue;
+
+    const auto input_index = replace_with_input(graph, node);
+    assert(input_index == inputs.size());
+    (void)input_index;
+    inputs.push_back(&_cache.at(node->name()).records);
+    reused_names.insert(node->name());
+  }
+
+  // Prepare activations to be cached by this evaluation
+  std::unordered_map<std::string, CachedActivation> new_cache;
+  ActivationCollector::Targets targets;
+  {
+    const auto active_nodes = loco::active_nodes(loco::output_nodes(graph));
+
+    size_t cache_size = 0;
+    for (const auto &name : reused_names)
+    {
+      if (cache_nodes.find(name) != cache_nodes.end())
+        cache_size += _cache.at(name).records.front().size() * num_records;
+    }
+
+    for (const auto &name : cache_nodes)
+    {
+      if (reused_names.find(name) != reused_names.end())
+        continue;
+
+      auto node = find_node(name);
+      if (node == nullptr || active_nodes.find(node) == active_nodes.end())
+        continue;
+
+      const auto size = get_tensor_size(node) * num_records;
+      if (cache_size + size > max_cache_size_bytes)
+        continue;
+      cache_size += size;
+
+      auto &entry = new_cache[name];
+      entry.signature = signatures.at(node);
+      entry.computation = std::move(computations.at(name));
+      entry.records.resize(num_records);
+      targets[node] = &entry.records;
+    }
+  }
+
+  const WholeOutput &cur_output =
+    compute_outputs(trgt_fq_module, inputs, num_records, _num_threads, targets);
   float error = _metric->compute(_ref_output, cur_output);
+
+  // Drop activations which were not recorded as expected (e.g., of dynamic shape)
+  for (const auto &target : targets)
+  {
+    const auto expected_size = get_tensor_size(target.first);
+    for (const auto &record : *target.second)
+    {
+      if (record.size() != expected_size)
+      {
+        new_cache.erase(target.first->name());
+        break;
+      }
+    }
+  }
+
+  for (const auto &name : reused_names)
+  {
+    if (cache_nodes.find(name) != cache_nodes.end())
+      new_cache[name] = std::move(_cache.at(name));
+  }
+  _cache = std::move(new_cache);
+
   return error;
 }
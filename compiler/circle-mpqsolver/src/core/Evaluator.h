@@ -24,7 +24,9 @@
 #include <luci/IR/Module.h>
 #include <luci/CircleQuantizer.h>
 
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mpqsolver
@@ -37,9 +39,11 @@ class DatasetEvaluator final
 public:
   /**
    * @brief create Evaluator for comparing output of ref_module on provider
+   * @note  all records of provider are read at once, and records are interpreted by
+   *        num_threads threads
    */
   DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
-                   const ErrorMetric &metric);
+                   const ErrorMetric &metric, uint32_t num_threads = 1);
   DatasetEvaluator() = delete;
   ~DatasetEvaluator() = default;
 
@@ -49,17 +53,44 @@ public:
    */
   float evaluate(const luci::Module *trgt_fq_module) const;
 
+  /**
+   * @brief evaluate trgt_fq_module (fake-quantized) reusing activations of the previous call
+   * returns error-metric
+   * @details Activations of cache_nodes (names of nodes) are kept after evaluation. On the next
+   *          call, a cached node whose value is computed in the same way (same quantization
+   *          and constants of the node and all of its predecessors, compared byte by byte) is
+   *          replaced by a new graph input fed by the cached activations, so only the rest of
+   *          the graph is interpreted.
+   *          Modules of the calls must be derived from the same float model.
+   * @note  trgt_fq_module is modified and should not be used after evaluation
+   */
+  float evaluateWithCache(luci::Module *trgt_fq_module, const std::set<std::string> &cache_nodes);
+
 private:
   /**
    * @brief throws if there is something wrong with the module
    */
   void validate(const luci::Module *module) const;
 
+private:
+  struct CachedActivation
+  {
+    uint64_t signature = 0;
+    // how the activations are computed, compared when signatures match
+    std::vector<std::string> computation;
+    std::vector<Buffer> records;
+  };
+
 private:
   const luci::Module *_ref_module = nullptr;
   const DataProvider *_provider = nullptr;
   WholeOutput _ref_output;
   const ErrorMetric *_metric = nullptr;
+  uint32_t _num_threads = 1;
+  // _inputs[input_index][record_index]
+  std::vector<std::vector<Buffer>> _inputs;
+  // activations cached by evaluateWithCache, keyed by node name
+  std::unordered_map<std::string, CachedActivation> _cache;
 };
 
 } // namespace core
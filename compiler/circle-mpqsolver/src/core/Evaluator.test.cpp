@@ -42,3 +42,97 @@ TEST(CircleMPQSolverEvaluatorTest, empty_path_NEG)
   EXPECT_ANY_THROW(mpqsolver::core::H5FileDataProvider data("", "");
                    mpqsolver::core::DatasetEvaluator evaluator(nullptr, data, metric));
 }
+
+TEST(CircleMPQSolverEvaluatorTest, evaluateWithCache)
+{
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+
+  auto ref = luci::make_module();
+  {
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(ref.get());
+  }
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric);
+
+  // activation of "add" is cached
+  auto m1 = luci::make_module();
+  {
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(m1.get());
+  }
+  EXPECT_FLOAT_EQ(evaluator.evaluateWithCache(m1.get(), {"add"}), 0.f);
+  EXPECT_EQ(1, m1->graph()->inputs()->size());
+
+  // "add" is replaced by the cached activation
+  auto m2 = luci::make_module();
+  {
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(m2.get());
+  }
+  EXPECT_FLOAT_EQ(evaluator.evaluateWithCache(m2.get(), {"add"}), 0.f);
+  EXPECT_EQ(2, m2->graph()->inputs()->size());
+}
+
+TEST(CircleMPQSolverEvaluatorTest, evaluateWithCache_changed_const)
+{
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+
+  auto ref = luci::make_module();
+  {
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(ref.get());
+  }
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric);
+
+  auto m1 = luci::make_module();
+  {
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(m1.get());
+  }
+  EXPECT_FLOAT_EQ(evaluator.evaluateWithCache(m1.get(), {"add"}), 0.f);
+
+  // "add" is recomputed as its input is changed
+  auto m2 = luci::make_module();
+  {
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(m2.get());
+  }
+  auto add = loco::must_cast<luci::CircleAdd *>(loco::output_nodes(m2->graph())[0]->arg(0));
+  auto beta = loco::must_cast<luci::CircleConst *>(add->y());
+  beta->at<loco::DataType::FLOAT32>(0) = 1.f;
+  EXPECT_GT(evaluator.evaluateWithCache(m2.get(), {"add"}), 0.f);
+  EXPECT_EQ(1, m2->graph()->inputs()->size());
+}
+
+TEST(CircleMPQSolverEvaluatorTest, evaluateWithCache_nullptr_NEG)
+{
+  auto m = luci::make_module();
+  mpqsolver::test::models::AddGraph g;
+  g.init();
+  g.transfer_to(m.get());
+
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(m.get(), *data.get(), metric);
+  EXPECT_ANY_THROW(evaluator.evaluateWithCache(nullptr, {"add"}));
+}
+
+TEST(CircleMPQSolverEvaluatorTest, zero_threads_NEG)
+{
+  auto m = luci::make_module();
+  mpqsolver::test::models::AddGraph g;
+  g.init();
+  g.transfer_to(m.get());
+
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  EXPECT_ANY_THROW(mpqsolver::core::DatasetEvaluator evaluator(m.get(), *data.get(), metric, 0));
+}
@@ -15,6 +15,7 @@
  */
 
 #include "PartitionRead.h"
+#include "PartitionCostRead.h"
 #include "PartitionExport.h"
 #include "HelperPath.h"
 
@@ -23,6 +24,7 @@
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 #include <luci/CircleOptimizer.h>
+#include <luci/PartitionCost.h>
 #include <luci/PartitionDump.h>
 #include <luci/PartitionValidate.h>
 #include <luci/Log.h>
@@ -42,6 +44,10 @@ const char *opt_def = "--default";
 const char *opt_part_file = "--part_file";
 const char *opt_input_file = "--input_file";
 const char *opt_work_path = "--work_path";
+const char *opt_exec_time = "--exec_time";
+const char *opt_op_latency = "--op_latency";
+const char *opt_transfer_cost = "--transfer_cost";
+const char *opt_nnpkg = "--nnpkg";
 
 void print_version(void)
 {
@@ -57,12 +63,20 @@ void build_arser(arser::Arser &arser)
 
   arser.add_argument(opt_def).help("Default backend to assign");
 
-  arser.add_argument(opt_part_file)
-    .required(true)
-    .help("Partition file which provides backend to assign");
+  arser.add_argument(opt_part_file).help("Partition file which provides backend to assign");
   arser.add_argument(opt_input_file).required(true).help("Input circle model filename");
   arser.add_argument(opt_work_path)
     .help("Work folder of partition, input files exist and output files are produced");
+
+  arser.add_argument(opt_exec_time)
+    .help("exec_time json file of onert profiling to partition by cost, instead of part_file");
+  arser.add_argument(opt_op_latency)
+    .help("CSV file of 'op name,latency' to partition by cost, instead of part_file");
+  arser.add_argument(opt_transfer_cost)
+    .type(arser::DataType::FLOAT)
+    .help("Latency to pass one byte of tensor between partitions, for partition by cost");
+  arser.add_argument(opt_nnpkg).nargs(0).default_value(false).help(
+    "Write nnpackage manifest to 'metadata/MANIFEST' of work folder");
 }
 
 std::unique_ptr<luci::Module> load_model(const std::string &input_path)
@@ -93,7 +107,19 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  std::string partition_file = arser.get<std::string>(opt_part_file);
+  bool by_cost = arser[opt_exec_time] or arser[opt_op_latency];
+  if (not by_cost and not arser[opt_part_file])
+  {
+    std::cerr << "ERROR: " << opt_part_file << " or cost of ops is required" << std::endl;
+    std::cerr << arser;
+    return EXIT_FAILURE;
+  }
+  if (by_cost and not arser[opt_bks])
+  {
+    std::cerr << "ERROR: " << opt_bks << " is required to partition by cost" << std::endl;
+    return EXIT_FAILURE;
+  }
+
   std::string input_file = arser.get<std::string>(opt_input_file);
   std::string work_folder = ".";
 
@@ -102,7 +128,6 @@ int entry(int argc, char **argv)
     work_folder = arser.get<std::string>(opt_work_path);
   }
 
-  std::string partition_path = work_folder + "/" + partition_file;
   std::string input_path = work_folder + "/" + input_file;
 
   auto module = load_model(input_path);
@@ -125,13 +150,31 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  // Read partition information
-  INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
-  auto partition = partee::read(partition_path);
-  INFO(l) << partition << std::endl;
-
-  // override with command line arguments
+  luci::PartitionTable partition;
+  if (by_cost)
+  {
+    // Split nodes into stages of backends in order, balancing cost of stages
+    INFO(l) << "--- Read PartitionCost-------------------------" << std::endl;
+    luci::PartitionCost cost;
+    if (arser[opt_transfer_cost])
+      cost.transfer = arser.get<float>(opt_transfer_cost);
+    if (arser[opt_exec_time])
+      partee::read_exec_time(work_folder + "/" + arser.get<std::string>(opt_exec_time), cost);
+    if (arser[opt_op_latency])
+      partee::read_op_latency(work_folder + "/" + arser.get<std::string>(opt_op_latency), cost);
+
+    auto stages = pepper::csv_to_vector<std::string>(arser.get<std::string>(opt_bks));
+    partition = luci::partition_by_cost(module.get(), stages, cost);
+  }
+  else
   {
+    // Read partition information
+    INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
+    std::string partition_path = work_folder + "/" + arser.get<std::string>(opt_part_file);
+    partition = partee::read(partition_path);
+    INFO(l) << partition << std::endl;
+
+    // override with command line arguments
     if (arser[opt_bks])
     {
       auto backend_backends = arser.get<std::string>(opt_bks);
@@ -202,6 +245,13 @@ int entry(int argc, char **argv)
   {
     return EXIT_FAILURE;
   }
+  if (arser.get<bool>(opt_nnpkg))
+  {
+    if (!partee::export_nnpkg_manifest(work_folder, module.get(), pms))
+    {
+      return EXIT_FAILURE;
+    }
+  }
 
   INFO(l) << "--- Partition done-----------------------------" << std::endl << std::endl;
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCostRead.h"
+
+#include <luci/Log.h>
+
+#include <json.h>
+
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+
+Json::Value read_json(const std::string &path)
+{
+  std::ifstream ifs(path);
+  if (not ifs.is_open())
+    throw std::runtime_error("Cannot open file: " + path);
+
+  Json::Value root;
+  JSONCPP_STRING errs;
+  Json::CharReaderBuilder builder;
+  if (not parseFromStream(builder, ifs, &root, &errs))
+    throw std::runtime_error("Cannot parse json file: " + path + ". " + errs);
+
+  return root;
+}
+
+} // namespace
+
+namespace partee
+{
+
+void read_exec_time(const std::string &path, luci::PartitionCost &cost)
+{
+  LOGGER(l);
+
+  INFO(l) << "ExecTime: " << path << std::endl;
+
+  // Format is {"backend": {"operation": {"is_quantized": [[bytes, latency], ...]}}}
+  // where "operation" is id of other backend for Permute records
+  auto root = read_json(path);
+  if (not root.isObject())
+    throw std::runtime_error("Invalid exec_time file: " + path);
+
+  double permute_latency = 0.0;
+  double permute_bytes = 0.0;
+  for (const auto &backend : root.getMemberNames())
+  {
+    const auto &operations = root[backend];
+    for (const auto &operation : operations.getMemberNames())
+    {
+      const bool is_permute = root.isMember(operation);
+      for (const auto &quant : operations[operation].getMemberNames())
+      {
+        // TODO Select records by type of model. Records of float model are used for now.
+        if (quant == "1" && operations[operation].isMember("0"))
+          continue;
+
+        for (const auto &record : operations[operation][quant])
+        {
+          if (not record.isArray() || record.size() != 2)
+            throw std::runtime_error("Invalid exec_time record of " + operation);
+
+          const auto bytes = record[0].asUInt();
+          const auto latency = record[1].asDouble();
+          if (is_permute)
+          {
+            // NOTE bytes of Permute is sum of its input and output
+            permute_latency += latency;
+            permute_bytes += bytes / 2.0;
+          }
+          else
+          {
+            cost.byopcodes[backend][operation][bytes] = latency;
+          }
+        }
+      }
+    }
+  }
+
+  if (cost.transfer == 0.0 && permute_bytes > 0.0)
+    cost.transfer = permute_latency / permute_bytes;
+
+  INFO(l) << "Transfer latency per byte: " << cost.transfer << std::endl;
+}
+
+void read_op_latency(const std::string &path, luci::PartitionCost &cost)
+{
+  LOGGER(l);
+
+  INFO(l) << "OpLatency: " << path << std::endl;
+
+  std::ifstream ifs(path);
+  if (not ifs.is_open())
+    throw std::runtime_error("Cannot open file: " + path);
+
+  std::string line;
+  while (std::getline(ifs, line))
+  {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    // NOTE op name may have ',' so split with the last one
+    auto pos = line.find_last_of(',');
+    if (pos == std::string::npos)
+      throw std::runtime_error("Invalid op latency line: " + line);
+
+    cost.byopnames[line.substr(0, pos)] = std::stod(line.substr(pos + 1));
+  }
+}
+
+} // namespace partee
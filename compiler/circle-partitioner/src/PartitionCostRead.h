@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_COST_READ_H__
+#define __CIRCLE_PARTITION_COST_READ_H__
+
+#include <luci/PartitionCost.h>
+
+#include <string>
+
+namespace partee
+{
+
+/**
+ * @brief Reads exec_time json file of onert profiling and add latency to PartitionCost
+ * @note  Permute records of the file set transfer latency, if it's not set yet
+ */
+void read_exec_time(const std::string &path, luci::PartitionCost &cost);
+
+/**
+ * @brief Reads latency of each op from a benchmark run and add it to PartitionCost
+ * @note  Each line of the file is 'OPNAME,latency', lines starting with '#' are ignored
+ */
+void read_op_latency(const std::string &path, luci::PartitionCost &cost);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_COST_READ_H__
@@ -77,6 +77,40 @@ void pms2config(const luci::PartedModules &pms, crew::PConfig &pconfig)
   }
 }
 
+std::vector<std::string> input_names(loco::Graph *graph)
+{
+  std::vector<std::string> names;
+  for (uint32_t i = 0; i < graph->inputs()->size(); ++i)
+    names.push_back(graph->inputs()->at(i)->name());
+  return names;
+}
+
+std::vector<std::string> output_names(loco::Graph *graph)
+{
+  std::vector<std::string> names;
+  for (uint32_t i = 0; i < graph->outputs()->size(); ++i)
+    names.push_back(graph->outputs()->at(i)->name());
+  return names;
+}
+
+// IODesc of nnpackage: "model:subgraph:io"
+std::string iodesc(uint32_t model, uint32_t io)
+{
+  return std::to_string(model) + ":0:" + std::to_string(io);
+}
+
+std::string quoted_list(const std::vector<std::string> &items)
+{
+  std::string result = "[ ";
+  for (uint32_t i = 0; i < items.size(); ++i)
+  {
+    if (i > 0)
+      result += ", ";
+    result += "\"" + items[i] + "\"";
+  }
+  return result + " ]";
+}
+
 } // namespace
 
 namespace partee
@@ -142,4 +176,121 @@ bool export_part_conn_ini(const std::string &output_base, const std::string &inp
   return true;
 }
 
+bool export_nnpkg_manifest(const std::string &output_base, const luci::Module *source,
+                           luci::PartedModules &pms)
+{
+  std::vector<std::vector<std::string>> inputs;
+  std::vector<std::vector<std::string>> outputs;
+  std::vector<std::string> models;
+  std::vector<std::string> model_types;
+  for (auto &pmodule : pms.pmodules)
+  {
+    inputs.push_back(input_names(pmodule.module->graph()));
+    outputs.push_back(output_names(pmodule.module->graph()));
+    models.push_back(pmodule.name);
+    model_types.push_back("circle");
+  }
+
+  // TODO is graph I/O using main graph is enough?
+  auto *graph = source->graph();
+
+  std::vector<std::string> pkg_inputs;
+  for (auto &name : input_names(graph))
+  {
+    std::vector<std::string> descs;
+    for (uint32_t m = 0; m < inputs.size(); ++m)
+    {
+      for (uint32_t i = 0; i < inputs[m].size(); ++i)
+      {
+        if (inputs[m][i] == name)
+          descs.push_back(iodesc(m, i));
+      }
+    }
+    if (descs.size() != 1)
+    {
+      std::cerr << "ERROR: Input '" << name << "' should be used in one model for nnpackage"
+                << std::endl;
+      return false;
+    }
+    pkg_inputs.push_back(descs.front());
+  }
+
+  std::vector<std::string> pkg_outputs;
+  for (auto &name : output_names(graph))
+  {
+    std::string desc;
+    for (uint32_t m = 0; m < outputs.size() && desc.empty(); ++m)
+    {
+      for (uint32_t o = 0; o < outputs[m].size() && desc.empty(); ++o)
+      {
+        if (outputs[m][o] == name)
+          desc = iodesc(m, o);
+      }
+    }
+    if (desc.empty())
+    {
+      std::cerr << "ERROR: Output '" << name << "' is not found in models" << std::endl;
+      return false;
+    }
+    pkg_outputs.push_back(desc);
+  }
+
+  // model-connect: output of a model to inputs of other models with the same name
+  std::vector<std::pair<std::string, std::vector<std::string>>> connects;
+  for (uint32_t m = 0; m < outputs.size(); ++m)
+  {
+    for (uint32_t o = 0; o < outputs[m].size(); ++o)
+    {
+      std::vector<std::string> tos;
+      for (uint32_t n = 0; n < inputs.size(); ++n)
+      {
+        for (uint32_t i = 0; n != m && i < inputs[n].size(); ++i)
+        {
+          if (inputs[n][i] == outputs[m][o])
+            tos.push_back(iodesc(n, i));
+        }
+      }
+      if (not tos.empty())
+        connects.emplace_back(iodesc(m, o), tos);
+    }
+  }
+
+  auto metadata = output_base + "/metadata";
+  if (not make_dir(metadata))
+  {
+    std::cerr << "ERROR: Failed to create folder: " << metadata << std::endl;
+    return false;
+  }
+
+  auto filepath = metadata + "/MANIFEST";
+  std::ofstream fs(filepath.c_str(), std::ofstream::binary | std::ofstream::trunc);
+  if (not fs.good())
+  {
+    std::cerr << "ERROR: Failed to create file: " << filepath;
+    return false;
+  }
+
+  fs << "{" << std::endl;
+  fs << "  \"major-version\" : \"1\"," << std::endl;
+  fs << "  \"minor-version\" : \"3\"," << std::endl;
+  fs << "  \"patch-version\" : \"0\"," << std::endl;
+  fs << "  \"configs\"       : [  ]," << std::endl;
+  fs << "  \"models\"        : " << quoted_list(models) << "," << std::endl;
+  fs << "  \"model-types\"   : " << quoted_list(model_types) << "," << std::endl;
+  fs << "  \"pkg-inputs\"    : " << quoted_list(pkg_inputs) << "," << std::endl;
+  fs << "  \"pkg-outputs\"   : " << quoted_list(pkg_outputs) << "," << std::endl;
+  fs << "  \"model-connect\" : [";
+  for (uint32_t c = 0; c < connects.size(); ++c)
+  {
+    fs << (c > 0 ? "," : "") << std::endl;
+    fs << "    { \"from\" : \"" << connects[c].first << "\", \"to\" : "
+       << quoted_list(connects[c].second) << " }";
+  }
+  fs << (connects.empty() ? " ]" : "\n  ]") << std::endl;
+  fs << "}" << std::endl;
+  fs.close();
+
+  return true;
+}
+
 } // namespace partee
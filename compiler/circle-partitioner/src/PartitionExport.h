@@ -36,6 +36,14 @@ bool export_part_conn_json(const std::string &output_base, const std::string &in
 bool export_part_conn_ini(const std::string &output_base, const std::string &input,
                           const luci::Module *source, luci::PartedModules &pms);
 
+/**
+ * @brief This will save nnpackage manifest of partitioned models to 'metadata/MANIFEST'
+ * @note  Returns false if an input of source model is used in two or more models, as
+ *        manifest can connect an input to only one model
+ */
+bool export_nnpkg_manifest(const std::string &output_base, const luci::Module *source,
+                           luci::PartedModules &pms);
+
 } // namespace partee
 
 #endif // __CIRCLE_PARTITION_EXPORT_H__
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FODER_FILE_MAPPER_H__
+#define __FODER_FILE_MAPPER_H__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace foder
+{
+
+/**
+ * @brief Read-only memory map of a file
+ * @note  Pages are read on access, and can be dropped by the kernel under memory pressure
+ *        as they are backed by the file. Mapping is kept until this object is destroyed,
+ *        even if the file is replaced by rename.
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string &path)
+  {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      std::string errmsg = "Failed to open file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    struct stat st;
+    void *addr = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+      _size = static_cast<size_t>(st.st_size);
+      addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // Mapping is kept after closing
+    ::close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+      std::string errmsg = "Failed to map file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+    _data = static_cast<const uint8_t *>(addr);
+  }
+
+  ~MappedFile() { ::munmap(const_cast<uint8_t *>(_data), _size); }
+
+public:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+  const uint8_t *data(void) const { return _data; }
+  size_t size(void) const { return _size; }
+
+private:
+  const uint8_t *_data = nullptr;
+  size_t _size = 0;
+};
+
+/**
+ * @brief Map file to share the mapping with users of its data
+ */
+class FileMapper
+{
+public:
+  explicit FileMapper(const std::string &path) : _path(path) {}
+
+public:
+  FileMapper(const FileMapper &) = delete;
+  FileMapper &operator=(const FileMapper &) = delete;
+
+public:
+  std::shared_ptr<const MappedFile> map(void) const { return std::make_shared<MappedFile>(_path); }
+
+private:
+  const std::string _path;
+};
+
+} // namespace foder
+
+#endif // __FODER_FILE_MAPPER_H__
@@ -22,6 +22,7 @@
 #include <loco.h>
 
 #include <memory>
+#include <vector>
 
 namespace luci
 {
@@ -44,6 +45,18 @@ public:
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Piece of export data
+    struct Chunk
+    {
+      const char *ptr;
+      size_t size;
+    };
+
+    // Exporter calls store_chunks for export data with extended buffers, so that buffers are
+    // not copied into one memory. Default implementation joins chunks and calls store.
+    // Notice: Please DO NOT STORE ptr of chunks when implementing this in Client
+    virtual bool store_chunks(const std::vector<Chunk> &chunks) const;
   };
 
 public:
@@ -22,9 +22,13 @@
 #include <luci/IR/Module.h>
 #include <oops/InternalExn.h>
 
+#include <sys/stat.h>
+
+#include <cstdio>
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 namespace luci
 {
@@ -48,10 +52,32 @@ public:
     if (!ptr)
       INTERNAL_EXN("Graph was not serialized by FlatBuffer for some reason");
 
-    std::ofstream fs(_filepath, std::ofstream::binary);
-    fs.write(ptr, size);
+    return store_chunks({{ptr, size}});
+  }
+
+  bool store_chunks(const std::vector<Chunk> &chunks) const final
+  {
+    // NOTE write to a temporary file and replace the file with it, not to overwrite the file
+    //      which may be memory mapped by constants of the module, when it is the source file.
+    //      This is only for regular file, e.g. not for /dev/stdout.
+    struct stat st;
+    const bool replace = ::stat(_filepath.c_str(), &st) != 0 || S_ISREG(st.st_mode);
+    const std::string path = replace ? _filepath + ".tmp" : _filepath;
+
+    std::ofstream fs(path, std::ofstream::binary);
+    for (const auto &chunk : chunks)
+      fs.write(chunk.ptr, chunk.size);
+    fs.close();
+
+    if (!replace)
+      return fs.good();
 
-    return fs.good();
+    if (!fs.good() || std::rename(path.c_str(), _filepath.c_str()) != 0)
+    {
+      std::remove(path.c_str());
+      return false;
+    }
+    return true;
   }
 
 private:
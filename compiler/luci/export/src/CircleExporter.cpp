@@ -22,6 +22,7 @@
 
 #include <fstream>
 #include <memory>
+#include <string>
 
 namespace luci
 {
@@ -31,6 +32,15 @@ CircleExporter::CircleExporter()
   // NOTHING TO DO
 }
 
+bool CircleExporter::Contract::store_chunks(const std::vector<Chunk> &chunks) const
+{
+  std::string data;
+  for (const auto &chunk : chunks)
+    data.append(chunk.ptr, chunk.size);
+
+  return store(data.data(), data.size());
+}
+
 bool CircleExporter::invoke(Contract *contract) const
 {
   auto module = contract->module();
@@ -38,6 +48,10 @@ bool CircleExporter::invoke(Contract *contract) const
   {
     CircleExporterImpl impl(module);
 
+    // buffers after flatbuffers area are sent as they are, without copying into one memory
+    if (impl.hasExtendedBuffer())
+      return contract->store_chunks(impl.getBufferChunks());
+
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
 
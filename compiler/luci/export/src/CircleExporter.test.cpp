@@ -17,6 +17,8 @@
 #include "luci/CircleExporter.h"
 
 #include <luci/Plan/CircleNodeExecutionPlan.h>
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/IR/Nodes/CircleInput.h>
 #include <luci/IR/Nodes/CircleOutput.h>
 #include <luci/IR/Nodes/CircleRelu.h>
@@ -84,6 +86,78 @@ private:
   std::unique_ptr<std::vector<char>> _buffer;
 };
 
+class ConstAddGraphContract : public luci::CircleExporter::Contract
+{
+public:
+  ConstAddGraphContract() : luci::CircleExporter::Contract()
+  {
+    auto g = loco::make_graph();
+    auto graph_input = g->inputs()->create();
+    auto graph_output = g->outputs()->create();
+    auto input_node = g->nodes()->create<luci::CircleInput>();
+    auto output_node = g->nodes()->create<luci::CircleOutput>();
+    auto add_node = g->nodes()->create<luci::CircleAdd>();
+    const_node = g->nodes()->create<luci::CircleConst>();
+
+    add_node->x(input_node);
+    add_node->y(const_node);
+    add_node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output_node->from(add_node);
+    input_node->index(graph_input->index());
+    output_node->index(graph_output->index());
+
+    input_node->name("input");
+    output_node->name("output");
+    add_node->name("add");
+    const_node->name("const");
+    for (luci::CircleNode *node : std::vector<luci::CircleNode *>{input_node, add_node, const_node})
+    {
+      node->dtype(loco::DataType::FLOAT32);
+      node->shape({4});
+      node->shape_status(luci::ShapeStatus::VALID);
+    }
+    output_node->dtype(loco::DataType::FLOAT32);
+
+    graph_input->shape({4});
+    graph_input->dtype(loco::DataType::FLOAT32);
+    graph_output->shape({4});
+    graph_output->dtype(loco::DataType::FLOAT32);
+
+    values = std::make_shared<std::vector<float>>(std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    const_node->view(values, reinterpret_cast<const uint8_t *>(values->data()),
+                     values->size() * sizeof(float));
+
+    _m = std::unique_ptr<luci::Module>{new luci::Module};
+    _m->add(std::move(g));
+    // export with extended buffers
+    _m->ext_buffer(true);
+  }
+
+  luci::Module *module(void) const override { return _m.get(); }
+
+public:
+  bool store(const char *, const size_t) const override { return false; }
+
+  bool store_chunks(const std::vector<Chunk> &chunks) const override
+  {
+    for (const auto &chunk : chunks)
+    {
+      data.append(chunk.ptr, chunk.size);
+      refers_const |= chunk.ptr == reinterpret_cast<const char *>(values->data());
+    }
+    return true;
+  }
+
+public:
+  luci::CircleConst *const_node;
+  std::shared_ptr<std::vector<float>> values;
+  mutable std::string data;
+  mutable bool refers_const = false;
+
+private:
+  std::unique_ptr<luci::Module> _m;
+};
+
 TEST(CircleExport, export_execution_plan)
 {
   SampleGraphContract contract;
@@ -138,3 +212,33 @@ TEST(CircleExport, export_execution_plan_nosetting_NEG)
   ASSERT_NE(model.get(), nullptr);
   ASSERT_EQ(model->metadata.size(), 0);
 }
+
+TEST(CircleExport, export_ext_buffer_chunks)
+{
+  ConstAddGraphContract contract;
+
+  luci::UserSettings::settings()->set(luci::UserSettings::ExecutionPlanGen, false);
+  luci::CircleExporter exporter;
+
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  // buffer is stored from data of constant without copy
+  ASSERT_TRUE(contract.refers_const);
+  ASSERT_TRUE(contract.const_node->viewed());
+
+  auto model = circle::GetModel(contract.data.data());
+  ASSERT_NE(model, nullptr);
+  bool found = false;
+  for (auto buffer : *model->buffers())
+  {
+    if (buffer->offset() <= 1)
+      continue;
+
+    ASSERT_EQ(0, buffer->offset() % 16);
+    ASSERT_EQ(4 * sizeof(float), buffer->size());
+    auto data = reinterpret_cast<const float *>(contract.data.data() + buffer->offset());
+    ASSERT_EQ(3.0f, data[2]);
+    found = true;
+  }
+  ASSERT_TRUE(found);
+}
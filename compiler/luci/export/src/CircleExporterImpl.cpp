@@ -254,64 +254,51 @@ void CircleExporterImpl::finalizeWithExtendedBuffer(SerializedModelData &md)
     return;
 
   _fb_data_with_ext.clear();
+  _ext_chunks.clear();
 
-  auto align16 = [](size_t &v) {
-    while (v % 16 != 0)
-      v++;
-  };
+  // zeros for padding
+  static const char zeros[16] = {0};
 
-  // get total memory for flatbuffer + all buffer_data
-  size_t result_size = _builder.GetSize();
-  align16(result_size);
-  for (auto &it : md._buffer_data_map)
-  {
-    SerializedModelData::BufferData &buffer_data = it.second;
-    result_size += buffer_data.size();
-    align16(result_size);
-  }
-  align16(result_size);
-  result_size += 16; // for safety
+  auto padsize16 = [](size_t v) { return (16 - v % 16) % 16; };
 
-  std::string result;
+  // flatbuffer area is copied to update offsets of buffers, which are small
   const char *buff_ptr = reinterpret_cast<const char *>(_builder.GetBufferPointer());
+  _fb_data_with_ext.append(buff_ptr, _builder.GetSize());
+  // pad to be 16 bytes aligned
+  _fb_data_with_ext.append(padsize16(_fb_data_with_ext.size()), '\0');
 
-  auto padalign16 = [](std::string &str) {
-    while (str.size() % 16 != 0)
-      str += '\0';
-  };
-
-  result.reserve(result_size);
-  result.append(buff_ptr, _builder.GetSize());
-
-  auto mutable_model = circle::GetMutableModel(result.data());
+  auto mutable_model = circle::GetMutableModel(&_fb_data_with_ext[0]);
   auto mutable_buffers = mutable_model->mutable_buffers();
 
-  // pad to be 16 bytes aligned
-  padalign16(result);
+  // buffer data are not copied but referred by chunks, to be stored as they are
+  _ext_chunks.push_back({_fb_data_with_ext.data(), _fb_data_with_ext.size()});
+  uint64_t offset = _fb_data_with_ext.size();
   for (auto &it : md._buffer_data_map)
   {
     int32_t buffer_index = it.first;
     SerializedModelData::BufferData &buffer_data = it.second;
-    uint64_t offset = result.size();
-    uint64_t size = buffer_data.size();
+    uint64_t size = buffer_data.size;
 
     circle::Buffer *mutable_buffer = mutable_buffers->GetMutableObject(buffer_index);
     mutable_buffer->mutate_offset(offset);
     mutable_buffer->mutate_size(size);
 
-    result.append(buffer_data.begin(), buffer_data.end());
-    padalign16(result);
-  }
-  padalign16(result);
+    _ext_chunks.push_back({reinterpret_cast<const char *>(buffer_data.data), size});
+    offset += size;
 
-  // use final result
-  _fb_data_with_ext = result;
+    const auto padsize = padsize16(offset);
+    if (padsize > 0)
+    {
+      _ext_chunks.push_back({zeros, padsize});
+      offset += padsize;
+    }
+  }
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
 {
   if (_ext_buffer)
-    return reinterpret_cast<const char *>(_fb_data_with_ext.data());
+    return _fb_data_with_ext.data();
   return reinterpret_cast<const char *>(_builder.GetBufferPointer());
 }
 
@@ -26,6 +26,8 @@
 
 #include <loco.h>
 
+#include <vector>
+
 namespace luci
 {
 
@@ -42,6 +44,7 @@ public:
 
   /**
    * @return pointer to buffer with serialized graph
+   * @note   this is without extended buffers, use getBufferChunks() for them
    */
   const char *getBufferPointer() const;
 
@@ -50,6 +53,20 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @return true if serialized graph has extended buffers after flatbuffers area
+   */
+  bool hasExtendedBuffer() const { return _ext_buffer; }
+
+  /**
+   * @return chunks of serialized graph with extended buffers
+   * @note   chunks refer data of CircleConst nodes, which should be kept unchanged
+   */
+  const std::vector<CircleExporter::Contract::Chunk> &getBufferChunks() const
+  {
+    return _ext_chunks;
+  }
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -78,6 +95,7 @@ private:
   flatbuffers::FlatBufferBuilder _builder;
   bool _ext_buffer = false;
   std::string _fb_data_with_ext;
+  std::vector<CircleExporter::Contract::Chunk> _ext_chunks;
 };
 
 } // namespace luci
@@ -352,21 +352,18 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
+  // NOTE data is read as it is, not to copy data that may be a view of source file
   const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    raw_data.push_back(c->at<DT>(i));
-  }
   const size_t raw_size = size * sizeof(NativeType);
+  const uint8_t *raw_data = c->raw_data();
+  assert(c->raw_size() == raw_size);
 
   if (md._ext_buffer)
   {
-    // TODO optimize this if this operation takes long or much memory
+    // Refer data of node, to be stored after flatbuffers area as it is
     SerializedModelData::BufferData buffer_data;
-    buffer_data.resize(raw_size);
-    std::memcpy(buffer_data.data(), raw_data.data(), raw_size);
+    buffer_data.data = raw_data;
+    buffer_data.size = raw_size;
 
     int32_t buffer_index = md._buffers.size();
     md._buffer_data_map.emplace(buffer_index, buffer_data);
@@ -380,7 +377,7 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
     return md._empty_buffer;
   }
 
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
@@ -551,7 +548,8 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
@@ -563,7 +561,7 @@ template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci
   return true;
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -575,6 +573,11 @@ bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
     if (!(lhs->dim(i) == rhs->dim(i)))
       return false;
 
+  // Views of same data, e.g. clones of a constant from source file
+  if (lhs->viewed() && rhs->viewed() && lhs->raw_data() == rhs->raw_data() &&
+      lhs->raw_size() == rhs->raw_size())
+    return true;
+
   switch (lhs->dtype())
   {
     case loco::DataType::FLOAT32:
@@ -122,12 +122,17 @@ public:
   // to access raw file data for Buffer outside of flatbuffer range
   const uint8_t *file_data(uint64_t offset) const;
   size_t file_size(void) const { return _file_size; }
+  // owner of file data, to let constants refer file data instead of copying it.
+  // nullptr if file data is not kept alive after import.
+  const std::shared_ptr<const void> &file_owner(void) const { return _file_owner; }
+  void file_owner(const std::shared_ptr<const void> &owner) { _file_owner = owner; }
 
 private:
   const circle::Model *_model{nullptr};
   const circle::SubGraph *_current_subgraph{nullptr};
   const uint8_t *_file_data{nullptr};
   size_t _file_size{0};
+  std::shared_ptr<const void> _file_owner;
 };
 
 } // namespace luci
@@ -46,11 +46,18 @@ private:
 
 public:
   std::unique_ptr<Module> importModule(const uint8_t *data, size_t size);
+  /**
+   * @brief Import with constants that refer to @p data instead of copying it
+   * @note  @p owner should keep @p data alive and unchanged while constants refer to it
+   */
+  std::unique_ptr<Module> importModule(std::shared_ptr<const void> owner, const uint8_t *data,
+                                       size_t size);
 
 private:
   const GraphBuilderSource *_source = nullptr;
   const uint8_t *_file_data = nullptr;
   size_t _file_size = 0;
+  std::shared_ptr<const void> _file_owner;
 };
 
 } // namespace luci
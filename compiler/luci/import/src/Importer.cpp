@@ -285,6 +285,7 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   CircleReader reader;
   if (!reader.parse(model, _file_data, _file_size))
     return nullptr;
+  reader.file_owner(_file_owner);
 
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
   {
@@ -386,4 +387,14 @@ std::unique_ptr<Module> Importer::importModule(const uint8_t *data, size_t size)
   return importModule(circle_model);
 }
 
+std::unique_ptr<Module> Importer::importModule(std::shared_ptr<const void> owner,
+                                               const uint8_t *data, size_t size)
+{
+  _file_owner = std::move(owner);
+  auto module = importModule(data, size);
+  _file_owner.reset();
+
+  return module;
+}
+
 } // namespace luci
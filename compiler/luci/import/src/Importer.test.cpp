@@ -17,12 +17,15 @@
 #include "luci/Importer.h"
 
 #include <luci/IR/CircleNode.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/Plan/CircleNodeExecutionPlan.h>
 
 #include <gtest/gtest.h>
 #include <mio/circle/schema_generated.h>
 #include <flatbuffers/flatbuffers.h>
 
+#include <cstring>
+
 TEST(CircleImport, Dummy)
 {
   luci::Importer import;
@@ -174,8 +177,98 @@ struct SimpleRELUModel : public BasicCircleModel
   }
 };
 
+struct SimpleConstAddModel : public BasicCircleModel
+{
+  SimpleConstAddModel()
+  {
+    auto add_opcode_id = add_builtin_opcode(circle::BuiltinOperator_ADD);
+
+    uint32_t subgraph_id = add_subgraph();
+
+    auto input_buffer_id = add_buffer();
+    auto const_buffer_id = add_buffer();
+    auto output_buffer_id = add_buffer();
+
+    std::vector<float> values{1.0f, 2.0f, 3.0f, 4.0f};
+    auto &const_data = model->buffers[const_buffer_id]->data;
+    const_data.resize(values.size() * sizeof(float));
+    std::memcpy(const_data.data(), values.data(), const_data.size());
+
+    auto input_tensor_idx = add_float_tensor(subgraph_id, {1, 4}, input_buffer_id);
+    auto const_tensor_idx = add_float_tensor(subgraph_id, {1, 4}, const_buffer_id);
+    auto output_tensor_idx = add_float_tensor(subgraph_id, {1, 4}, output_buffer_id);
+
+    add_subgraph_inputs(subgraph_id, {input_tensor_idx});
+    add_subgraph_outputs(subgraph_id, {output_tensor_idx});
+
+    auto add_idx = add_builtin_operator(subgraph_id, add_opcode_id,
+                                        {input_tensor_idx, const_tensor_idx}, {output_tensor_idx});
+    model->subgraphs[subgraph_id]->operators[add_idx]->builtin_options.Set(circle::AddOptionsT());
+  }
+};
+
+luci::CircleConst *find_const(loco::Graph *g)
+{
+  for (uint32_t i = 0; i < g->nodes()->size(); ++i)
+  {
+    if (auto const_node = dynamic_cast<luci::CircleConst *>(g->nodes()->at(i)))
+      return const_node;
+  }
+  return nullptr;
+}
+
 } // namespace
 
+/**
+ * This test checks that constant refers to file data when owner of file data is given
+ */
+TEST(CircleImport, const_view)
+{
+  SimpleConstAddModel model;
+
+  flatbuffers::FlatBufferBuilder fbb;
+  auto model_offset = circle::Model::Pack(fbb, model.model.get(), nullptr);
+  circle::FinishModelBuffer(fbb, model_offset);
+
+  auto file = std::make_shared<std::vector<uint8_t>>(
+    fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+
+  luci::Importer import;
+  auto luci_module = import.importModule(file, file->data(), file->size());
+  ASSERT_NE(nullptr, luci_module);
+
+  auto const_node = find_const(luci_module->graph());
+  ASSERT_NE(nullptr, const_node);
+  ASSERT_TRUE(const_node->viewed());
+  ASSERT_GE(const_node->raw_data(), file->data());
+  ASSERT_LT(const_node->raw_data(), file->data() + file->size());
+  ASSERT_EQ(4, const_node->size<loco::DataType::FLOAT32>());
+  ASSERT_EQ(3.0f, const_node->at<loco::DataType::FLOAT32>(2));
+
+  // module keeps file data
+  file.reset();
+  const luci::CircleConst *cconst_node = const_node;
+  ASSERT_EQ(4.0f, cconst_node->at<loco::DataType::FLOAT32>(3));
+}
+
+TEST(CircleImport, const_view_no_owner_NEG)
+{
+  SimpleConstAddModel model;
+
+  flatbuffers::FlatBufferBuilder fbb;
+  auto model_offset = circle::Model::Pack(fbb, model.model.get(), nullptr);
+  circle::FinishModelBuffer(fbb, model_offset);
+
+  luci::Importer import;
+  auto luci_module = import.importModule(fbb.GetBufferPointer(), fbb.GetSize());
+  ASSERT_NE(nullptr, luci_module);
+
+  auto const_node = find_const(luci_module->graph());
+  ASSERT_NE(nullptr, const_node);
+  ASSERT_FALSE(const_node->viewed());
+  ASSERT_EQ(3.0f, const_node->at<loco::DataType::FLOAT32>(2));
+}
+
 /**
  * This test checks that one op RELU model with execution plan is successfully imported
  */
@@ -17,7 +17,7 @@
 #include "luci/Importer.h"
 #include "luci/ImporterEx.h"
 
-#include <foder/FileLoader.h>
+#include <foder/FileMapper.h>
 
 #include <memory>
 #include <iostream>
@@ -27,12 +27,14 @@ namespace luci
 
 std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_path) const
 {
-  foder::FileLoader file_loader{input_path};
-  std::vector<char> model_data;
+  // NOTE file is mapped instead of loaded, so that constants can refer to file data
+  //      without copying it. Mapping is released with the last constant that refers to it.
+  foder::FileMapper file_mapper{input_path};
+  std::shared_ptr<const foder::MappedFile> model_file;
 
   try
   {
-    model_data = file_loader.load();
+    model_file = file_mapper.map();
   }
   catch (const std::runtime_error &err)
   {
@@ -40,8 +42,8 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
     return nullptr;
   }
 
-  auto data_data = reinterpret_cast<uint8_t *>(model_data.data());
-  auto data_size = model_data.size();
+  auto data_data = model_file->data();
+  auto data_size = model_file->size();
 
   flatbuffers::Verifier verifier{data_data, data_size};
   if (!circle::VerifyModelBuffer(verifier))
@@ -51,7 +53,7 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
   }
 
   Importer importer(_source);
-  return importer.importModule(data_data, data_size);
+  return importer.importModule(model_file, data_data, data_size);
 }
 
 std::unique_ptr<Module> ImporterEx::importModule(std::vector<char> &model_data) const
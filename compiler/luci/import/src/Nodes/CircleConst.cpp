@@ -25,6 +25,7 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -139,6 +140,29 @@ void copy_data_4(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
   }
 }
 
+// Return true if data of dtype can be referred from file as it is
+bool viewable(loco::DataType dtype, const uint8_t *data)
+{
+  switch (dtype)
+  {
+    case loco::DataType::FLOAT32:
+    case loco::DataType::FLOAT16:
+    case loco::DataType::U8:
+    case loco::DataType::S8:
+    case loco::DataType::S16:
+    case loco::DataType::S32:
+    case loco::DataType::S64:
+    case loco::DataType::BOOL:
+      // data should be aligned to be accessed as elements
+      return reinterpret_cast<uintptr_t>(data) % loco::size(dtype) == 0;
+
+    default:
+      // S4, U4 are unpacked and STRING is de-serialized
+      break;
+  }
+  return false;
+}
+
 } // namespace
 
 namespace luci
@@ -170,6 +194,11 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     // NOTE this shouldn't happen
     throw std::runtime_error("CircleConst: Circle file with invalid extended Buffer.");
   }
+  // owner of file data, to refer file data from constant instead of copying it
+  const auto &file_owner = reader->file_owner();
+  // data in file for constant to refer, nullptr if data is copied with 'buffer'
+  const uint8_t *view_data = nullptr;
+  size_t view_size = 0;
   // temporary buffer to provide raw data from file
   // must have life time same or longer than 'buffer' variable
   std::vector<uint8_t> temp_buffer;
@@ -182,10 +211,6 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
       throw std::runtime_error("CircleConst: Circle file with invalid extended Buffer.");
     }
     uint32_t r_size = static_cast<uint32_t>(r_buffer->size());
-    // match binary level to flatbuffers::Vector
-    temp_buffer.resize(r_size + sizeof(uint32_t));
-
-    uint8_t *t_data = temp_buffer.data();
     const uint8_t *f_data = reader->file_data(r_buffer->offset());
     if (f_data == nullptr)
     {
@@ -193,28 +218,48 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
       assert(false);
       return nullptr;
     }
-    memcpy(t_data, &r_size, sizeof(r_size));
-    t_data = t_data + sizeof(r_size);
     if (r_buffer->offset() + r_buffer->size() > reader->file_size())
     {
       // NOTE this shouldn't happen
       assert(false);
       return nullptr;
     }
-    memcpy(t_data, f_data, r_buffer->size());
 
-    using fbv_t = flatbuffers::Vector<uint8_t>;
-    const fbv_t *v_data = reinterpret_cast<const fbv_t *>(temp_buffer.data());
-    buffer = wrap(v_data);
+    if (file_owner != nullptr && viewable(luci_datatype(const_tensor->type()), f_data))
+    {
+      view_data = f_data;
+      view_size = r_size;
+    }
+    else
+    {
+      // match binary level to flatbuffers::Vector
+      temp_buffer.resize(r_size + sizeof(uint32_t));
+
+      uint8_t *t_data = temp_buffer.data();
+      memcpy(t_data, &r_size, sizeof(r_size));
+      t_data = t_data + sizeof(r_size);
+      memcpy(t_data, f_data, r_buffer->size());
+
+      using fbv_t = flatbuffers::Vector<uint8_t>;
+      const fbv_t *v_data = reinterpret_cast<const fbv_t *>(temp_buffer.data());
+      buffer = wrap(v_data);
+    }
 
     context->ext_buffer(true);
   }
   else
   {
     buffer = wrap(r_buffer->data());
+    if (file_owner != nullptr && not buffer.empty() &&
+        viewable(luci_datatype(const_tensor->type()), buffer.data()))
+    {
+      view_data = buffer.data();
+      view_size = buffer.size();
+    }
   }
+  const bool empty_data = view_data == nullptr && buffer.empty();
   const auto const_dims = wrap(const_tensor->shape()); // in NHWC
-  if (const_dims.size() == 0 && buffer.empty())
+  if (const_dims.size() == 0 && empty_data)
   {
     // unknown shape tensor and scalar tensor
     return nullptr;
@@ -234,7 +279,7 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     num_elements = num_elements * const_dims[r];
   }
 
-  if (buffer.empty() && num_elements > 0)
+  if (empty_data && num_elements > 0)
   {
     // normal empty tensor
     return nullptr;
@@ -245,7 +290,14 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
   const_node->shape_status(luci::ShapeStatus::VALID);
   INFO(l) << "[luci] NodeFinder const_node(" << tensor_index << ") -> " << const_node << " "
           << const_dims << std::endl;
-  if (num_elements > 0)
+  if (num_elements > 0 && view_data != nullptr)
+  {
+    // TODO calculate the exact buffer size of sparse tensor
+    assert(const_node->sparsityparam() ||
+           view_size == num_elements * loco::size(const_node->dtype()));
+    const_node->view(file_owner, view_data, view_size);
+  }
+  else if (num_elements > 0)
   {
     switch (luci_datatype(const_tensor->type()))
     {
@@ -24,12 +24,17 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+
 namespace luci
 {
 
 /**
  * @brief Class to build tensor data
  * @note  This will not be exported as a specific op
+ * @note  Data can be a view of memory owned by others, e.g. memory mapped model file.
+ *        View is copied to owned data when it may be changed, that is, with non-const
+ *        at(), scalar() or size(uint32_t).
  */
 class CircleConst final : public FixedArityNode<0, CircleNodeImpl<CircleOpcode::CIRCLECONST>>
 {
@@ -42,8 +47,28 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Refer @p size bytes at @p data instead of owning a copy of them
+   * @note  @p owner should keep @p data alive and unchanged. @p data should be aligned to
+   *        size of element type. This is not for STRING type.
+   */
+  void view(std::shared_ptr<const void> owner, const uint8_t *data, size_t size);
+  bool viewed(void) const { return _view != nullptr; }
+  const std::shared_ptr<const void> &view_owner(void) const { return _view_owner; }
+
+  // Bytes of data, either of view or owned. This is not for STRING type.
+  const uint8_t *raw_data(void) const { return viewed() ? _view : _data.data(); }
+  size_t raw_size(void) const { return viewed() ? _view_size : _data.size(); }
+
+private:
+  void materialize(void);
+
 private:
   std::vector<uint8_t> _data;
+  std::shared_ptr<const void> _view_owner;
+  const uint8_t *_view = nullptr;
+  size_t _view_size = 0;
   // TODO use _data for STRING and remove _strings
   std::vector<std::string> _strings; // for STRING type
 };
@@ -21,16 +21,40 @@
 namespace luci
 {
 
+void CircleConst::view(std::shared_ptr<const void> owner, const uint8_t *data, size_t size)
+{
+  assert(dtype() != loco::DataType::STRING);
+  assert(data != nullptr);
+
+  _data.clear();
+  _data.shrink_to_fit();
+  _view_owner = std::move(owner);
+  _view = data;
+  _view_size = size;
+}
+
+void CircleConst::materialize(void)
+{
+  if (not viewed())
+    return;
+
+  _data.assign(_view, _view + _view_size);
+  _view_owner.reset();
+  _view = nullptr;
+  _view_size = 0;
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(raw_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return raw_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  materialize();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +63,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(raw_data()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,12 +78,13 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(raw_data()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
@@ -88,14 +114,14 @@ INSTANTIATE(loco::DataType::FLOAT16);
 template <> uint32_t CircleConst::size<loco::DataType::STRING>(void) const
 {
   assert(dtype() == loco::DataType::STRING);
-  assert(_data.size() == 0);
+  assert(_data.size() == 0 && not viewed());
   return _strings.size();
 }
 
 template <> void CircleConst::size<loco::DataType::STRING>(uint32_t l)
 {
   assert(dtype() == loco::DataType::STRING);
-  assert(_data.size() == 0);
+  assert(_data.size() == 0 && not viewed());
   _strings.resize(l);
 }
 
@@ -64,3 +64,56 @@ TEST(CircleConstTest, string)
   ASSERT_EQ(1, const_node.size<loco::DataType::STRING>());
   EXPECT_TRUE(std::string("Hello") == const_node.at<loco::DataType::STRING>(0));
 }
+
+TEST(CircleConstTest, view)
+{
+  auto owner = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.view(owner, data, 3 * sizeof(int32_t));
+
+  const auto &cnode = const_node;
+  ASSERT_TRUE(cnode.viewed());
+  ASSERT_EQ(3, cnode.size<loco::DataType::S32>());
+  ASSERT_EQ(2, cnode.at<loco::DataType::S32>(1));
+  ASSERT_EQ(data, cnode.raw_data());
+  ASSERT_EQ(owner, cnode.view_owner());
+}
+
+TEST(CircleConstTest, view_materialize)
+{
+  auto owner = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.view(owner, data, 3 * sizeof(int32_t));
+
+  // Change should not be seen by owner
+  const_node.at<loco::DataType::S32>(1) = 5;
+
+  ASSERT_FALSE(const_node.viewed());
+  ASSERT_EQ(3, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(1, const_node.at<loco::DataType::S32>(0));
+  ASSERT_EQ(5, const_node.at<loco::DataType::S32>(1));
+  ASSERT_EQ(2, owner->at(1));
+  ASSERT_EQ(nullptr, const_node.view_owner());
+}
+
+TEST(CircleConstTest, view_resize_NEG)
+{
+  auto owner = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.view(owner, data, 3 * sizeof(int32_t));
+
+  const_node.size<loco::DataType::S32>(2);
+
+  ASSERT_FALSE(const_node.viewed());
+  ASSERT_EQ(2, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(2, const_node.at<loco::DataType::S32>(1));
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PARTITION_COST_H__
+#define __LUCI_PARTITION_COST_H__
+
+#include "luci/Partition.h"
+
+#include <luci/IR/Module.h>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief PartitionCost holds measured latency of nodes to partition a model by cost
+ * @note  Latency can be in any unit, such as microseconds, but all items should use the same one
+ */
+struct PartitionCost
+{
+  // latency by opcode name and bytes of inputs and outputs: group -> OPCODENAME -> bytes -> latency
+  // NOTE OPCODENAME is compared in upper case without '_', so that both 'CONV_2D' of circle
+  //      and 'Conv2D' of onert match
+  std::unordered_map<std::string, std::unordered_map<std::string, std::map<uint32_t, double>>>
+    byopcodes;
+
+  // latency by op name in any group, which precedes byopcodes: OPNAME=latency
+  std::unordered_map<std::string /* OPNAME */, double> byopnames;
+
+  // latency to pass one byte of a tensor from a stage to another
+  double transfer = 0.0;
+};
+
+/**
+ * @brief Produce PartitionTable that splits nodes of main graph into pipeline stages
+ *        minimizing the largest stage cost
+ * @note  Nodes are split into contiguous ranges of a topological order, where 'stages[k]' is
+ *        the group of k-th range. Stage cost is latency of its nodes and latency to receive
+ *        tensors from previous stages. Latency of a node that is not in 'cost' is estimated
+ *        from its bytes with average latency per byte of measured nodes.
+ *        Nodes are assigned by OPNAME, so that op names should be unique.
+ *        A backend can run several stages, e.g. 'cpu,npu,cpu', where its stages are given
+ *        numbered groups such as 'cpu_0' and 'cpu_1' so that they are not merged.
+ */
+PartitionTable partition_by_cost(const Module *module, const std::vector<std::string> &stages,
+                                 const PartitionCost &cost);
+
+} // namespace luci
+
+#endif // __LUCI_PARTITION_COST_H__
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CircleOpCode.h"
+
+#include "luci/PartitionCost.h"
+#include "luci/Log.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/IR/DataTypeHelper.h>
+
+#include <loco.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+
+class IsOpNode final : public luci::CircleNodeVisitor<bool>
+{
+public:
+#define CIRCLE_NODE(OPCODE, CIRCLE_CLASS) \
+  bool visit(const luci::CIRCLE_CLASS *) final { return true; }
+#define CIRCLE_VNODE(OPCODE, CIRCLE_CLASS) \
+  bool visit(const luci::CIRCLE_CLASS *) final { return false; }
+
+#include "luci/IR/CircleNodes.lst"
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+};
+
+bool is_op(const luci::CircleNode *node)
+{
+  IsOpNode query;
+  return node->accept(&query);
+}
+
+/**
+ * @brief Return op node that produces the tensor of node, nullptr for inputs and constants
+ */
+const luci::CircleNode *producer(const luci::CircleNode *node)
+{
+  while (not is_op(node))
+  {
+    // NOTE Only virtual output nodes of multiple output ops have an input
+    if (node->arity() == 0)
+      return nullptr;
+    node = loco::must_cast<const luci::CircleNode *>(node->arg(0));
+  }
+  return node;
+}
+
+uint64_t tensor_bytes(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return 0;
+  if (node->dtype() == loco::DataType::Unknown)
+    return 0;
+
+  uint64_t elements = 1;
+  for (uint32_t r = 0; r < node->rank(); ++r)
+  {
+    if (not node->dim(r).known())
+      return 0;
+    elements *= node->dim(r).value();
+  }
+  return elements * luci::size(node->dtype());
+}
+
+// Bytes of inputs and outputs, same as size of onert ExecTime
+uint64_t node_bytes(const luci::CircleNode *node)
+{
+  uint64_t bytes = tensor_bytes(node);
+  for (uint32_t i = 0; i < node->arity(); ++i)
+    bytes += tensor_bytes(loco::must_cast<const luci::CircleNode *>(node->arg(i)));
+  return bytes;
+}
+
+std::string opcode_key(const std::string &opcode)
+{
+  std::string key;
+  for (auto c : opcode)
+  {
+    if (c != '_')
+      key.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+  }
+  return key;
+}
+
+/**
+ * @brief Return latency of given bytes with linear interpolation of samples
+ */
+double interpolate(const std::map<uint32_t, double> &samples, uint64_t bytes)
+{
+  assert(not samples.empty());
+
+  auto upper = samples.lower_bound(static_cast<uint32_t>(
+    std::min<uint64_t>(bytes, std::numeric_limits<uint32_t>::max())));
+  if (upper == samples.end())
+  {
+    // Larger than all samples: scale the largest one
+    auto last = std::prev(samples.end());
+    return last->first == 0 ? last->second : last->second * bytes / last->first;
+  }
+  if (upper->first == bytes)
+    return upper->second;
+  if (upper == samples.begin())
+  {
+    // Smaller than all samples: scale the smallest one
+    return upper->second * bytes / upper->first;
+  }
+
+  auto lower = std::prev(upper);
+  auto ratio = static_cast<double>(bytes - lower->first) / (upper->first - lower->first);
+  return lower->second + (upper->second - lower->second) * ratio;
+}
+
+class CostTable
+{
+public:
+  CostTable(const luci::PartitionCost &cost, const std::vector<const luci::CircleNode *> &ops)
+    : _cost(cost), _ops(ops)
+  {
+    for (auto &bygroup : cost.byopcodes)
+    {
+      auto &samples = _samples[bygroup.first];
+      for (auto &item : bygroup.second)
+      {
+        if (not item.second.empty())
+          samples[opcode_key(item.first)] = &item.second;
+      }
+    }
+
+    _bytes.reserve(ops.size());
+    _keys.reserve(ops.size());
+    for (auto op : ops)
+    {
+      _bytes.push_back(node_bytes(op));
+      _keys.push_back(opcode_key(luci::opcode_name(op)));
+    }
+
+    // Latency per byte of all measured nodes, for groups without measurement
+    double latency = 0.0;
+    uint64_t bytes = 0;
+    for (auto &item : _samples)
+      accumulate(item.first, latency, bytes);
+    if (_samples.empty())
+      accumulate("", latency, bytes);
+    _default_rate = (bytes == 0) ? 1.0 : latency / bytes;
+  }
+
+public:
+  /**
+   * @brief Return latency of each op in group
+   */
+  std::vector<double> latencies(const std::string &group) const
+  {
+    double latency = 0.0;
+    uint64_t bytes = 0;
+    accumulate(group, latency, bytes);
+    const double rate = (bytes == 0) ? _default_rate : latency / bytes;
+
+    std::vector<double> result(_ops.size());
+    for (uint32_t p = 0; p < _ops.size(); ++p)
+    {
+      if (not measured(group, p, result[p]))
+        result[p] = rate * _bytes[p];
+    }
+    return result;
+  }
+
+private:
+  bool measured(const std::string &group, uint32_t p, double &latency) const
+  {
+    auto byname = _cost.byopnames.find(_ops[p]->name());
+    if (byname != _cost.byopnames.end())
+    {
+      latency = byname->second;
+      return true;
+    }
+
+    auto bygroup = _samples.find(group);
+    if (bygroup == _samples.end())
+      return false;
+    auto samples = bygroup->second.find(_keys[p]);
+    if (samples == bygroup->second.end())
+      return false;
+    latency = interpolate(*samples->second, _bytes[p]);
+    return true;
+  }
+
+  void accumulate(const std::string &group, double &latency, uint64_t &bytes) const
+  {
+    for (uint32_t p = 0; p < _ops.size(); ++p)
+    {
+      double value = 0.0;
+      if (measured(group, p, value))
+      {
+        latency += value;
+        bytes += _bytes[p];
+      }
+    }
+  }
+
+private:
+  const luci::PartitionCost &_cost;
+  const std::vector<const luci::CircleNode *> &_ops;
+  // samples by group and normalized opcode key
+  std::unordered_map<std::string,
+                     std::unordered_map<std::string, const std::map<uint32_t, double> *>>
+    _samples;
+  std::vector<uint64_t> _bytes;
+  std::vector<std::string> _keys;
+  double _default_rate = 1.0;
+};
+
+/**
+ * @brief Tensor that an op receives from an earlier op
+ */
+struct InTensor
+{
+  uint32_t producer; // position of producer op in order
+  uint32_t tensor;   // index of tensor
+};
+
+/**
+ * @brief Return group name of each stage, numbered if the backend runs several stages,
+ *        e.g. 'cpu,npu,cpu' gives 'cpu_0,npu,cpu_1', so that stages are not merged
+ */
+std::vector<std::string> stage_groups(const std::vector<std::string> &stages)
+{
+  std::map<std::string, uint32_t> counts;
+  for (auto &stage : stages)
+    counts[stage]++;
+
+  std::map<std::string, uint32_t> numbers;
+  std::vector<std::string> groups;
+  std::unordered_set<std::string> unique;
+  for (auto &stage : stages)
+  {
+    if (counts[stage] == 1)
+      groups.push_back(stage);
+    else
+      groups.push_back(stage + "_" + std::to_string(numbers[stage]++));
+
+    if (not unique.insert(groups.back()).second)
+      throw std::invalid_argument("partition_by_cost: group name '" + groups.back() +
+                                  "' of stages is not unique");
+  }
+  return groups;
+}
+
+} // namespace
+
+namespace luci
+{
+
+PartitionTable partition_by_cost(const Module *module, const std::vector<std::string> &stages,
+                                 const PartitionCost &cost)
+{
+  assert(module != nullptr);
+
+  LOGGER(l);
+
+  if (stages.empty())
+    throw std::invalid_argument("partition_by_cost: stages should not be empty");
+  const auto groups = stage_groups(stages);
+
+  // NOTE Only main graph (subgraph index 0) will be partitioned, as produce_pgroups
+  auto graph = module->graph();
+
+  std::vector<const CircleNode *> ops;
+  std::unordered_map<const CircleNode *, uint32_t> positions;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto cnode = loco::must_cast<const CircleNode *>(node);
+    if (not is_op(cnode))
+      continue;
+    positions[cnode] = static_cast<uint32_t>(ops.size());
+    ops.push_back(cnode);
+  }
+  const uint32_t num_ops = static_cast<uint32_t>(ops.size());
+  const uint32_t num_stages = static_cast<uint32_t>(stages.size());
+
+  // Tensors received by each op from other ops
+  std::vector<std::vector<InTensor>> in_tensors(num_ops);
+  std::vector<uint64_t> tensor_sizes;
+  {
+    std::unordered_map<const CircleNode *, uint32_t> tensors;
+    for (uint32_t p = 0; p < num_ops; ++p)
+    {
+      for (uint32_t i = 0; i < ops[p]->arity(); ++i)
+      {
+        auto arg = loco::must_cast<const CircleNode *>(ops[p]->arg(i));
+        auto prod = producer(arg);
+        if (prod == nullptr)
+          continue;
+
+        auto it = tensors.find(arg);
+        if (it == tensors.end())
+        {
+          it = tensors.emplace(arg, static_cast<uint32_t>(tensor_sizes.size())).first;
+          tensor_sizes.push_back(tensor_bytes(arg));
+        }
+        in_tensors[p].push_back(InTensor{positions.at(prod), it->second});
+      }
+    }
+  }
+
+  CostTable table(cost, ops);
+  std::vector<std::vector<double>> latencies;
+  for (auto &group : stages)
+    latencies.push_back(table.latencies(group));
+
+  // Cost of stage k with ops in [begin, end), calling fn for each extended end
+  // NOTE A tensor is counted once in a stage, marked with stamp of the stage
+  std::vector<uint32_t> seen(tensor_sizes.size(), 0);
+  uint32_t stamp = 0;
+  auto extend = [&](uint32_t k, uint32_t begin, uint32_t end, auto fn) {
+    ++stamp;
+    double value = 0.0;
+    for (uint32_t p = begin; p < end; ++p)
+    {
+      value += latencies[k][p];
+      for (auto &in : in_tensors[p])
+      {
+        if (in.producer < begin && seen[in.tensor] != stamp)
+        {
+          seen[in.tensor] = stamp;
+          value += cost.transfer * tensor_sizes[in.tensor];
+        }
+      }
+      fn(p + 1, value);
+    }
+    return value;
+  };
+
+  // best[i]: the smallest largest-stage-cost to run first i ops with stages so far
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<double> best(num_ops + 1, inf);
+  best[0] = 0.0;
+  std::vector<std::vector<uint32_t>> begins(num_stages, std::vector<uint32_t>(num_ops + 1, 0));
+  for (uint32_t k = 0; k < num_stages; ++k)
+  {
+    // Empty stage is allowed, as there can be more stages than ops
+    std::vector<double> next = best;
+    for (uint32_t i = 0; i <= num_ops; ++i)
+      begins[k][i] = i;
+
+    for (uint32_t begin = 0; begin < num_ops; ++begin)
+    {
+      if (best[begin] == inf)
+        continue;
+      extend(k, begin, num_ops, [&](uint32_t end, double value) {
+        auto candidate = std::max(best[begin], value);
+        if (candidate < next[end])
+        {
+          next[end] = candidate;
+          begins[k][end] = begin;
+        }
+      });
+    }
+    best = std::move(next);
+  }
+
+  // Assign ops of each stage from the last stage
+  PartitionTable partition;
+  partition.comply = PartitionTable::COMPLY::OPNAME;
+  partition.default_group = groups.front();
+  partition.groups = groups;
+
+  uint32_t end = num_ops;
+  for (uint32_t k = num_stages; k-- > 0;)
+  {
+    const uint32_t begin = begins[k][end];
+    const double value = extend(k, begin, end, [](uint32_t, double) {});
+    INFO(l) << "Stage " << k << " " << groups[k] << ": " << (end - begin) << " ops, cost "
+            << value << std::endl;
+
+    for (uint32_t p = begin; p < end; ++p)
+    {
+      const auto &name = ops[p]->name();
+      if (name.empty())
+        throw std::runtime_error("partition_by_cost: op without name");
+      auto res = partition.byopnames.emplace(name, groups[k]);
+      if (not res.second && res.first->second != groups[k])
+        throw std::runtime_error("partition_by_cost: op name '" + name + "' is not unique");
+    }
+    end = begin;
+  }
+  assert(end == 0);
+  INFO(l) << "Largest stage cost: " << best[num_ops] << std::endl;
+
+  return partition;
+}
+
+} // namespace luci
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/PartitionCost.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace
+{
+
+using namespace luci::test;
+
+class SqrtChainGraphlet
+{
+public:
+  SqrtChainGraphlet() = default;
+
+public:
+  void init(loco::Graph *g, const ShapeU32 shape)
+  {
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      _sqrt[i] = g->nodes()->create<luci::CircleSqrt>();
+      _sqrt[i]->dtype(loco::DataType::FLOAT32);
+      _sqrt[i]->shape(shape);
+      _sqrt[i]->shape_status(luci::ShapeStatus::VALID);
+      _sqrt[i]->name("sqrt" + std::to_string(i));
+    }
+  }
+
+protected:
+  luci::CircleSqrt *_sqrt[4] = {nullptr, nullptr, nullptr, nullptr};
+};
+
+class SqrtChainGraph : public TestIOGraph, public SqrtChainGraphlet
+{
+public:
+  SqrtChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+    SqrtChainGraphlet::init(g(), shape);
+
+    _sqrt[0]->x(input());
+    for (uint32_t i = 1; i < 4; ++i)
+      _sqrt[i]->x(_sqrt[i - 1]);
+
+    output()->from(_sqrt[3]);
+  }
+
+  void rename(uint32_t i, const std::string &name) { _sqrt[i]->name(name); }
+};
+
+} // namespace
+
+TEST(PartitionCostTest, balance_latency)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+  cost.byopnames = {{"sqrt0", 1.0}, {"sqrt1", 1.0}, {"sqrt2", 1.0}, {"sqrt3", 3.0}};
+
+  auto pt = luci::partition_by_cost(&module, {"A", "B"}, cost);
+
+  ASSERT_EQ(luci::PartitionTable::COMPLY::OPNAME, pt.comply);
+  ASSERT_EQ(2, pt.groups.size());
+  ASSERT_EQ("A", pt.default_group);
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("A", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("A", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, transfer_cost)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+  cost.byopnames = {{"sqrt0", 10.0}, {"sqrt1", 10.0}, {"sqrt2", 10.0}, {"sqrt3", 10.0}};
+
+  // Without transfer cost, 2:2 is the best
+  auto pt = luci::partition_by_cost(&module, {"A", "B"}, cost);
+  ASSERT_EQ("A", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+
+  // 16 bytes to receive costs 16, so 3:1 is the best with cost 30 against 36 of 2:2
+  cost.transfer = 1.0;
+  pt = luci::partition_by_cost(&module, {"A", "B"}, cost);
+  ASSERT_EQ("A", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, byopcodes)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  // Each Sqrt has 32 bytes of input and output, 'A' is three times slower
+  luci::PartitionCost cost;
+  cost.byopcodes["A"]["Sqrt"] = {{16, 1.5}, {64, 6.0}};
+  cost.byopcodes["B"]["SQRT"] = {{32, 1.0}};
+
+  auto pt = luci::partition_by_cost(&module, {"A", "B"}, cost);
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, more_stages_than_ops)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+
+  auto pt = luci::partition_by_cost(&module, {"A", "B", "C", "D", "E"}, cost);
+  ASSERT_EQ(5, pt.groups.size());
+  ASSERT_EQ(4, pt.byopnames.size());
+}
+
+TEST(PartitionCostTest, empty_stages_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+
+  EXPECT_ANY_THROW(luci::partition_by_cost(&module, {}, cost));
+}
+
+TEST(PartitionCostTest, duplicate_name_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.rename(3, "sqrt0");
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+
+  EXPECT_ANY_THROW(luci::partition_by_cost(&module, {"A", "B"}, cost));
+}
+
+TEST(PartitionCostTest, repeated_backends)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+  cost.byopnames = {{"sqrt0", 2.0}, {"sqrt1", 1.0}, {"sqrt2", 1.0}, {"sqrt3", 2.0}};
+
+  auto pt = luci::partition_by_cost(&module, {"A", "B", "A"}, cost);
+  ASSERT_EQ(3, pt.groups.size());
+  ASSERT_EQ("A_0", pt.groups.at(0));
+  ASSERT_EQ("B", pt.groups.at(1));
+  ASSERT_EQ("A_1", pt.groups.at(2));
+  ASSERT_EQ("A_0", pt.default_group);
+  ASSERT_EQ("A_0", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("A_1", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, repeated_backends_byopcodes)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  // Latency of numbered groups is looked up by backend name
+  luci::PartitionCost cost;
+  cost.byopcodes["A"]["SQRT"] = {{32, 2.0}};
+  cost.byopcodes["B"]["SQRT"] = {{32, 1.0}};
+
+  auto pt = luci::partition_by_cost(&module, {"A", "A", "B"}, cost);
+  ASSERT_EQ("A_0", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("A_1", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, repeated_backends_name_clash_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 2});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+
+  EXPECT_ANY_THROW(luci::partition_by_cost(&module, {"A", "A", "A_0"}, cost));
+}
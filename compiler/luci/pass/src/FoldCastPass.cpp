@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/FoldCastPass.h"
+#include "RewritePatterns.h"
 
 #include <luci/IR/CircleNodes.h>
 
@@ -107,19 +108,17 @@ namespace luci
 /**
  * Constant Folding for Cast Op
  **/
-bool FoldCastPass::run(loco::Graph *g)
+std::unique_ptr<RewritePattern> make_fold_cast_pattern(void)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto cast = dynamic_cast<luci::CircleCast *>(node))
-    {
-      if (fold_cast(cast))
-        changed = true;
-    }
-  }
+  return std::make_unique<NodeRewritePattern<luci::CircleCast>>(
+    "FoldCast", luci::CircleOpcode::CAST, fold_cast);
+}
 
-  return changed;
+bool FoldCastPass::run(loco::Graph *g)
+{
+  RewriteDriver driver;
+  driver.add(make_fold_cast_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/FuseActivationFunctionPass.h"
+#include "RewritePatterns.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeMixins.h>
@@ -89,23 +90,20 @@ bool fuse_activation_function(luci::CircleNode *node)
   return true;
 }
 
-bool FuseActivationFunctionPass::run(loco::Graph *g)
+std::unique_ptr<RewritePattern> make_fuse_activation_function_pattern(void)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = static_cast<luci::CircleNode *>(node);
-    auto opcode = circle_node->opcode();
-    // TANH is not supported as CONV fused with TANH is not supported in luci-interpreter
-    if (opcode == luci::CircleOpcode::RELU || opcode == luci::CircleOpcode::RELU6 ||
-        opcode == luci::CircleOpcode::RELU_N1_TO_1)
-    {
-      if (fuse_activation_function(circle_node))
-        changed = true;
-    }
-  }
+  // TANH is not supported as CONV fused with TANH is not supported in luci-interpreter
+  std::vector<luci::CircleOpcode> roots{luci::CircleOpcode::RELU, luci::CircleOpcode::RELU6,
+                                        luci::CircleOpcode::RELU_N1_TO_1};
+  return std::make_unique<NodeRewritePattern<luci::CircleNode>>("FuseActivationFunction", roots,
+                                                                fuse_activation_function);
+}
 
-  return changed;
+bool FuseActivationFunctionPass::run(loco::Graph *g)
+{
+  RewriteDriver driver;
+  driver.add(make_fuse_activation_function_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
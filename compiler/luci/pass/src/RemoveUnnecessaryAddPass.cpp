@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/RemoveUnnecessaryAddPass.h"
+#include "RewritePatterns.h"
 
 #include "helpers/NodeFiller.h"
 
@@ -90,18 +91,17 @@ namespace luci
  *      [CircleNode]
  *
  **/
+std::unique_ptr<RewritePattern> make_remove_unnecessary_add_pattern(void)
+{
+  return std::make_unique<NodeRewritePattern<luci::CircleNode>>(
+    "RemoveUnnecessaryAdd", luci::CircleOpcode::ADD, remove_no_effect_add);
+}
+
 bool RemoveUnnecessaryAddPass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (remove_no_effect_add(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  RewriteDriver driver;
+  driver.add(make_remove_unnecessary_add_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
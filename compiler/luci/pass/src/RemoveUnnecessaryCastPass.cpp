@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/RemoveUnnecessaryCastPass.h"
+#include "RewritePatterns.h"
 
 #include <luci/IR/CircleNodes.h>
 
@@ -59,18 +60,17 @@ bool remove_unnecessary_cast(luci::CircleCast *cast)
 namespace luci
 {
 
+std::unique_ptr<RewritePattern> make_remove_unnecessary_cast_pattern(void)
+{
+  return std::make_unique<NodeRewritePattern<luci::CircleCast>>(
+    "RemoveUnnecessaryCast", luci::CircleOpcode::CAST, remove_unnecessary_cast);
+}
+
 bool RemoveUnnecessaryCastPass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto cast_node = dynamic_cast<luci::CircleCast *>(node))
-    {
-      if (remove_unnecessary_cast(cast_node))
-        changed = true;
-    }
-  }
-  return changed;
+  RewriteDriver driver;
+  driver.add(make_remove_unnecessary_cast_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
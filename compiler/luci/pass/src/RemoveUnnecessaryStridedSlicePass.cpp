@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/RemoveUnnecessaryStridedSlicePass.h"
+#include "RewritePatterns.h"
 
 #include <luci/IR/CircleNodes.h>
 
@@ -108,17 +109,18 @@ namespace luci
  * StridedSlice OP has effect if,
  *    1. begin_const[idx] is 0 AND input_shape[idx] are equal to end_shape[idx]
  */
+std::unique_ptr<RewritePattern> make_remove_unnecessary_strided_slice_pattern(void)
+{
+  return std::make_unique<NodeRewritePattern<luci::CircleStridedSlice>>(
+    "RemoveUnnecessaryStridedSlice", luci::CircleOpcode::STRIDED_SLICE,
+    remove_no_effect_strided_slice);
+}
+
 bool RemoveUnnecessaryStridedSlicePass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto target_node = dynamic_cast<luci::CircleStridedSlice *>(node);
-    if (target_node != nullptr)
-      if (remove_no_effect_strided_slice(target_node))
-        changed = true;
-  }
-  return changed;
+  RewriteDriver driver;
+  driver.add(make_remove_unnecessary_strided_slice_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
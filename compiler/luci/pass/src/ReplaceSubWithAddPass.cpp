@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/ReplaceSubWithAddPass.h"
+#include "RewritePatterns.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -58,19 +59,17 @@ bool replace_sub_with_const_rhs(luci::CircleSub *sub)
 namespace luci
 {
 
-bool ReplaceSubWithAddPass::run(loco::Graph *g)
+std::unique_ptr<RewritePattern> make_replace_sub_with_add_pattern(void)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto sub = dynamic_cast<luci::CircleSub *>(node))
-    {
-      if (replace_sub_with_const_rhs(sub))
-        changed = true;
-    }
-  }
+  return std::make_unique<NodeRewritePattern<luci::CircleSub>>(
+    "ReplaceSubWithAdd", luci::CircleOpcode::SUB, replace_sub_with_const_rhs);
+}
 
-  return changed;
+bool ReplaceSubWithAddPass::run(loco::Graph *g)
+{
+  RewriteDriver driver;
+  driver.add(make_replace_sub_with_add_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PASS_REWRITE_PATTERNS_H__
+#define __LUCI_PASS_REWRITE_PATTERNS_H__
+
+#include "helpers/RewriteDriver.h"
+
+#include <memory>
+
+namespace luci
+{
+
+// Patterns of passes that run with RewriteDriver, defined with each pass
+
+std::unique_ptr<RewritePattern> make_fold_cast_pattern(void);
+std::unique_ptr<RewritePattern> make_fuse_activation_function_pattern(void);
+std::unique_ptr<RewritePattern> make_remove_unnecessary_add_pattern(void);
+std::unique_ptr<RewritePattern> make_remove_unnecessary_cast_pattern(void);
+std::unique_ptr<RewritePattern> make_remove_unnecessary_strided_slice_pattern(void);
+std::unique_ptr<RewritePattern> make_replace_sub_with_add_pattern(void);
+std::unique_ptr<RewritePattern> make_transform_min_max_to_relu6_pattern(void);
+std::unique_ptr<RewritePattern> make_transform_sqrt_div_to_rsqrt_mul_pattern(void);
+
+} // namespace luci
+
+#endif // __LUCI_PASS_REWRITE_PATTERNS_H__
@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/TransformMinMaxToRelu6Pass.h"
+#include "RewritePatterns.h"
 
 #include "helpers/NodeFiller.h"
 
@@ -114,20 +115,18 @@ template <loco::DataType DT> bool transform_min_max_pattern(luci::CircleMaximum
 namespace luci
 {
 
+std::unique_ptr<RewritePattern> make_transform_min_max_to_relu6_pattern(void)
+{
+  return std::make_unique<NodeRewritePattern<luci::CircleMaximum>>(
+    "TransformMinMaxToRelu6", luci::CircleOpcode::MAXIMUM,
+    transform_min_max_pattern<loco::DataType::FLOAT32>);
+}
+
 bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
 {
-  bool changed = false;
-
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto maxi = dynamic_cast<luci::CircleMaximum *>(node))
-    {
-      if (transform_min_max_pattern<loco::DataType::FLOAT32>(maxi))
-        changed = true;
-    }
-  }
-
-  return changed;
+  RewriteDriver driver;
+  driver.add(make_transform_min_max_to_relu6_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/TransformSqrtDivToRsqrtMulPass.h"
+#include "RewritePatterns.h"
 
 #include "helpers/NodeFiller.h"
 
@@ -82,20 +83,17 @@ bool transform_sqrtdiv_to_rsqrtmul(luci::CircleDiv *div)
 namespace luci
 {
 
+std::unique_ptr<RewritePattern> make_transform_sqrt_div_to_rsqrt_mul_pattern(void)
+{
+  return std::make_unique<NodeRewritePattern<luci::CircleDiv>>(
+    "TransformSqrtDivToRsqrtMul", luci::CircleOpcode::DIV, transform_sqrtdiv_to_rsqrtmul);
+}
+
 bool TransformSqrtDivToRsqrtMulPass::run(loco::Graph *g)
 {
-  bool changed = false;
-
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto div = dynamic_cast<luci::CircleDiv *>(node))
-    {
-      if (transform_sqrtdiv_to_rsqrtmul(div))
-        changed = true;
-    }
-  }
-
-  return changed;
+  RewriteDriver driver;
+  driver.add(make_transform_sqrt_div_to_rsqrt_mul_pattern());
+  return driver.run(g);
 }
 
 } // namespace luci
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RewriteDriver.h"
+
+#include <luci/Log.h>
+
+#include <deque>
+#include <unordered_set>
+
+namespace luci
+{
+
+void RewriteDriver::add(std::unique_ptr<RewritePattern> &&pattern)
+{
+  for (auto opcode : pattern->roots())
+    _byopcode[opcode].push_back(pattern.get());
+
+  _patterns.push_back(std::move(pattern));
+}
+
+bool RewriteDriver::run(loco::Graph *g) const
+{
+  LOGGER(l);
+
+  std::deque<luci::CircleNode *> worklist;
+  std::unordered_set<luci::CircleNode *> queued;
+  auto push = [&](loco::Node *node) {
+    if (node == nullptr)
+      return;
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (_byopcode.find(circle_node->opcode()) == _byopcode.end())
+      return;
+    if (queued.insert(circle_node).second)
+      worklist.push_back(circle_node);
+  };
+  auto push_around = [&](loco::Node *node) {
+    push(node);
+    for (uint32_t i = 0; i < node->arity(); ++i)
+      push(node->arg(i));
+    for (auto succ : loco::succs(node))
+      push(succ);
+  };
+
+  // Start with all nodes in topological order, as passes do
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+    push(node);
+
+  bool changed = false;
+  uint32_t num_tries = 0;
+  uint32_t num_rewrites = 0;
+  while (not worklist.empty())
+  {
+    auto node = worklist.front();
+    worklist.pop_front();
+    queued.erase(node);
+
+    // Skip nodes that are not used anymore by previous rewrites
+    if (loco::succs(node).empty())
+      continue;
+
+    // Rewrite can change any of these, so keep them before rewrite
+    std::vector<loco::Node *> around;
+    for (uint32_t i = 0; i < node->arity(); ++i)
+      around.push_back(node->arg(i));
+    for (auto succ : loco::succs(node))
+      around.push_back(succ);
+    const auto num_nodes = g->nodes()->size();
+
+    for (auto pattern : _byopcode.at(node->opcode()))
+    {
+      num_tries++;
+      if (not pattern->rewrite(node))
+        continue;
+
+      num_rewrites++;
+      changed = true;
+
+      push(node);
+      for (auto around_node : around)
+        push(around_node);
+      // NOTE nodes are not destroyed by patterns, so new nodes are at the end of nodes
+      for (uint32_t i = num_nodes; i < g->nodes()->size(); ++i)
+        push_around(g->nodes()->at(i));
+      break;
+    }
+  }
+
+  INFO(l) << "RewriteDriver: " << num_rewrites << " rewrites with " << num_tries << " tries"
+          << std::endl;
+
+  return changed;
+}
+
+} // namespace luci
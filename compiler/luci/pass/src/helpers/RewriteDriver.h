@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PASS_HELPERS_REWRITE_DRIVER_H__
+#define __LUCI_PASS_HELPERS_REWRITE_DRIVER_H__
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Rewrite of graph rooted at a node of given opcodes
+ * @note  Rewrite should not destroy nodes. Nodes left without users are removed by
+ *        dead node removal, same as passes.
+ *        Rewrite should set dtype and shape of new nodes, as shape and type inference
+ *        of the graph is left to the Phase.
+ */
+class RewritePattern
+{
+public:
+  virtual ~RewritePattern() = default;
+
+public:
+  virtual const char *name(void) const = 0;
+  // Opcodes of root nodes where this pattern is tried
+  virtual std::vector<luci::CircleOpcode> roots(void) const = 0;
+  // Return true if graph is changed
+  virtual bool rewrite(luci::CircleNode *root) = 0;
+};
+
+/**
+ * @brief RewritePattern with a function that rewrites at a node of type NODE
+ */
+template <typename NODE> class NodeRewritePattern final : public RewritePattern
+{
+public:
+  NodeRewritePattern(const char *name, const std::vector<luci::CircleOpcode> &roots,
+                     bool (*fn)(NODE *))
+    : _name{name}, _roots{roots}, _fn{fn}
+  {
+    // DO NOTHING
+  }
+
+  NodeRewritePattern(const char *name, luci::CircleOpcode root, bool (*fn)(NODE *))
+    : NodeRewritePattern(name, std::vector<luci::CircleOpcode>{root}, fn)
+  {
+    // DO NOTHING
+  }
+
+public:
+  const char *name(void) const final { return _name; }
+  std::vector<luci::CircleOpcode> roots(void) const final { return _roots; }
+  bool rewrite(luci::CircleNode *root) final { return _fn(loco::must_cast<NODE *>(root)); }
+
+private:
+  const char *_name;
+  std::vector<luci::CircleOpcode> _roots;
+  bool (*_fn)(NODE *);
+};
+
+/**
+ * @brief Apply patterns to graph until no pattern changes the graph
+ *
+ * Instead of scanning the whole graph again after a change, it keeps a worklist of nodes
+ * around each change: the root with its inputs and users before the rewrite, and new nodes
+ * with their inputs and users. Only patterns of opcode of a node are tried for the node.
+ */
+class RewriteDriver final
+{
+public:
+  void add(std::unique_ptr<RewritePattern> &&pattern);
+
+public:
+  /**
+   * @brief  Run patterns to the fixed point
+   * @return false if there was nothing changed
+   */
+  bool run(loco::Graph *g) const;
+
+private:
+  std::vector<std::unique_ptr<RewritePattern>> _patterns;
+  std::unordered_map<luci::CircleOpcode, std::vector<RewritePattern *>> _byopcode;
+};
+
+} // namespace luci
+
+#endif // __LUCI_PASS_HELPERS_REWRITE_DRIVER_H__
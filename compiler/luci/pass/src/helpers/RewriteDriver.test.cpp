@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RewriteDriver.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+uint32_t num_removes = 0;
+
+// Remove Cast of same input and output dtype
+bool remove_same_cast(luci::CircleCast *cast)
+{
+  auto x = loco::must_cast<luci::CircleNode *>(cast->x());
+  if (x->dtype() != cast->dtype())
+    return false;
+
+  num_removes++;
+  loco::replace(cast).with(x);
+  return true;
+}
+
+/**
+ *  Graph of casts of same dtype
+ *
+ *   [Input] - [Cast] - ... - [Cast] - [Output]
+ */
+class CastChainGraph : public TestIOGraph
+{
+public:
+  void init(uint32_t num_casts)
+  {
+    TestIOGraph::init({4}, {4});
+
+    loco::Node *x = input();
+    for (uint32_t i = 0; i < num_casts; ++i)
+    {
+      auto cast = g()->nodes()->create<luci::CircleCast>();
+      cast->x(x);
+      cast->in_data_type(loco::DataType::FLOAT32);
+      cast->out_data_type(loco::DataType::FLOAT32);
+      cast->dtype(loco::DataType::FLOAT32);
+      cast->shape({4});
+      cast->name("cast" + std::to_string(i));
+      x = cast;
+    }
+    output()->from(x);
+  }
+};
+
+std::unique_ptr<luci::RewritePattern> make_pattern(void)
+{
+  return std::make_unique<luci::NodeRewritePattern<luci::CircleCast>>(
+    "RemoveSameCast", luci::CircleOpcode::CAST, remove_same_cast);
+}
+
+} // namespace
+
+TEST(RewriteDriverTest, remove_chain)
+{
+  CastChainGraph g;
+  g.init(5);
+
+  luci::RewriteDriver driver;
+  driver.add(make_pattern());
+  num_removes = 0;
+
+  EXPECT_TRUE(driver.run(g.g()));
+  EXPECT_EQ(5, num_removes);
+  EXPECT_EQ(g.input(), g.output()->from());
+
+  // Nothing left to rewrite
+  EXPECT_FALSE(driver.run(g.g()));
+}
+
+TEST(RewriteDriverTest, no_pattern_NEG)
+{
+  CastChainGraph g;
+  g.init(2);
+
+  luci::RewriteDriver driver;
+  EXPECT_FALSE(driver.run(g.g()));
+  EXPECT_NE(g.input(), g.output()->from());
+}
+
+TEST(RewriteDriverTest, other_opcode_NEG)
+{
+  CastChainGraph g;
+  g.init(2);
+
+  luci::RewriteDriver driver;
+  driver.add(std::make_unique<luci::NodeRewritePattern<luci::CircleCast>>(
+    "RemoveSameCast", luci::CircleOpcode::ADD, remove_same_cast));
+  num_removes = 0;
+
+  EXPECT_FALSE(driver.run(g.g()));
+  EXPECT_EQ(0, num_removes);
+}
@@ -36,6 +36,13 @@ void copy_values(const luci::CircleConst *node, luci::CircleConst *cloned)
   assert(T == node->dtype());
   assert(T == cloned->dtype());
 
+  if (node->viewed())
+  {
+    // Share the view, as data is copied when either of them is changed
+    cloned->view(node->view_owner(), node->raw_data(), node->raw_size());
+    return;
+  }
+
   const auto size = node->size<T>();
   cloned->size<T>(size);
   for (uint32_t i = 0; i < size; i++)
@@ -98,6 +98,31 @@ TEST(CircleConstTest, clone)
   ASSERT_NE(nullptr, const_cloned->sparsityparam());
 }
 
+TEST(CircleConstTest, clone_view)
+{
+  auto g = loco::make_graph();
+
+  auto owner = std::make_shared<std::vector<float>>(std::vector<float>{1.0f, 2.0f});
+  auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  auto circle_const = g->nodes()->create<luci::CircleConst>();
+  circle_const->dtype(loco::DataType::FLOAT32);
+  circle_const->rank(1);
+  circle_const->dim(0).set(2);
+  circle_const->view(owner, data, 2 * sizeof(float));
+
+  auto const_cloned = luci::clone(circle_const);
+
+  // clone should share data, until it is changed
+  ASSERT_TRUE(const_cloned->viewed());
+  ASSERT_EQ(data, const_cloned->raw_data());
+
+  const_cloned->at<loco::DataType::FLOAT32>(0) = 3.0f;
+  ASSERT_FALSE(const_cloned->viewed());
+  ASSERT_TRUE(circle_const->viewed());
+  ASSERT_EQ(1.0f, owner->at(0));
+}
+
 TEST(CircleConstTest, clone_U4)
 {
   auto g = loco::make_graph();
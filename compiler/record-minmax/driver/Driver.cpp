@@ -81,7 +81,14 @@ int entry(const int argc, char **argv)
     .help("Hyperparameter (C) to compute moving average (default: 0.1). Update equation: avg <- "
           "avg + C * (curr_batch_avg - avg)");
 
-  arser.add_argument("--mode").help("Record mode. percentile (default) or moving_average");
+  arser.add_argument("--mode").help(
+    "Record mode. percentile (default), moving_average, entropy or mse. entropy and mse select "
+    "the range minimizing KL divergence or quantization error (assuming uint8) from histograms "
+    "of activations, which use fixed memory regardless of the number of records");
+
+  arser.add_argument("--histogram_bins")
+    .type(arser::DataType::INT32)
+    .help("Number of histogram bins for entropy and mse mode (default: 2048)");
 
   arser.add_argument("--input_data_format")
     .help("Input data format. h5/hdf5 (default) or list/filelist");
@@ -122,13 +129,19 @@ int entry(const int argc, char **argv)
   std::string mode = ::get_values_from<std::string>(arser, "--mode", "percentile");
   uint32_t moving_avg_batch = ::get_values_from<int>(arser, "--moving_avg_batch", 16);
   float moving_avg_const = ::get_values_from<float>(arser, "--moving_avg_const", 0.1);
-  if (mode != "percentile" && mode != "moving_average")
+  int32_t histogram_bins = ::get_values_from<int>(arser, "--histogram_bins", 2048);
+  if (histogram_bins < 1)
+    throw std::runtime_error("The number of histogram bins must be greater than zero");
+  if (mode != "percentile" && mode != "moving_average" && mode != "entropy" && mode != "mse")
     throw std::runtime_error("Unsupported mode");
   std::string input_data_format =
     ::get_values_from<std::string>(arser, "--input_data_format", "h5");
   if (arser["--generate_profile_data"])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
 
+  // Histogram modes select the range for uint8 quantization
+  const uint32_t num_uint8_levels = 256;
+
   std::unique_ptr<MinMaxComputer> computer;
   {
     if (mode == "percentile")
@@ -139,6 +152,14 @@ int entry(const int argc, char **argv)
     {
       computer = make_moving_avg_computer(moving_avg_batch, moving_avg_const);
     }
+    else if (mode == "entropy")
+    {
+      computer = make_entropy_computer(histogram_bins, num_uint8_levels);
+    }
+    else if (mode == "mse")
+    {
+      computer = make_mse_computer(histogram_bins, num_uint8_levels);
+    }
     else
     {
       assert(false);
@@ -17,12 +17,14 @@
 #ifndef __RECORD_MINMAX_MINMAXCOMPUTER_H__
 #define __RECORD_MINMAX_MINMAXCOMPUTER_H__
 
+#include "MinMaxHistogram.h"
 #include "MinMaxVectors.h"
 
 #include <luci/IR/CircleNode.h>
 
 #include <unordered_map>
 #include <memory>
+#include <stdexcept>
 
 namespace record_minmax
 {
@@ -40,6 +42,17 @@ public:
   // Child class must implement this
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map) = 0;
+
+  // Return the number of histogram bins to record if child class works on histograms,
+  // otherwise 0 (min/max vectors are recorded)
+  virtual uint32_t histogram_bins() const { return 0; }
+
+  // Child class returning non-zero histogram_bins() must implement this
+  virtual void update_qparam_from_histogram(
+    const std::unordered_map<const luci::CircleNode *, MinMaxHistogram> *)
+  {
+    throw std::runtime_error("This computer does not support histogram");
+  }
 };
 
 class PercentileComputer : public MinMaxComputer
@@ -74,12 +87,69 @@ private:
   float _update_const = 0.0;
 };
 
+// Base class of computers selecting the range from the histogram of all activation values.
+// Histograms have fixed size, so memory usage does not depend on the number of records.
+class HistogramComputer : public MinMaxComputer
+{
+public:
+  HistogramComputer(uint32_t num_bins, uint32_t num_quant_bins)
+    : _num_bins(num_bins), _num_quant_bins(num_quant_bins)
+  {
+  }
+
+  uint32_t histogram_bins() const override { return _num_bins; }
+
+  void update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *) override
+  {
+    throw std::runtime_error("Histogram computer does not support min/max vectors");
+  }
+
+  void update_qparam_from_histogram(
+    const std::unordered_map<const luci::CircleNode *, MinMaxHistogram> *histogram_map) override;
+
+protected:
+  // Child class must implement this
+  virtual std::pair<float, float> compute_range(const MinMaxHistogram &histogram) const = 0;
+
+protected:
+  uint32_t _num_bins = 0;
+  uint32_t _num_quant_bins = 0;
+};
+
+class EntropyComputer : public HistogramComputer
+{
+public:
+  EntropyComputer(uint32_t num_bins, uint32_t num_quant_bins)
+    : HistogramComputer(num_bins, num_quant_bins)
+  {
+  }
+
+protected:
+  std::pair<float, float> compute_range(const MinMaxHistogram &histogram) const override;
+};
+
+class MSEComputer : public HistogramComputer
+{
+public:
+  MSEComputer(uint32_t num_bins, uint32_t num_quant_bins)
+    : HistogramComputer(num_bins, num_quant_bins)
+  {
+  }
+
+protected:
+  std::pair<float, float> compute_range(const MinMaxHistogram &histogram) const override;
+};
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile,
                                                          float max_percentile);
 
 std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
                                                          float moving_avg_const);
 
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_bins, uint32_t num_quant_bins);
+
+std::unique_ptr<MinMaxComputer> make_mse_computer(uint32_t num_bins, uint32_t num_quant_bins);
+
 } // namespace record_minmax
 
 #endif // __RECORD_MINMAX_MINMAXCOMPUTER_H__
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAXHISTOGRAM_H__
+#define __RECORD_MINMAX_MINMAXHISTOGRAM_H__
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Fixed-size histogram of activation values
+ *
+ * The number of bins never changes. When a value falls outside of the current range, the range
+ * is widened and the existing counts are redistributed to the new bins assuming that values are
+ * uniformly distributed in each bin. So memory usage does not depend on the size of dataset, and
+ * histograms recorded by different threads can be merged.
+ */
+class MinMaxHistogram
+{
+public:
+  explicit MinMaxHistogram(uint32_t num_bins);
+
+public:
+  // Add values. NaN and the lowest float (used as -inf) are ignored.
+  void add(const float *data, uint32_t size);
+
+  // Add all values of other histogram
+  void merge(const MinMaxHistogram &other);
+
+  bool empty() const { return _total == 0; }
+  uint32_t num_bins() const { return static_cast<uint32_t>(_bins.size()); }
+  const std::vector<double> &bins() const { return _bins; }
+  double total() const { return _total; }
+
+  // Range covered by bins, which can be wider than [min(), max()] after merge
+  float lower() const { return _lower; }
+  float upper() const { return _upper; }
+  float bin_width() const { return (_upper - _lower) / num_bins(); }
+
+  // Exact min/max of added values
+  float min() const { return _min; }
+  float max() const { return _max; }
+
+private:
+  // Widen the range to include [lower, upper]
+  void expand(float lower, float upper);
+
+private:
+  std::vector<double> _bins;
+  double _total = 0.0;
+  float _lower = 0.0;
+  float _upper = 0.0;
+  float _min = 0.0;
+  float _max = 0.0;
+};
+
+/**
+ * @brief Return the range minimizing KL divergence between the histogram and its quantized version
+ *
+ * The upper bound is searched first with the lower bound fixed to min, and then the lower bound
+ * with the found upper bound.
+ *
+ * @param num_quant_bins Number of quantization levels (e.g. 256 for uint8)
+ */
+std::pair<float, float> getEntropyRange(const MinMaxHistogram &histogram, uint32_t num_quant_bins);
+
+/**
+ * @brief Return the range minimizing mean squared error of quantization, including clipping error
+ *
+ * @param num_quant_bins Number of quantization levels (e.g. 256 for uint8)
+ */
+std::pair<float, float> getMSERange(const MinMaxHistogram &histogram, uint32_t num_quant_bins);
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAXHISTOGRAM_H__
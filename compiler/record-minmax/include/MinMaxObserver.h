@@ -20,6 +20,7 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
+#include "MinMaxHistogram.h"
 #include "MinMaxVectors.h"
 
 #include <vector>
@@ -48,19 +49,60 @@ public:
                               minmax_vector.max_vector.end());
   }
 
+  // Record values of node to its histogram
+  void recordHistogram(const luci::CircleNode *node, const float *data, uint32_t size,
+                       uint32_t num_bins)
+  {
+    auto iter = _histogram_map.find(node);
+    if (iter == _histogram_map.end())
+      iter = _histogram_map.emplace(node, MinMaxHistogram(num_bins)).first;
+    iter->second.add(data, size);
+  }
+
+  void mergeHistogram(const luci::CircleNode *node, const MinMaxHistogram &histogram)
+  {
+    auto iter = _histogram_map.find(node);
+    if (iter == _histogram_map.end())
+      _histogram_map.emplace(node, histogram);
+    else
+      iter->second.merge(histogram);
+  }
+
+  // Append min/max vectors and merge histograms of other map
+  void appendMinMaxMap(const MinMaxMap &other)
+  {
+    for (const auto &iter : other._minmax_map)
+      appendMinMaxVector(iter.first, iter.second);
+    for (const auto &iter : other._histogram_map)
+      mergeHistogram(iter.first, iter.second);
+  }
+
+  void clear()
+  {
+    _minmax_map.clear();
+    _histogram_map.clear();
+  }
+
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
   {
     return &_minmax_map;
   }
 
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistogram> *getHistogramMap() const
+  {
+    return &_histogram_map;
+  }
+
 private:
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  std::unordered_map<const luci::CircleNode *, MinMaxHistogram> _histogram_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
-  MinMaxObserver()
+  // Record histograms with histogram_bins bins if it is not 0, otherwise min/max vectors
+  explicit MinMaxObserver(uint32_t histogram_bins = 0) : _histogram_bins(histogram_bins)
   {
     // Do nothing
   }
@@ -71,7 +113,10 @@ public:
   // Never return nullptr
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  void clearMinMaxData() { _minmax_data.clear(); }
+
 private:
+  uint32_t _histogram_bins = 0;
   MinMaxMap _minmax_data;
 };
 
@@ -26,6 +26,14 @@
 #include <memory>
 #include <thread>
 
+namespace dio
+{
+namespace hdf5
+{
+class HDF5Importer;
+} // namespace hdf5
+} // namespace dio
+
 namespace record_minmax
 {
 
@@ -71,7 +79,11 @@ private:
     return _observers[0].get();
   }
 
-  WholeOutput importH5Data(const std::string &input_data_path);
+  // Import records in [first_record, last_record)
+  WholeOutput importH5Data(const dio::hdf5::HDF5Importer &importer, int32_t first_record,
+                           int32_t last_record);
+
+  void updateQParam(const MinMaxMap *minmax_data);
 
   std::unique_ptr<luci::Module> _module;
 
@@ -72,6 +72,40 @@ void MovingAvgComputer::update_qparam(
   }
 }
 
+void HistogramComputer::update_qparam_from_histogram(
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistogram> *histogram_map)
+{
+  if (histogram_map == nullptr)
+    throw std::invalid_argument("histogram_map is nullptr");
+
+  for (auto iter = histogram_map->begin(); iter != histogram_map->end(); ++iter)
+  {
+    auto node = iter->first;
+    const auto &histogram = iter->second;
+
+    const auto range = compute_range(histogram);
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(range.first);
+    quantparam->max.push_back(range.second);
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
+std::pair<float, float> EntropyComputer::compute_range(const MinMaxHistogram &histogram) const
+{
+  return getEntropyRange(histogram, _num_quant_bins);
+}
+
+std::pair<float, float> MSEComputer::compute_range(const MinMaxHistogram &histogram) const
+{
+  return getMSERange(histogram, _num_quant_bins);
+}
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile, float max_percentile)
 {
   return std::make_unique<PercentileComputer>(min_percentile, max_percentile);
@@ -83,4 +117,14 @@ std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
   return std::make_unique<MovingAvgComputer>(batch_size, moving_avg_const);
 }
 
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_bins, uint32_t num_quant_bins)
+{
+  return std::make_unique<EntropyComputer>(num_bins, num_quant_bins);
+}
+
+std::unique_ptr<MinMaxComputer> make_mse_computer(uint32_t num_bins, uint32_t num_quant_bins)
+{
+  return std::make_unique<MSEComputer>(num_bins, num_quant_bins);
+}
+
 } // namespace record_minmax
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+bool isIgnored(float value)
+{
+  // TODO use metadata hints to detect such cases
+  return std::isnan(value) || value == std::numeric_limits<float>::lowest();
+}
+
+// Add counts of src bins to dst bins in proportion to the overlap of bins
+void redistribute(const std::vector<double> &src, float src_lower, float src_width,
+                  std::vector<double> &dst, float dst_lower, float dst_width)
+{
+  const auto num_dst = static_cast<int64_t>(dst.size());
+  for (size_t i = 0; i < src.size(); ++i)
+  {
+    if (src[i] == 0.0)
+      continue;
+
+    const double begin = (src_lower + i * static_cast<double>(src_width) - dst_lower) / dst_width;
+    const double end = begin + static_cast<double>(src_width) / dst_width;
+    const auto first = std::max<int64_t>(0, static_cast<int64_t>(std::floor(begin)));
+    const auto last = std::min<int64_t>(num_dst - 1, static_cast<int64_t>(std::ceil(end)) - 1);
+    if (first > last)
+    {
+      // Out of range by rounding error
+      dst[std::min<int64_t>(std::max<int64_t>(first, 0), num_dst - 1)] += src[i];
+      continue;
+    }
+
+    for (auto j = first; j <= last; ++j)
+    {
+      const double overlap = std::min<double>(end, j + 1) - std::max<double>(begin, j);
+      dst[j] += src[i] * std::max(overlap, 0.0) / (end - begin);
+    }
+  }
+}
+
+// KL divergence between histogram and its quantized version, only the first num_bins are kept and
+// the rest are clipped into the last bin
+double klDivergence(const std::vector<double> &bins, uint32_t num_bins, uint32_t num_quant_bins)
+{
+  assert(num_bins <= bins.size());
+  assert(num_quant_bins <= num_bins);
+
+  std::vector<double> p(bins.begin(), bins.begin() + num_bins);
+  for (size_t i = num_bins; i < bins.size(); ++i)
+    p[num_bins - 1] += bins[i];
+
+  // Merge bins into quantization levels and expand them back over non-empty bins
+  std::vector<double> q(num_bins, 0.0);
+  for (uint32_t j = 0; j < num_quant_bins; ++j)
+  {
+    const uint32_t begin = static_cast<uint64_t>(j) * num_bins / num_quant_bins;
+    const uint32_t end = static_cast<uint64_t>(j + 1) * num_bins / num_quant_bins;
+
+    double sum = 0.0;
+    uint32_t num_nonzero = 0;
+    for (uint32_t k = begin; k < end; ++k)
+    {
+      sum += bins[k];
+      num_nonzero += bins[k] != 0.0 ? 1 : 0;
+    }
+    if (num_nonzero == 0)
+      continue;
+
+    for (uint32_t k = begin; k < end; ++k)
+      q[k] = bins[k] != 0.0 ? sum / num_nonzero : 0.0;
+  }
+
+  double p_sum = 0.0;
+  double q_sum = 0.0;
+  for (uint32_t k = 0; k < num_bins; ++k)
+  {
+    p_sum += p[k];
+    q_sum += q[k];
+  }
+  if (p_sum == 0.0 || q_sum == 0.0)
+    return std::numeric_limits<double>::max();
+
+  // Probability for p > 0 and q == 0, which happens only at the clipped bin
+  constexpr double eps = 1e-7;
+
+  double divergence = 0.0;
+  for (uint32_t k = 0; k < num_bins; ++k)
+  {
+    if (p[k] == 0.0)
+      continue;
+
+    const double p_k = p[k] / p_sum;
+    const double q_k = q[k] != 0.0 ? q[k] / q_sum : eps;
+    divergence += p_k * std::log(p_k / q_k);
+  }
+  return divergence;
+}
+
+// Return the number of leading bins to keep, which minimizes KL divergence
+uint32_t searchEntropyBins(const std::vector<double> &bins, uint32_t num_quant_bins)
+{
+  const auto num_bins = static_cast<uint32_t>(bins.size());
+  if (num_bins <= num_quant_bins)
+    return num_bins;
+
+  // Try at most 256 candidates to bound the search time
+  const uint32_t step = std::max<uint32_t>(1, (num_bins - num_quant_bins) / 256);
+
+  uint32_t best_bins = num_bins;
+  double best_divergence = std::numeric_limits<double>::max();
+  for (uint32_t i = num_bins; i >= num_quant_bins; i -= std::min(step, i))
+  {
+    const double divergence = klDivergence(bins, i, num_quant_bins);
+    if (divergence < best_divergence)
+    {
+      best_divergence = divergence;
+      best_bins = i;
+    }
+    if (i == num_quant_bins)
+      break;
+  }
+  return best_bins;
+}
+
+// Mean squared error of quantizing histogram into [begin, end) bins with num_quant_bins levels
+double quantizationError(const std::vector<double> &bins, double total, uint32_t begin,
+                         uint32_t end, uint32_t num_quant_bins)
+{
+  assert(begin < end);
+
+  // Work in the unit of bin width
+  const double step = static_cast<double>(end - begin) / (num_quant_bins - 1);
+  const double rounding_error = step * step / 12.0;
+
+  double error = 0.0;
+  for (uint32_t k = 0; k < bins.size(); ++k)
+  {
+    if (bins[k] == 0.0)
+      continue;
+
+    const double center = k + 0.5;
+    if (center < begin)
+      error += bins[k] * ((begin - center) * (begin - center) + 1.0 / 12.0);
+    else if (center > end)
+      error += bins[k] * ((center - end) * (center - end) + 1.0 / 12.0);
+    else
+      error += bins[k] * rounding_error;
+  }
+  return error / total;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+MinMaxHistogram::MinMaxHistogram(uint32_t num_bins) : _bins(num_bins, 0.0)
+{
+  if (num_bins == 0)
+    throw std::runtime_error("Number of histogram bins must be positive");
+}
+
+void MinMaxHistogram::add(const float *data, uint32_t size)
+{
+  float data_min = std::numeric_limits<float>::max();
+  float data_max = std::numeric_limits<float>::lowest();
+  bool has_value = false;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    if (isIgnored(data[i]))
+      continue;
+
+    has_value = true;
+    data_min = std::min(data_min, data[i]);
+    data_max = std::max(data_max, data[i]);
+  }
+  if (not has_value)
+    return;
+
+  if (empty())
+  {
+    _lower = data_min;
+    _upper = data_max;
+    _min = data_min;
+    _max = data_max;
+    // Give the range a non-zero width so that values can be binned
+    const float min_width = std::max(std::abs(_lower), 1.0f) * 1e-6f;
+    if (_upper - _lower < min_width)
+      _upper = _lower + min_width;
+  }
+  else
+  {
+    expand(data_min, data_max);
+    _min = std::min(_min, data_min);
+    _max = std::max(_max, data_max);
+  }
+
+  const auto num_bins = static_cast<int64_t>(_bins.size());
+  const float width = bin_width();
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    if (isIgnored(data[i]))
+      continue;
+
+    auto index = static_cast<int64_t>((data[i] - _lower) / width);
+    index = std::min(std::max<int64_t>(index, 0), num_bins - 1);
+    _bins[index] += 1.0;
+    _total += 1.0;
+  }
+}
+
+void MinMaxHistogram::merge(const MinMaxHistogram &other)
+{
+  if (other.empty())
+    return;
+
+  if (empty())
+  {
+    _lower = other._lower;
+    _upper = other._upper;
+    _min = other._min;
+    _max = other._max;
+  }
+  else
+  {
+    expand(other._lower, other._upper);
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+  }
+
+  redistribute(other._bins, other._lower, other.bin_width(), _bins, _lower, bin_width());
+  _total += other._total;
+}
+
+void MinMaxHistogram::expand(float lower, float upper)
+{
+  if (lower >= _lower && upper <= _upper)
+    return;
+
+  float new_lower = std::min(lower, _lower);
+  float new_upper = std::max(upper, _upper);
+
+  // Grow the range at least twice so that the counts are not redistributed at every record
+  const float old_range = _upper - _lower;
+  const float grow = 2 * old_range - (new_upper - new_lower);
+  if (grow > 0)
+  {
+    if (new_lower < _lower && new_upper > _upper)
+    {
+      new_lower -= grow / 2;
+      new_upper += grow / 2;
+    }
+    else if (new_lower < _lower)
+      new_lower -= grow;
+    else
+      new_upper += grow;
+  }
+
+  std::vector<double> bins(_bins.size(), 0.0);
+  const float new_width = (new_upper - new_lower) / _bins.size();
+  redistribute(_bins, _lower, bin_width(), bins, new_lower, new_width);
+
+  _bins.swap(bins);
+  _lower = new_lower;
+  _upper = new_upper;
+}
+
+std::pair<float, float> getEntropyRange(const MinMaxHistogram &histogram, uint32_t num_quant_bins)
+{
+  if (histogram.empty())
+    throw std::runtime_error("Cannot compute range of empty histogram");
+  if (num_quant_bins < 2)
+    throw std::runtime_error("Number of quantization levels must be larger than 1");
+
+  const auto &bins = histogram.bins();
+  const float width = histogram.bin_width();
+
+  // Upper bound with all bins from the beginning
+  const uint32_t upper_bins = searchEntropyBins(bins, num_quant_bins);
+
+  // Lower bound with bins below the upper bound, in reverse order
+  std::vector<double> reversed(bins.rbegin() + (bins.size() - upper_bins), bins.rend());
+  for (size_t i = upper_bins; i < bins.size(); ++i)
+    reversed.front() += bins[i];
+  const uint32_t lower_bins = searchEntropyBins(reversed, num_quant_bins);
+
+  float lower = histogram.lower() + (upper_bins - lower_bins) * width;
+  float upper = histogram.lower() + upper_bins * width;
+
+  // Histogram range can be wider than the actual values
+  lower = std::min(std::max(lower, histogram.min()), histogram.max());
+  upper = std::max(std::min(upper, histogram.max()), lower);
+  return {lower, upper};
+}
+
+std::pair<float, float> getMSERange(const MinMaxHistogram &histogram, uint32_t num_quant_bins)
+{
+  if (histogram.empty())
+    throw std::runtime_error("Cannot compute range of empty histogram");
+  if (num_quant_bins < 2)
+    throw std::runtime_error("Number of quantization levels must be larger than 1");
+
+  const auto &bins = histogram.bins();
+  const auto num_bins = static_cast<uint32_t>(bins.size());
+
+  // Trim empty tails first, they do not change the error
+  uint32_t begin = 0;
+  uint32_t end = num_bins;
+  while (begin < end && bins[begin] == 0.0)
+    ++begin;
+  while (end > begin && bins[end - 1] == 0.0)
+    --end;
+  assert(begin < end);
+
+  // Shrink the range greedily from the side that reduces the error more.
+  // Try at most 512 candidates to bound the search time.
+  const uint32_t step = std::max<uint32_t>(1, (end - begin) / 512);
+
+  uint32_t best_begin = begin;
+  uint32_t best_end = end;
+  double best_error = quantizationError(bins, histogram.total(), begin, end, num_quant_bins);
+  while (end - begin > step)
+  {
+    const double error_begin =
+      quantizationError(bins, histogram.total(), begin + step, end, num_quant_bins);
+    const double error_end =
+      quantizationError(bins, histogram.total(), begin, end - step, num_quant_bins);
+
+    double error;
+    if (error_begin < error_end)
+    {
+      begin += step;
+      error = error_begin;
+    }
+    else
+    {
+      end -= step;
+      error = error_end;
+    }
+
+    if (error < best_error)
+    {
+      best_error = error;
+      best_begin = begin;
+      best_end = end;
+    }
+  }
+
+  const float width = histogram.bin_width();
+  float lower = histogram.lower() + best_begin * width;
+  float upper = histogram.lower() + best_end * width;
+
+  // Histogram range can be wider than the actual values
+  lower = std::min(std::max(lower, histogram.min()), histogram.max());
+  upper = std::max(std::min(upper, histogram.max()), lower);
+  return {lower, upper};
+}
+
+} // namespace record_minmax
@@ -110,7 +110,10 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   if (all_nan)
     throw std::runtime_error("All values are NaN(Not a Number)");
 
-  _minmax_data.recordMinMax(node, min, max);
+  if (_histogram_bins > 0)
+    _minmax_data.recordHistogram(node, data, num_elements, _histogram_bins);
+  else
+    _minmax_data.recordMinMax(node, min, max);
 }
 
 } // namespace record_minmax
@@ -70,16 +70,8 @@ std::vector<std::string> parse_line(const std::string &line)
   return res;
 }
 
-// Max h5 file size for parallel recording in bytes = 1 GB
-const long h5_max_size_bytes = 1000000000;
-
-long getH5FileSize(const std::string &input_data_path)
-{
-  std::ifstream in_file(input_data_path, std::ios::binary);
-  in_file.seekg(0, std::ios::end);
-
-  return in_file.tellg();
-}
+// Max size of records loaded at once for parallel recording in bytes = 1 GB
+const size_t max_chunk_size_bytes = 1000000000;
 
 uint32_t numElements(const luci::CircleNode *node)
 {
@@ -198,7 +190,7 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   for (uint32_t thread_idx = 0; thread_idx < _threads_size; ++thread_idx)
   {
     auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
-    auto observer = std::make_unique<MinMaxObserver>();
+    auto observer = std::make_unique<MinMaxObserver>(_minmax_computer->histogram_bins());
 
     interpreter->attachObserver(observer.get());
 
@@ -271,7 +263,7 @@ void RecordMinMax::profileRawDataDirectory(const std::string &input_data_path)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
 }
 
 // input_data_path is a text file which specifies the representative data
@@ -366,65 +358,61 @@ void RecordMinMax::profileRawData(const std::string &input_data_path)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
 }
 
-WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
+WholeOutput RecordMinMax::importH5Data(const dio::hdf5::HDF5Importer &importer,
+                                       int32_t first_record, int32_t last_record)
 {
-  try
-  {
-    dio::hdf5::HDF5Importer importer(input_data_path);
-    importer.importGroup("value");
+  assert(first_record <= last_record);
 
-    bool is_raw_data = importer.isRawData();
+  bool is_raw_data = importer.isRawData();
 
-    const auto num_records = importer.numData();
-    if (num_records == 0)
-      throw std::runtime_error("The input data file does not contain any record.");
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  const auto num_inputs = input_nodes.size();
 
-    const auto input_nodes = loco::input_nodes(_module->graph());
-    const auto num_inputs = input_nodes.size();
+  WholeOutput whole_output(last_record - first_record);
 
-    WholeOutput whole_output(num_records);
+  // Read inputs to whole_output
+  for (int i = first_record; i < last_record; ++i)
+  {
+    if (num_inputs != static_cast<uint32_t>(importer.numInputs(i)))
+      throw std::runtime_error("Wrong number of inputs.");
 
-    // Read inputs to whole_output
-    for (int i = 0; i < num_records; ++i)
+    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
     {
-      if (num_inputs != static_cast<uint32_t>(importer.numInputs(i)))
-        throw std::runtime_error("Wrong number of inputs.");
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      assert(input_node->index() == input_idx);
+      checkInputDimension(input_node);
+      Buffer input_data(getTensorSize(input_node));
 
-      for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+      if (!is_raw_data)
       {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-        assert(input_node->index() == input_idx);
-        checkInputDimension(input_node);
-        Buffer input_data(getTensorSize(input_node));
-
-        if (!is_raw_data)
-        {
-          DataType dtype;
-          Shape shape;
-          importer.readTensor(i, input_idx, &dtype, &shape, input_data.data(), input_data.size());
+        DataType dtype;
+        Shape shape;
+        importer.readTensor(i, input_idx, &dtype, &shape, input_data.data(), input_data.size());
 
-          // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
-        }
-        else
-        {
-          // Skip type/shape check for raw data
-          importer.readTensor(i, input_idx, input_data.data(), input_data.size());
-        }
-        whole_output[i].emplace_back(std::move(input_data));
+        // Check the type and the shape of the input data is valid
+        verifyTypeShape(input_node, dtype, shape);
+      }
+      else
+      {
+        // Skip type/shape check for raw data
+        importer.readTensor(i, input_idx, input_data.data(), input_data.size());
       }
+      whole_output[i - first_record].emplace_back(std::move(input_data));
     }
-
-    return whole_output;
-  }
-  catch (const H5::Exception &e)
-  {
-    H5::Exception::printErrorStack();
-    throw std::runtime_error("HDF5 error occurred.");
   }
+
+  return whole_output;
+}
+
+void RecordMinMax::updateQParam(const MinMaxMap *minmax_data)
+{
+  if (_minmax_computer->histogram_bins() > 0)
+    _minmax_computer->update_qparam_from_histogram(minmax_data->getHistogramMap());
+  else
+    _minmax_computer->update_qparam(minmax_data->getMap());
 }
 
 void RecordMinMax::profileData(const std::string &input_data_path)
@@ -489,7 +477,7 @@ void RecordMinMax::profileData(const std::string &input_data_path)
     throw std::runtime_error("HDF5 error occurred.");
   }
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
 }
 
 void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
@@ -499,33 +487,26 @@ void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
   assert(_interpreters.size() == _threads_size);
   assert(_observers.size() == _threads_size);
 
-  const long h5_file_size = getH5FileSize(input_data_path);
-
-  if (h5_file_size > h5_max_size_bytes)
-    throw std::runtime_error("H5 file size is too large for parallel recording");
+  const auto input_nodes = loco::input_nodes(_module->graph());
 
-  WholeOutput whole_output;
-  try
-  {
-    whole_output = importH5Data(input_data_path);
-  }
-  catch (const std::bad_alloc &e)
+  size_t record_size = 0;
+  for (auto input : input_nodes)
   {
-    throw std::runtime_error("Out of memory during h5 data load.");
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
+    checkInputDimension(input_node);
+    record_size += getTensorSize(input_node);
   }
 
-  const auto num_records = whole_output.size();
-  const auto input_nodes = loco::input_nodes(_module->graph());
+  // Records are loaded and recorded chunk by chunk, so that memory usage does not depend on the
+  // size of h5 file
+  const auto chunk_records = static_cast<int32_t>(
+    std::max<size_t>(_threads_size, max_chunk_size_bytes / std::max<size_t>(record_size, 1)));
 
-  // Start parallel part
   INFO(l) << _threads_size << " concurrent threads are supported." << std::endl;
 
-  const auto run_threads = num_records < _threads_size ? num_records : _threads_size;
-
-  const auto records_batch = static_cast<uint32_t>(num_records / run_threads);
-
-  auto interpret_batch = [&whole_output, &input_nodes](int first_record, int last_record,
-                                                       luci_interpreter::Interpreter *interpreter) {
+  auto interpret_batch = [&input_nodes](const WholeOutput &whole_output, int first_record,
+                                        int last_record,
+                                        luci_interpreter::Interpreter *interpreter) {
     for (int record_index = first_record; record_index < last_record; ++record_index)
     {
       for (uint32_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
@@ -539,43 +520,70 @@ void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
     }
   };
 
-  std::vector<std::thread> threads;
-  for (uint32_t t = 0; t < run_threads; ++t)
+  // Min/max values of all threads
+  MinMaxMap main_min_max_map;
+
+  int32_t num_records = 0;
+  try
   {
-    if (t < run_threads - 1)
-    {
-      threads.emplace_back(interpret_batch, records_batch * t, records_batch * (t + 1),
-                           _interpreters[t].get());
-    }
-    else
+    dio::hdf5::HDF5Importer importer(input_data_path);
+    importer.importGroup("value");
+
+    num_records = importer.numData();
+    if (num_records == 0)
+      throw std::runtime_error("The input data file does not contain any record.");
+
+    for (int32_t first = 0; first < num_records; first += chunk_records)
     {
-      threads.emplace_back(interpret_batch, records_batch * t, num_records, _interpreters[t].get());
-    }
-  }
+      const auto last = std::min(num_records, first + chunk_records);
 
-  for (uint32_t i = 0; i < run_threads; ++i)
-    threads.at(i).join();
+      WholeOutput whole_output;
+      try
+      {
+        whole_output = importH5Data(importer, first, last);
+      }
+      catch (const std::bad_alloc &e)
+      {
+        throw std::runtime_error("Out of memory during h5 data load.");
+      }
 
-  // End parallel part
+      const auto chunk_size = static_cast<uint32_t>(whole_output.size());
 
-  // Copy all min, max values to one min/max map
-  MinMaxMap main_min_max_map;
+      // Start parallel part
+      const auto run_threads = chunk_size < _threads_size ? chunk_size : _threads_size;
 
-  for (const auto &obs : _observers)
-  {
-    const auto cur_minmax_map = obs->minMaxData()->getMap();
-    for (auto &iter : *cur_minmax_map)
-    {
-      const auto node = iter.first;
-      const auto &minmax = iter.second;
+      const auto records_batch = static_cast<uint32_t>(chunk_size / run_threads);
 
-      main_min_max_map.appendMinMaxVector(node, minmax);
+      std::vector<std::thread> threads;
+      for (uint32_t t = 0; t < run_threads; ++t)
+      {
+        const auto batch_end = t < run_threads - 1 ? records_batch * (t + 1) : chunk_size;
+        threads.emplace_back(interpret_batch, std::cref(whole_output), records_batch * t,
+                             batch_end, _interpreters[t].get());
+      }
+
+      for (uint32_t i = 0; i < run_threads; ++i)
+        threads.at(i).join();
+
+      // End parallel part
+
+      // Copy min/max values of the chunk to one min/max map in record order
+      for (const auto &obs : _observers)
+      {
+        main_min_max_map.appendMinMaxMap(*obs->minMaxData());
+        obs->clearMinMaxData();
+      }
     }
   }
+  catch (const H5::Exception &e)
+  {
+    H5::Exception::printErrorStack();
+    throw std::runtime_error("HDF5 error occurred.");
+  }
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(main_min_max_map.getMap());
+  updateQParam(&main_min_max_map);
 }
 
 void RecordMinMax::profileDataWithRandomInputs(void)
@@ -646,7 +654,7 @@ void RecordMinMax::profileDataWithRandomInputs(void)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
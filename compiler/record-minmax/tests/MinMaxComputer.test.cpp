@@ -73,3 +73,46 @@ TEST(MinMaxComputerTest, moving_avg_nullptr_NEG)
 
   EXPECT_ANY_THROW(computer->update_qparam(nullptr));
 }
+
+TEST(MinMaxComputerTest, entropy)
+{
+  auto computer = make_entropy_computer(512, 256);
+  EXPECT_EQ(512, computer->histogram_bins());
+
+  luci::CircleAdd node;
+  std::vector<float> values(1000);
+  for (uint32_t i = 0; i < values.size(); ++i)
+    values[i] = static_cast<float>(i) / 100.0f;
+  MinMaxHistogram histogram(512);
+  histogram.add(values.data(), values.size());
+  std::unordered_map<const luci::CircleNode *, MinMaxHistogram> histogram_map;
+  histogram_map.insert({&node, histogram});
+
+  computer->update_qparam_from_histogram(&histogram_map);
+
+  EXPECT_TRUE(node.quantparam() != nullptr);
+}
+
+TEST(MinMaxComputerTest, entropy_nullptr_NEG)
+{
+  auto computer = make_entropy_computer(512, 256);
+
+  EXPECT_ANY_THROW(computer->update_qparam_from_histogram(nullptr));
+}
+
+TEST(MinMaxComputerTest, mse_vectors_NEG)
+{
+  auto computer = make_mse_computer(512, 256);
+
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  EXPECT_ANY_THROW(computer->update_qparam(&min_max_map));
+}
+
+TEST(MinMaxComputerTest, percentile_histogram_NEG)
+{
+  auto computer = make_percentile_computer(0.0, 100.0);
+  EXPECT_EQ(0, computer->histogram_bins());
+
+  std::unordered_map<const luci::CircleNode *, MinMaxHistogram> histogram_map;
+  EXPECT_ANY_THROW(computer->update_qparam_from_histogram(&histogram_map));
+}
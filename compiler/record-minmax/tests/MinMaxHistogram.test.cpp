@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxHistogram.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+std::vector<float> uniform(float min, float max, uint32_t size)
+{
+  std::vector<float> values(size);
+  for (uint32_t i = 0; i < size; ++i)
+    values[i] = min + (max - min) * i / (size - 1);
+  return values;
+}
+
+} // namespace
+
+TEST(MinMaxHistogramTest, add)
+{
+  MinMaxHistogram histogram(100);
+  EXPECT_TRUE(histogram.empty());
+
+  auto values = uniform(-1.0, 1.0, 1000);
+  histogram.add(values.data(), values.size());
+
+  EXPECT_FALSE(histogram.empty());
+  EXPECT_EQ(100, histogram.num_bins());
+  EXPECT_DOUBLE_EQ(1000, histogram.total());
+  EXPECT_FLOAT_EQ(-1.0, histogram.min());
+  EXPECT_FLOAT_EQ(1.0, histogram.max());
+  for (auto count : histogram.bins())
+    EXPECT_NEAR(10, count, 1);
+}
+
+TEST(MinMaxHistogramTest, add_ignored)
+{
+  MinMaxHistogram histogram(10);
+
+  std::vector<float> values{std::numeric_limits<float>::quiet_NaN(),
+                            std::numeric_limits<float>::lowest(), 1.0, 2.0};
+  histogram.add(values.data(), values.size());
+
+  EXPECT_DOUBLE_EQ(2, histogram.total());
+  EXPECT_FLOAT_EQ(1.0, histogram.min());
+  EXPECT_FLOAT_EQ(2.0, histogram.max());
+}
+
+TEST(MinMaxHistogramTest, expand)
+{
+  MinMaxHistogram histogram(64);
+
+  auto values1 = uniform(0.0, 1.0, 640);
+  histogram.add(values1.data(), values1.size());
+  auto values2 = uniform(-3.0, 5.0, 640);
+  histogram.add(values2.data(), values2.size());
+
+  EXPECT_DOUBLE_EQ(1280, histogram.total());
+  EXPECT_FLOAT_EQ(-3.0, histogram.min());
+  EXPECT_FLOAT_EQ(5.0, histogram.max());
+  EXPECT_LE(histogram.lower(), -3.0);
+  EXPECT_GE(histogram.upper(), 5.0);
+
+  double sum = 0;
+  for (auto count : histogram.bins())
+    sum += count;
+  EXPECT_NEAR(1280, sum, 1e-6);
+}
+
+TEST(MinMaxHistogramTest, merge)
+{
+  MinMaxHistogram histogram1(128);
+  MinMaxHistogram histogram2(128);
+
+  auto values1 = uniform(-2.0, 0.0, 500);
+  histogram1.add(values1.data(), values1.size());
+  auto values2 = uniform(0.0, 4.0, 700);
+  histogram2.add(values2.data(), values2.size());
+
+  histogram1.merge(histogram2);
+
+  EXPECT_DOUBLE_EQ(1200, histogram1.total());
+  EXPECT_FLOAT_EQ(-2.0, histogram1.min());
+  EXPECT_FLOAT_EQ(4.0, histogram1.max());
+
+  double sum = 0;
+  for (auto count : histogram1.bins())
+    sum += count;
+  EXPECT_NEAR(1200, sum, 1e-6);
+}
+
+TEST(MinMaxHistogramTest, merge_empty)
+{
+  MinMaxHistogram histogram1(16);
+  MinMaxHistogram histogram2(16);
+
+  auto values = uniform(1.0, 2.0, 100);
+  histogram2.add(values.data(), values.size());
+
+  histogram1.merge(histogram2);
+  EXPECT_DOUBLE_EQ(100, histogram1.total());
+  EXPECT_FLOAT_EQ(1.0, histogram1.min());
+  EXPECT_FLOAT_EQ(2.0, histogram1.max());
+
+  histogram1.merge(MinMaxHistogram(16));
+  EXPECT_DOUBLE_EQ(100, histogram1.total());
+}
+
+TEST(MinMaxHistogramTest, constant)
+{
+  MinMaxHistogram histogram(16);
+
+  std::vector<float> values(10, 3.0);
+  histogram.add(values.data(), values.size());
+
+  auto entropy = getEntropyRange(histogram, 256);
+  EXPECT_FLOAT_EQ(3.0, entropy.first);
+  EXPECT_FLOAT_EQ(3.0, entropy.second);
+
+  auto mse = getMSERange(histogram, 256);
+  EXPECT_FLOAT_EQ(3.0, mse.first);
+  EXPECT_FLOAT_EQ(3.0, mse.second);
+}
+
+TEST(MinMaxHistogramTest, clip_outlier)
+{
+  MinMaxHistogram histogram(2048);
+
+  std::mt19937 gen(0);
+  std::normal_distribution<float> dist(0.0, 1.0);
+  std::vector<float> values(100000);
+  for (auto &value : values)
+    value = dist(gen);
+  // Outliers
+  values[0] = -100.0;
+  values[1] = 100.0;
+  histogram.add(values.data(), values.size());
+
+  auto entropy = getEntropyRange(histogram, 256);
+  EXPECT_GT(entropy.first, -100.0);
+  EXPECT_LT(entropy.second, 100.0);
+  EXPECT_LT(entropy.first, entropy.second);
+
+  auto mse = getMSERange(histogram, 256);
+  EXPECT_GT(mse.first, -100.0);
+  EXPECT_LT(mse.second, 100.0);
+  EXPECT_LT(mse.first, -1.0);
+  EXPECT_GT(mse.second, 1.0);
+}
+
+TEST(MinMaxHistogramTest, zero_bins_NEG) { EXPECT_ANY_THROW(MinMaxHistogram histogram(0)); }
+
+TEST(MinMaxHistogramTest, empty_range_NEG)
+{
+  MinMaxHistogram histogram(16);
+
+  EXPECT_ANY_THROW(getEntropyRange(histogram, 256));
+  EXPECT_ANY_THROW(getMSERange(histogram, 256));
+}
@@ -18,6 +18,8 @@
 #ifndef __NNFW_CKER_CPU_BACKEND_THREADPOOL_H_
 #define __NNFW_CKER_CPU_BACKEND_THREADPOOL_H_
 
+#include "cker/IntraOpThreadPool.h"
+
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
@@ -32,6 +34,8 @@ namespace cpu_backend_threadpool
 
 using Task = ruy::Task;
 
+// Tasks run on the process-wide IntraOpThreadPool instead of the thread pool of ruy_context.
+// ruy_context still decides the maximum number of tasks.
 template <typename TaskType>
 void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
 {
@@ -41,7 +45,9 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   {
     throw std::runtime_error("CpuBackendThreadpool.h: ruy::Context is null");
   }
-  ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
+
+  // Tasks are independent, so they run on the workers idle now or on the caller alone
+  GetIntraOpThreadPool().parallelFor(tasks_count, [&](int i) { tasks[i].Run(); });
 }
 
 } // namespace cpu_backend_threadpool
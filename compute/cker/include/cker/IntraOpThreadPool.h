@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_INTRA_OP_THREAD_POOL_H__
+#define __NNFW_CKER_INTRA_OP_THREAD_POOL_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Worker pool shared by parallel kernels in the process
+ *
+ * Kernels split their work into tasks and dispatch them here instead of owning threads, so
+ * several kernels or sessions running at the same time don't oversubscribe the cores.
+ *
+ * - execute() runs a fork-join region. The caller runs task 0 and each of the other tasks runs on
+ *   its own worker at the same time, so tasks can wait for each other (e.g. on a barrier).
+ *   A region starts when enough workers are idle, and regions of different callers run at the
+ *   same time as long as workers are left.
+ * - parallelFor() runs independent tasks on the caller and the workers idle at the moment. It
+ *   runs all of them on the caller when the pool is busy.
+ * - schedule() queues an independent task (used by Eigen ThreadPoolDevice).
+ *
+ * Idle workers spin for a while before they park on a condition variable, so back-to-back
+ * kernels don't pay for a wake-up. Workers can be added while the pool is in use, but never
+ * removed.
+ */
+class IntraOpThreadPool
+{
+public:
+  /**
+   * @param num_threads Number of worker threads
+   * @param pin_threads Pin worker i to core i (only on linux)
+   */
+  IntraOpThreadPool(int num_threads, bool pin_threads = false)
+  {
+    assert(num_threads > 0);
+    reserve(num_threads, pin_threads);
+  }
+
+  ~IntraOpThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+      _stop = true;
+    }
+    _cv.notify_all();
+    for (auto &&thread : _threads)
+      thread.join();
+  }
+
+  IntraOpThreadPool(const IntraOpThreadPool &) = delete;
+  IntraOpThreadPool &operator=(const IntraOpThreadPool &) = delete;
+
+public:
+  /**
+   * @brief Number of worker threads
+   */
+  int numThreads() const { return _num_threads.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Add workers so that the pool has at least num_threads workers
+   *
+   * @param num_threads Number of worker threads
+   * @param pin_threads Pin new worker i to core i (only on linux)
+   */
+  void reserve(int num_threads, bool pin_threads = false)
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    const int old_num_threads = numThreads();
+    if (num_threads <= old_num_threads)
+      return;
+    for (int i = old_num_threads; i < num_threads; ++i)
+      _threads.emplace_back(&IntraOpThreadPool::work, this, i, pin_threads);
+    _num_threads.store(num_threads, std::memory_order_release);
+    // execute() callers may be waiting for more idle workers than there were
+    if (_num_waiting > 0)
+      _cv_idle.notify_all();
+  }
+
+  /**
+   * @brief Maximum number of tasks in a region of execute(), including the caller's
+   */
+  int maxConcurrency() const { return numThreads() + 1; }
+
+  /**
+   * @brief Number of tasks a region can run at once now, including the caller's
+   */
+  int availableConcurrency()
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    return numIdleWorkers() + 1;
+  }
+
+  /**
+   * @brief Index of the current worker thread in this pool, or -1 if it is not a worker
+   */
+  int currentThreadId() const
+  {
+    const auto &current = currentWorker();
+    return current.pool == this ? current.index : -1;
+  }
+
+  /**
+   * @brief Run fn(0), ..., fn(num_tasks - 1) concurrently and wait for all of them
+   *
+   * @param num_tasks Number of tasks, must not exceed maxConcurrency()
+   * @param fn        Callable taking the task index
+   */
+  template <typename Fn> void execute(int num_tasks, Fn &&fn)
+  {
+    assert(num_tasks <= maxConcurrency());
+    // A worker waiting for a region would never let the region be finished
+    assert(currentThreadId() == -1);
+    if (num_tasks <= 0)
+      return;
+    if (num_tasks == 1)
+    {
+      fn(0);
+      return;
+    }
+
+    Region<Fn> region{fn, num_tasks - 1};
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      ++_num_waiting;
+      _cv_idle.wait(lock, [&] { return numIdleWorkers() >= num_tasks - 1; });
+      --_num_waiting;
+      push(&region, 1, num_tasks);
+    }
+
+    fn(0);
+    region.wait();
+  }
+
+  /**
+   * @brief Run fn(0), ..., fn(num_tasks - 1) on the caller and idle workers, and wait for all
+   *        of them. Tasks must not wait for each other.
+   *
+   * @param num_tasks Number of tasks, not limited by the pool size
+   * @param fn        Callable taking the task index
+   */
+  template <typename Fn> void parallelFor(int num_tasks, Fn &&fn)
+  {
+    assert(currentThreadId() == -1);
+    std::atomic<int> next{0};
+    auto run_tasks = [&](int) {
+      for (int i = next.fetch_add(1); i < num_tasks; i = next.fetch_add(1))
+        fn(i);
+    };
+
+    Region<decltype(run_tasks)> region{run_tasks, 0};
+    if (num_tasks > 1)
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+      const int num_helpers = std::min(num_tasks - 1, numIdleWorkers());
+      region.remaining.store(num_helpers, std::memory_order_relaxed);
+      push(&region, 0, num_helpers);
+    }
+
+    run_tasks(0);
+    region.wait();
+  }
+
+  /**
+   * @brief Queue an independent task
+   */
+  void schedule(std::function<void()> fn)
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _tasks.emplace_back(Task{&runFunction, new std::function<void()>{std::move(fn)}, 0});
+    _num_tasks.fetch_add(1, std::memory_order_release);
+    wakeUp(1);
+  }
+
+private:
+  struct Task
+  {
+    void (*run)(void *data, int index);
+    void *data;
+    int index;
+  };
+
+  struct Worker
+  {
+    const IntraOpThreadPool *pool = nullptr;
+    int index = -1;
+  };
+
+  template <typename Fn> struct Region
+  {
+    Region(Fn &fn, int num_tasks) : fn{fn}, remaining{num_tasks} {}
+
+    static void run(void *data, int index)
+    {
+      auto region = static_cast<Region *>(data);
+      region->fn(index);
+      // Notify under the lock: the caller takes it before it returns and destroys the region
+      std::lock_guard<std::mutex> lock{region->mu};
+      if (region->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        region->cv.notify_one();
+    }
+
+    void wait()
+    {
+      for (int i = 0; i < kSpinCount && remaining.load(std::memory_order_acquire) > 0; ++i)
+        relax();
+      std::unique_lock<std::mutex> lock{mu};
+      cv.wait(lock, [this] { return remaining.load(std::memory_order_acquire) == 0; });
+    }
+
+    Fn &fn;
+    std::atomic<int> remaining;
+    std::mutex mu;
+    std::condition_variable cv;
+  };
+
+  static constexpr int kSpinCount = 1 << 14;
+
+  static void runFunction(void *data, int)
+  {
+    auto fn = static_cast<std::function<void()> *>(data);
+    (*fn)();
+    delete fn;
+  }
+
+  static Worker &currentWorker()
+  {
+    static thread_local Worker worker;
+    return worker;
+  }
+
+  static void relax()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  static void pin(int index)
+  {
+#if defined(__linux__)
+    const auto num_cores = std::thread::hardware_concurrency();
+    if (num_cores == 0)
+      return;
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(index % num_cores, &cpuset);
+    // Pinning is a hint: ignore failure (e.g. restricted by cgroup)
+    sched_setaffinity(0, sizeof(cpuset), &cpuset);
+#else
+    (void)index;
+#endif
+  }
+
+  // It should be called with _mu locked.
+  // Queued tasks are counted as busy, as each of them takes an idle worker soon.
+  int numIdleWorkers() const
+  {
+    return std::max(numThreads() - _num_busy - static_cast<int>(_tasks.size()), 0);
+  }
+
+  // It should be called with _mu locked
+  template <typename R> void push(R *region, int begin, int end)
+  {
+    if (begin >= end)
+      return;
+    for (int i = begin; i < end; ++i)
+      _tasks.emplace_back(Task{&R::run, region, i});
+    _num_tasks.fetch_add(end - begin, std::memory_order_release);
+    wakeUp(end - begin);
+  }
+
+  // It should be called with _mu locked
+  void wakeUp(int num_tasks)
+  {
+    if (_num_parked == 0)
+      return;
+    if (num_tasks == 1)
+      _cv.notify_one();
+    else
+      _cv.notify_all();
+  }
+
+  bool pop(Task &task)
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    if (_tasks.empty())
+      return false;
+    task = _tasks.front();
+    _tasks.pop_front();
+    _num_tasks.fetch_sub(1, std::memory_order_relaxed);
+    ++_num_busy;
+    return true;
+  }
+
+  void done()
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    --_num_busy;
+    if (_num_waiting > 0)
+      _cv_idle.notify_all();
+  }
+
+  void work(int index, bool pin_threads)
+  {
+    currentWorker() = Worker{this, index};
+    if (pin_threads)
+      pin(index);
+
+    while (true)
+    {
+      Task task;
+      if (pop(task))
+      {
+        task.run(task.data, task.index);
+        done();
+        continue;
+      }
+
+      // Spin before parking: kernels usually come back-to-back
+      bool found = false;
+      for (int i = 0; i < kSpinCount && !found; ++i)
+      {
+        found = _num_tasks.load(std::memory_order_acquire) > 0;
+        if (!found)
+          relax();
+      }
+      if (found)
+        continue;
+
+      std::unique_lock<std::mutex> lock{_mu};
+      ++_num_parked;
+      _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+      --_num_parked;
+      if (_stop && _tasks.empty())
+        return;
+    }
+  }
+
+private:
+  // Threads are only added with _mu locked, and joined on destruction
+  std::vector<std::thread> _threads;
+  std::atomic<int> _num_threads{0};
+  std::deque<Task> _tasks;
+  // Number of tasks in _tasks, to check for tasks without lock while spinning
+  std::atomic<int> _num_tasks{0};
+  int _num_parked = 0;
+  // Number of workers running a task
+  int _num_busy = 0;
+  // Number of execute() callers waiting for idle workers
+  int _num_waiting = 0;
+  bool _stop = false;
+  std::mutex _mu;
+  std::condition_variable _cv;
+  std::condition_variable _cv_idle;
+};
+
+/**
+ * @brief Get the process-wide pool
+ *
+ * Runtime backends call it with their thread configuration when they are created, before any of
+ * their kernels runs, and kernels call it without parameters. The first call creates the pool.
+ * A later call asking for more threads (e.g. a session with larger NUM_THREADS) adds workers,
+ * while a call asking for fewer threads leaves the pool as it is. Kernels still limit their
+ * number of tasks by their own thread configuration.
+ *
+ * @param num_threads Number of threads a kernel runs on, including the caller. The pool has one
+ *                    worker per core if it is not positive.
+ * @param pin_threads Pin worker threads to cores
+ */
+inline IntraOpThreadPool &GetIntraOpThreadPool(int num_threads = -1, bool pin_threads = false)
+{
+  const int num_workers = [num_threads] {
+    if (num_threads > 0)
+      return std::max(num_threads - 1, 1);
+    const int num_cores = std::thread::hardware_concurrency();
+    return num_cores > 0 ? num_cores : 4;
+  }();
+  static IntraOpThreadPool pool{num_workers, pin_threads};
+  if (num_threads > 0)
+    pool.reserve(num_workers, pin_threads);
+  return pool;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_INTRA_OP_THREAD_POOL_H__
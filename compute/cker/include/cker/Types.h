@@ -53,6 +53,12 @@ enum class BinaryArithmeticOpType
   POW = 4,
 };
 
+enum class RoPEMode
+{
+  kGptNeox = 0,
+  kGptJ = 1,
+};
+
 enum class ComparisonOpType
 {
   Equal,
@@ -269,6 +275,18 @@ struct FullyConnectedParams
   // FullyConnectedWeightsFormat weights_format;
 };
 
+struct BatchMatMulParams
+{
+  // uint8, int8 inference params. Offsets are negated zero points except output_offset.
+  int32_t lhs_offset;
+  int32_t rhs_offset;
+  int32_t output_offset;
+  int32_t output_multiplier;
+  int output_shift;
+  int32_t quantized_activation_min;
+  int32_t quantized_activation_max;
+};
+
 struct L2NormParams
 {
   // uint8 inference params.
@@ -308,6 +326,11 @@ struct InstanceNormParams
   float float_activation_max;
 };
 
+struct RmsNormParams
+{
+  float epsilon;
+};
+
 struct ResizeBilinearParams
 {
   int32_t output_height;
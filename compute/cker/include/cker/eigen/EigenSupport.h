@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 #include <thread>
+#include "cker/IntraOpThreadPool.h"
 #include "cker/eigen/eigen_spatial_convolutions.h"
 
 #ifdef EIGEN_USE_THREADS
@@ -67,37 +68,42 @@ template <typename Device, typename T> struct MatMulConvFunctor
 // that inferences started from different threads may block each other, but
 // since the underlying resource of CPU cores should be consumed by the
 // operations anyway, it shouldn't affect overall performance.
+// The threadpool is the process-wide IntraOpThreadPool, which other parallel
+// kernels also dispatch into.
 class EigenThreadPoolWrapper : public Eigen::ThreadPoolInterface
 {
 public:
-  // Takes ownership of 'pool'
-  explicit EigenThreadPoolWrapper(Eigen::ThreadPool *pool) : pool_(pool) {}
+  explicit EigenThreadPoolWrapper(IntraOpThreadPool *pool)
+    : pool_(pool), num_threads_(pool->numThreads())
+  {
+  }
   ~EigenThreadPoolWrapper() override {}
 
-  void Schedule(std::function<void()> fn) override { pool_->Schedule(std::move(fn)); }
-  int NumThreads() const override { return pool_->NumThreads(); }
-  int CurrentThreadId() const override { return pool_->CurrentThreadId(); }
+  void Schedule(std::function<void()> fn) override { pool_->schedule(std::move(fn)); }
+  int NumThreads() const override { return num_threads_; }
+  // Workers added to the pool later are out of the range Eigen knows, so they are not named
+  int CurrentThreadId() const override
+  {
+    const int id = pool_->currentThreadId();
+    return id < num_threads_ ? id : -1;
+  }
 
 private:
-  std::unique_ptr<Eigen::ThreadPool> pool_;
+  IntraOpThreadPool *pool_;
+  const int num_threads_;
 };
 
 struct EigenContext
 {
-  constexpr static int default_num_threadpool_threads = 4;
   std::unique_ptr<Eigen::ThreadPoolInterface> thread_pool_wrapper;
   std::unique_ptr<Eigen::ThreadPoolDevice> device;
 
   EigenContext()
   {
-    int num_threads = std::thread::hardware_concurrency();
-    if (num_threads == 0)
-    {
-      num_threads = default_num_threadpool_threads;
-    }
+    auto &pool = GetIntraOpThreadPool();
     device.reset(); // destroy before we invalidate the thread pool
-    thread_pool_wrapper.reset(new EigenThreadPoolWrapper(new Eigen::ThreadPool(num_threads)));
-    device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
+    thread_pool_wrapper.reset(new EigenThreadPoolWrapper(&pool));
+    device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), pool.numThreads()));
   }
 
   static inline EigenContext &GetEigenContext()
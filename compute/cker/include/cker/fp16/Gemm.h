@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_GEMM_H__
+#define __NNFW_CKER_FP16_GEMM_H__
+
+#include "cker/fp16/Utils.h"
+#include "cker/IntraOpThreadPool.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+// Weights are packed in single precision by panels of kGemmPanelWidth units, each of which is
+// stored depth-major so that the micro kernel reads one contiguous vector per depth.
+constexpr int kGemmPanelWidth = 8;
+// Rows of the micro kernel, which reuses each weight vector for all of them
+constexpr int kGemmMicroRows = 4;
+// Rows converted to single precision at once by a task
+constexpr int kGemmBlockRows = 16;
+
+inline int PackedWeightsSize(int num_units, int depth)
+{
+  return (num_units + kGemmPanelWidth - 1) / kGemmPanelWidth * kGemmPanelWidth * depth;
+}
+
+/**
+ * Pack weights of num_units x depth, whose element (u, d) is weights[u * unit_stride +
+ * d * depth_stride], for Gemm(). packed must hold PackedWeightsSize() floats.
+ */
+inline void PackWeights(const Half *weights, int num_units, int depth, int unit_stride,
+                        int depth_stride, float *packed)
+{
+  for (int unit = 0; unit < num_units; unit += kGemmPanelWidth)
+  {
+    const int width = std::min(kGemmPanelWidth, num_units - unit);
+    float *panel = packed + unit * depth;
+    for (int d = 0; d < depth; ++d)
+    {
+      float *dst = panel + d * kGemmPanelWidth;
+      const Half *src = weights + unit * unit_stride + d * depth_stride;
+      if (unit_stride == 1)
+        ToFloat(src, dst, width);
+      else
+      {
+        for (int j = 0; j < width; ++j)
+          dst[j] = static_cast<float>(src[j * unit_stride]);
+      }
+      std::fill(dst + width, dst + kGemmPanelWidth, 0.0f);
+    }
+  }
+}
+
+// Pack row-major weights of [num_units, depth], e.g. FullyConnected weights or OHWI filter
+inline void PackWeights(const Half *weights, int num_units, int depth, float *packed)
+{
+  PackWeights(weights, num_units, depth, depth, 1, packed);
+}
+
+namespace gemm
+{
+
+// acc[i][j] = sum over depth of lhs[i][d] * panel[d][j]
+template <int Rows>
+inline void MicroKernel(const float *lhs, int depth, const float *panel,
+                        float (&acc)[kGemmMicroRows][kGemmPanelWidth])
+{
+  float sum[Rows][kGemmPanelWidth] = {};
+  for (int d = 0; d < depth; ++d)
+  {
+    const float *w = panel + d * kGemmPanelWidth;
+    for (int i = 0; i < Rows; ++i)
+    {
+      const float a = lhs[i * depth + d];
+      for (int j = 0; j < kGemmPanelWidth; ++j)
+        sum[i][j] += a * w[j];
+    }
+  }
+  for (int i = 0; i < Rows; ++i)
+    std::copy(sum[i], sum[i] + kGemmPanelWidth, acc[i]);
+}
+
+inline void MicroKernel(int rows, const float *lhs, int depth, const float *panel,
+                        float (&acc)[kGemmMicroRows][kGemmPanelWidth])
+{
+  static_assert(kGemmMicroRows == 4, "MicroKernel is unrolled for 4 rows");
+  switch (rows)
+  {
+    case 1:
+      MicroKernel<1>(lhs, depth, panel, acc);
+      break;
+    case 2:
+      MicroKernel<2>(lhs, depth, panel, acc);
+      break;
+    case 3:
+      MicroKernel<3>(lhs, depth, panel, acc);
+      break;
+    default:
+      MicroKernel<4>(lhs, depth, panel, acc);
+      break;
+  }
+}
+
+} // namespace gemm
+
+/**
+ * output[r][u] = clamp(sum over d of lhs[r][d] * weights[u][d] + bias[u]) for rows x num_units,
+ * where weights are packed by PackWeights() and bias may be null.
+ *
+ * lhs is not read directly: fill_rows(row, count, dst) writes rows [row, row + count) of lhs to
+ * dst in single precision, depth floats per row, so that callers can gather them (e.g. im2col).
+ * Blocks of rows and panels of units are split into tasks of the intra-op thread pool.
+ */
+template <typename FillRows>
+inline void Gemm(int rows, int depth, int num_units, FillRows &&fill_rows,
+                 const float *packed_weights, const Half *bias_data, float activation_min,
+                 float activation_max, Half *output_data)
+{
+  if (rows <= 0 || num_units <= 0)
+    return;
+
+  std::vector<float> bias(num_units, 0.0f);
+  if (bias_data)
+    ToFloat(bias_data, bias.data(), num_units);
+
+  auto &pool = GetIntraOpThreadPool();
+  const int num_row_blocks = (rows + kGemmBlockRows - 1) / kGemmBlockRows;
+  const int num_panels = (num_units + kGemmPanelWidth - 1) / kGemmPanelWidth;
+  // Split units too when there are few rows (e.g. FullyConnected of batch 1), so that every
+  // thread has a few tasks to balance the load
+  const int min_tasks = 4 * pool.maxConcurrency();
+  const int num_unit_blocks =
+    std::min(num_panels, std::max(1, (min_tasks + num_row_blocks - 1) / num_row_blocks));
+  const int panels_per_task = (num_panels + num_unit_blocks - 1) / num_unit_blocks;
+  const int num_unit_tasks = (num_panels + panels_per_task - 1) / panels_per_task;
+
+  pool.parallelFor(num_row_blocks * num_unit_tasks, [&](int task) {
+    const int row_begin = task / num_unit_tasks * kGemmBlockRows;
+    const int block_rows = std::min(kGemmBlockRows, rows - row_begin);
+    const int panel_begin = task % num_unit_tasks * panels_per_task;
+    const int panel_end = std::min(panel_begin + panels_per_task, num_panels);
+
+    thread_local std::vector<float> lhs;
+    lhs.resize(static_cast<size_t>(kGemmBlockRows) * depth);
+    fill_rows(row_begin, block_rows, lhs.data());
+
+    float acc[kGemmMicroRows][kGemmPanelWidth];
+    float result[kGemmPanelWidth];
+    for (int panel = panel_begin; panel < panel_end; ++panel)
+    {
+      const int unit = panel * kGemmPanelWidth;
+      const int width = std::min(kGemmPanelWidth, num_units - unit);
+      const float *weights = packed_weights + static_cast<size_t>(unit) * depth;
+      for (int i = 0; i < block_rows; i += kGemmMicroRows)
+      {
+        const int micro_rows = std::min(kGemmMicroRows, block_rows - i);
+        gemm::MicroKernel(micro_rows, lhs.data() + i * depth, depth, weights, acc);
+        for (int r = 0; r < micro_rows; ++r)
+        {
+          for (int j = 0; j < width; ++j)
+            result[j] = ActivationMinMax(acc[r][j] + bias[unit + j], activation_min,
+                                         activation_max);
+          FromFloat(result, output_data + static_cast<size_t>(row_begin + i + r) * num_units + unit,
+                    width);
+        }
+      }
+    }
+  });
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_GEMM_H__
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_UTILS_H__
+#define __NNFW_CKER_FP16_UTILS_H__
+
+#include "cker/neon/neon_check.h"
+
+#include <Half.h>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+// fp16 kernels keep tensors in half precision and compute in single precision, as accumulating
+// in half precision loses too much accuracy. Only elementwise kernels compute in half precision
+// when the target has half precision vector arithmetic (ARMv8.2-A FP16).
+#if defined(USE_NEON) && defined(__aarch64__)
+#define CKER_FP16_NEON
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#define CKER_FP16_ARITHMETIC
+#endif
+#endif
+
+static_assert(sizeof(Half) == 2, "Half must be stored in 2 bytes");
+
+inline void ToFloat(const Half *input, float *output, int size)
+{
+  int i = 0;
+#ifdef CKER_FP16_NEON
+  const auto in = reinterpret_cast<const float16_t *>(input);
+  for (; i <= size - 4; i += 4)
+    vst1q_f32(output + i, vcvt_f32_f16(vld1_f16(in + i)));
+#endif
+  for (; i < size; ++i)
+    output[i] = static_cast<float>(input[i]);
+}
+
+inline void FromFloat(const float *input, Half *output, int size)
+{
+  int i = 0;
+#ifdef CKER_FP16_NEON
+  auto out = reinterpret_cast<float16_t *>(output);
+  for (; i <= size - 4; i += 4)
+    vst1_f16(out + i, vcvt_f16_f32(vld1q_f32(input + i)));
+#endif
+  for (; i < size; ++i)
+    output[i] = Half(input[i]);
+}
+
+// Dot product of single precision and half precision vectors, accumulated in single precision
+inline float Dot(const float *lhs, const Half *rhs, int size)
+{
+  int i = 0;
+  float sum = 0.0f;
+#ifdef CKER_FP16_NEON
+  const auto r = reinterpret_cast<const float16_t *>(rhs);
+  float32x4_t acc = vdupq_n_f32(0.0f);
+  for (; i <= size - 4; i += 4)
+    acc = vfmaq_f32(acc, vld1q_f32(lhs + i), vcvt_f32_f16(vld1_f16(r + i)));
+  sum = vaddvq_f32(acc);
+#endif
+  for (; i < size; ++i)
+    sum += lhs[i] * static_cast<float>(rhs[i]);
+  return sum;
+}
+
+inline float ActivationMinMax(float x, float min, float max)
+{
+  return x < min ? min : (x > max ? max : x);
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_UTILS_H__
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_OPERATION_BATCH_MATMUL_H__
+#define __NNFW_CKER_FP16_OPERATION_BATCH_MATMUL_H__
+
+#include "cker/fp16/Gemm.h"
+#include "cker/fp16/Utils.h"
+#include "cker/operation/BatchMatMul.h"
+#include "cker/Shape.h"
+
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+/**
+ * lhs is [..., rows, depth] ([..., depth, rows] if adj_x) and rhs is [..., depth, cols]
+ * ([..., cols, depth] if adj_y), with broadcast batch dimensions. rhs of each batch is packed as
+ * the weights of a GEMM, whose units are the output columns.
+ */
+inline void BatchMatMul(const Shape &lhs_shape, const Half *lhs_data, const Shape &rhs_shape,
+                        const Half *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                        Half *output_data)
+{
+  const auto batch_dims = batch_matmul::GetBatchDims(lhs_shape, rhs_shape);
+  const int rank = output_shape.DimensionsCount();
+  const int rows = output_shape.Dims(rank - 2);
+  const int cols = output_shape.Dims(rank - 1);
+  const int depth = lhs_shape.Dims(lhs_shape.DimensionsCount() - (adj_x ? 2 : 1));
+  assert(depth == rhs_shape.Dims(rhs_shape.DimensionsCount() - (adj_y ? 1 : 2)));
+
+  std::vector<float> packed_rhs(PackedWeightsSize(cols, depth));
+  const Half *prev_rhs = nullptr;
+  for (int batch = 0; batch < batch_dims.count(); ++batch)
+  {
+    const Half *lhs = lhs_data + batch_dims.lhsOffset(batch);
+    const Half *rhs = rhs_data + batch_dims.rhsOffset(batch);
+    Half *output = output_data + static_cast<int64_t>(batch) * rows * cols;
+
+    // rhs is shared by broadcast batches, so pack only when it changes
+    if (rhs != prev_rhs)
+    {
+      if (adj_y)
+        PackWeights(rhs, cols, depth, packed_rhs.data());
+      else
+        PackWeights(rhs, cols, depth, 1, cols, packed_rhs.data());
+      prev_rhs = rhs;
+    }
+
+    auto fill_rows = [&](int row, int count, float *dst) {
+      if (adj_x)
+      {
+        for (int r = row; r < row + count; ++r)
+        {
+          for (int d = 0; d < depth; ++d)
+            *dst++ = static_cast<float>(lhs[d * rows + r]);
+        }
+      }
+      else
+        ToFloat(lhs + row * depth, dst, count * depth);
+    };
+    Gemm(rows, depth, cols, fill_rows, packed_rhs.data(), nullptr,
+         std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max(), output);
+  }
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_OPERATION_BATCH_MATMUL_H__
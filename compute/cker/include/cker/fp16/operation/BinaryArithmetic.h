@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_OPERATION_BINARY_ARITHMETIC_H__
+#define __NNFW_CKER_FP16_OPERATION_BINARY_ARITHMETIC_H__
+
+#include "cker/fp16/Utils.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+template <BinaryArithmeticOpType op_type> inline float BinaryArithmeticFn(float a, float b)
+{
+  switch (op_type)
+  {
+    case BinaryArithmeticOpType::ADD:
+      return a + b;
+    case BinaryArithmeticOpType::SUB:
+      return a - b;
+    case BinaryArithmeticOpType::MUL:
+      return a * b;
+    case BinaryArithmeticOpType::DIV:
+      return a / b;
+    case BinaryArithmeticOpType::POW:
+      return std::pow(a, b);
+    default:
+      throw std::runtime_error{"fp16::BinaryArithmeticOp: Unsupported OpType"};
+  }
+}
+
+#ifdef CKER_FP16_ARITHMETIC
+template <BinaryArithmeticOpType op_type>
+inline float16x8_t BinaryArithmeticFn(float16x8_t a, float16x8_t b)
+{
+  switch (op_type)
+  {
+    case BinaryArithmeticOpType::ADD:
+      return vaddq_f16(a, b);
+    case BinaryArithmeticOpType::SUB:
+      return vsubq_f16(a, b);
+    case BinaryArithmeticOpType::MUL:
+      return vmulq_f16(a, b);
+    case BinaryArithmeticOpType::DIV:
+      return vdivq_f16(a, b);
+    default:
+      throw std::runtime_error{"fp16::BinaryArithmeticOp: Unsupported OpType"};
+  }
+}
+#endif
+
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const Half *input1_data, const Shape &input2_shape,
+                               const Half *input2_data, const Shape &output_shape,
+                               Half *output_data)
+{
+  const int size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  const float act_min = params.float_activation_min;
+  const float act_max = params.float_activation_max;
+
+  int i = 0;
+#ifdef CKER_FP16_ARITHMETIC
+  if (op_type != BinaryArithmeticOpType::POW)
+  {
+    const auto in1 = reinterpret_cast<const float16_t *>(input1_data);
+    const auto in2 = reinterpret_cast<const float16_t *>(input2_data);
+    auto out = reinterpret_cast<float16_t *>(output_data);
+    const float16x8_t min = vdupq_n_f16(static_cast<float16_t>(act_min));
+    const float16x8_t max = vdupq_n_f16(static_cast<float16_t>(act_max));
+    for (; i <= size - 8; i += 8)
+    {
+      const auto result = BinaryArithmeticFn<op_type>(vld1q_f16(in1 + i), vld1q_f16(in2 + i));
+      vst1q_f16(out + i, vminq_f16(vmaxq_f16(result, min), max));
+    }
+  }
+#endif
+  for (; i < size; ++i)
+  {
+    const float result = BinaryArithmeticFn<op_type>(input1_data[i], input2_data[i]);
+    output_data[i] = Half(ActivationMinMax(result, act_min, act_max));
+  }
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(const BinaryArithmeticOpParam &params,
+                                        const Shape &input1_shape, const Half *input1_data,
+                                        const Shape &input2_shape, const Half *input2_data,
+                                        const Shape &output_shape, Half *output_data)
+{
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error(
+      std::string("cker::fp16::BroadcastBinaryArithmeticOp: Unsupported rank size : ") +
+      std::to_string(output_shape.DimensionsCount()));
+
+  const float act_min = params.float_activation_min;
+  const float act_max = params.float_activation_max;
+  NdArrayDesc<4> desc1;
+  NdArrayDesc<4> desc2;
+  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          const float result =
+            BinaryArithmeticFn<op_type>(input1_data[SubscriptToIndex(desc1, b, y, x, c)],
+                                        input2_data[SubscriptToIndex(desc2, b, y, x, c)]);
+          output_data[Offset(extended_output_shape, b, y, x, c)] =
+            Half(ActivationMinMax(result, act_min, act_max));
+        }
+      }
+    }
+  }
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_OPERATION_BINARY_ARITHMETIC_H__
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_OPERATION_CONV_H__
+#define __NNFW_CKER_FP16_OPERATION_CONV_H__
+
+#include "cker/fp16/Gemm.h"
+#include "cker/fp16/Utils.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+/**
+ * Input and output are NHWC and filter is OHWI, packed by PackWeights() as [O, H * W * I].
+ * Each output pixel is a row of the GEMM, whose input patch is gathered in single precision
+ * (im2col) by the task that computes it.
+ */
+inline void Conv(const ConvParams &params, const Shape &input_shape, const Half *input_data,
+                 const Shape &filter_shape, const float *packed_filter, const Shape &bias_shape,
+                 const Half *bias_data, const Shape &output_shape, Half *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  if (bias_data)
+  {
+    assert(bias_shape.FlatSize() == output_depth);
+  }
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int patch_size = filter_height * filter_width * input_depth;
+
+  auto im2col = [&](int row, int count, float *patch) {
+    for (int pixel = row; pixel < row + count; ++pixel)
+    {
+      const int out_x = pixel % output_width;
+      const int out_y = pixel / output_width % output_height;
+      const int batch = pixel / output_width / output_height;
+      const int in_x_origin = (out_x * stride_width) - pad_width;
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + dilation_height_factor * filter_y;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + dilation_width_factor * filter_x;
+          if ((in_x >= 0) && (in_x < input_width) && (in_y >= 0) && (in_y < input_height))
+            ToFloat(input_data + Offset(input_shape, batch, in_y, in_x, 0), patch, input_depth);
+          else
+            std::fill(patch, patch + input_depth, 0.0f);
+          patch += input_depth;
+        }
+      }
+    }
+  };
+
+  Gemm(batches * output_height * output_width, patch_size, output_depth, im2col, packed_filter,
+       bias_data, params.float_activation_min, params.float_activation_max, output_data);
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_OPERATION_CONV_H__
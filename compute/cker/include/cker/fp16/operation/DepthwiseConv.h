@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_OPERATION_DEPTHWISE_CONV_H__
+#define __NNFW_CKER_FP16_OPERATION_DEPTHWISE_CONV_H__
+
+#include "cker/fp16/Utils.h"
+#include "cker/IntraOpThreadPool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+/**
+ * Input and output are NHWC and filter is [1, H, W, input_depth * depth_multiplier]. The filter
+ * is converted to single precision once, and rows of the output are split into tasks of the
+ * intra-op thread pool. Each output pixel accumulates all of its channels at once.
+ */
+inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                          const Half *input_data, const Shape &filter_shape,
+                          const Half *filter_data, const Shape &bias_shape, const Half *bias_data,
+                          const Shape &output_shape, Half *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_depth * depth_multiplier);
+  if (bias_data)
+  {
+    assert(bias_shape.FlatSize() == output_depth);
+  }
+
+  std::vector<float> filter(filter_height * filter_width * output_depth);
+  ToFloat(filter_data, filter.data(), filter.size());
+  std::vector<float> bias(output_depth, 0.0f);
+  if (bias_data)
+    ToFloat(bias_data, bias.data(), output_depth);
+
+  GetIntraOpThreadPool().parallelFor(batches * output_height, [&](int task) {
+    const int b = task / output_height;
+    const int out_y = task % output_height;
+    thread_local std::vector<float> buffer;
+    buffer.resize(input_depth + output_depth);
+    float *input = buffer.data();
+    float *acc = input + input_depth;
+    for (int out_x = 0; out_x < output_width; ++out_x)
+    {
+      const int in_x_origin = (out_x * stride_width) - pad_width;
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      std::copy(bias.begin(), bias.end(), acc);
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + dilation_height_factor * filter_y;
+        if (in_y < 0 || in_y >= input_height)
+          continue;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + dilation_width_factor * filter_x;
+          if (in_x < 0 || in_x >= input_width)
+            continue;
+          ToFloat(input_data + Offset(input_shape, b, in_y, in_x, 0), input, input_depth);
+          const float *tap = filter.data() + (filter_y * filter_width + filter_x) * output_depth;
+          if (depth_multiplier == 1)
+          {
+            for (int oc = 0; oc < output_depth; ++oc)
+              acc[oc] += input[oc] * tap[oc];
+          }
+          else
+          {
+            for (int ic = 0; ic < input_depth; ++ic)
+            {
+              for (int m = 0; m < depth_multiplier; ++m)
+              {
+                const int oc = m + ic * depth_multiplier;
+                acc[oc] += input[ic] * tap[oc];
+              }
+            }
+          }
+        }
+      }
+
+      for (int oc = 0; oc < output_depth; ++oc)
+        acc[oc] = ActivationMinMax(acc[oc], output_activation_min, output_activation_max);
+      FromFloat(acc, output_data + Offset(output_shape, b, out_y, out_x, 0), output_depth);
+    }
+  });
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_OPERATION_DEPTHWISE_CONV_H__
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_OPERATION_FULLY_CONNECTED_H__
+#define __NNFW_CKER_FP16_OPERATION_FULLY_CONNECTED_H__
+
+#include "cker/fp16/Gemm.h"
+#include "cker/fp16/Utils.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+// weights of [num_units, input_size] are packed by PackWeights()
+inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                           const Half *input_data, const Shape &weights_shape,
+                           const float *packed_weights, const Shape &, const Half *bias_data,
+                           const Shape &output_shape, Half *output_data)
+{
+  const int weights_dims_count = weights_shape.DimensionsCount();
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int num_units = weights_shape.Dims(weights_dims_count - 2);
+  const int input_size = weights_shape.Dims(weights_dims_count - 1);
+  const int batch_size = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  UNUSED_RELEASE(input_shape);
+  assert(input_shape.FlatSize() == batch_size * input_size);
+  assert(output_shape.Dims(output_dims_count - 1) == num_units);
+
+  auto fill_rows = [&](int row, int count, float *dst) {
+    ToFloat(input_data + row * input_size, dst, count * input_size);
+  };
+  Gemm(batch_size, input_size, num_units, fill_rows, packed_weights, bias_data,
+       params.float_activation_min, params.float_activation_max, output_data);
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_OPERATION_FULLY_CONNECTED_H__
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_OPERATION_SOFTMAX_H__
+#define __NNFW_CKER_FP16_OPERATION_SOFTMAX_H__
+
+#include "cker/fp16/Utils.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fp16
+{
+
+// Softmax over the last dimension
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const Half *input_data,
+                    const Shape &output_shape, Half *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const float beta = static_cast<float>(params.beta);
+
+  std::vector<float> row(depth);
+  for (int i = 0; i < outer_size; ++i)
+  {
+    ToFloat(input_data + i * depth, row.data(), depth);
+
+    const float max = *std::max_element(row.begin(), row.end());
+    float sum = 0.0f;
+    for (int c = 0; c < depth; ++c)
+    {
+      row[c] = std::exp((row[c] - max) * beta);
+      sum += row[c];
+    }
+
+    const float reciprocal = 1.0f / sum;
+    for (int c = 0; c < depth; ++c)
+      row[c] *= reciprocal;
+
+    FromFloat(row.data(), output_data + i * depth, depth);
+  }
+}
+
+} // namespace fp16
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_OPERATION_SOFTMAX_H__
@@ -14,24 +14,142 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
 #ifndef __NNFW_CKER_BATCH_MATMUL_H__
 #define __NNFW_CKER_BATCH_MATMUL_H__
 
-#include "Transpose.h"
-
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
-#include "cker/operation/reference/BatchMatMul.h"
 
+#include <Eigen/Core>
+#include <ruy/matrix.h>
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
+namespace batch_matmul
+{
+
+// Batch dimensions of output, with strides of lhs and rhs for each of them.
+// The stride is 0 for a broadcast dimension.
+struct BatchDims
+{
+  int dims[3];
+  int lhs_strides[3];
+  int rhs_strides[3];
+
+  int count() const { return dims[0] * dims[1] * dims[2]; }
+  int lhsOffset(int batch) const { return offset(batch, lhs_strides); }
+  int rhsOffset(int batch) const { return offset(batch, rhs_strides); }
+
+private:
+  int offset(int batch, const int *strides) const
+  {
+    const int b2 = batch % dims[2];
+    const int b1 = (batch / dims[2]) % dims[1];
+    const int b0 = batch / (dims[2] * dims[1]);
+    return b0 * strides[0] + b1 * strides[1] + b2 * strides[2];
+  }
+};
+
+inline BatchDims GetBatchDims(const Shape &lhs_shape, const Shape &rhs_shape)
+{
+  const Shape extended_lhs_shape = Shape::ExtendedShape(5, lhs_shape);
+  const Shape extended_rhs_shape = Shape::ExtendedShape(5, rhs_shape);
+
+  BatchDims batch_dims;
+  int lhs_stride = extended_lhs_shape.Dims(3) * extended_lhs_shape.Dims(4);
+  int rhs_stride = extended_rhs_shape.Dims(3) * extended_rhs_shape.Dims(4);
+  for (int i = 2; i >= 0; --i)
+  {
+    const int lhs_dim = extended_lhs_shape.Dims(i);
+    const int rhs_dim = extended_rhs_shape.Dims(i);
+    assert(lhs_dim == rhs_dim || lhs_dim == 1 || rhs_dim == 1);
+    batch_dims.dims[i] = std::max(lhs_dim, rhs_dim);
+    batch_dims.lhs_strides[i] = lhs_dim == 1 ? 0 : lhs_stride;
+    batch_dims.rhs_strides[i] = rhs_dim == 1 ? 0 : rhs_stride;
+    lhs_stride *= lhs_dim;
+    rhs_stride *= rhs_dim;
+  }
+  return batch_dims;
+}
+
+// Number of tasks, each of which computes at least kMinMulPerThread multiplications
+inline int HowManyBatchMatMulThreads(int64_t num_muls, int64_t num_rows, ruy::Context *ruy_context)
+{
+  static constexpr int64_t kMinMulPerThread = 1 << 16;
+  // NOTE Borrow RuyContext to get max_num_threads setting
+  const int64_t max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  return static_cast<int>(
+    std::max<int64_t>(1, std::min({num_muls / kMinMulPerThread, max_threads, num_rows})));
+}
+
+// Each task computes rows of output in [start, end), where rows of all batches are flattened
+template <typename Fn> struct BatchMatMulWorkerTask : cpu_backend_threadpool::Task
+{
+  BatchMatMulWorkerTask(const Fn &fn, int start, int end) : fn_(fn), start_(start), end_(end) {}
+
+  void Run() override { fn_(start_, end_); }
+
+private:
+  const Fn &fn_;
+  int start_;
+  int end_;
+};
+
+// Call fn(batch, row_begin, row_end) for rows of each batch, in parallel if it is worth it
+template <typename Fn>
+void ParallelForRows(int num_batches, int rows, int64_t muls_per_row, ruy::Context *ruy_context,
+                     const Fn &fn)
+{
+  const int64_t total_rows = static_cast<int64_t>(num_batches) * rows;
+  auto run_range = [&](int start, int end) {
+    for (int row = start; row < end;)
+    {
+      const int batch = row / rows;
+      const int row_begin = row % rows;
+      const int row_end = std::min(rows, row_begin + (end - row));
+      fn(batch, row_begin, row_end);
+      row += row_end - row_begin;
+    }
+  };
 
+  const int thread_count =
+    HowManyBatchMatMulThreads(total_rows * muls_per_row, total_rows, ruy_context);
+  if (thread_count == 1)
+  {
+    run_range(0, static_cast<int>(total_rows));
+    return;
+  }
+
+  std::vector<BatchMatMulWorkerTask<decltype(run_range)>> tasks;
+  tasks.reserve(thread_count);
+  for (int i = 0; i < thread_count; ++i)
+  {
+    const int start = static_cast<int>(total_rows * i / thread_count);
+    const int end = static_cast<int>(total_rows * (i + 1) / thread_count);
+    tasks.emplace_back(run_range, start, end);
+  }
+  cpu_backend_threadpool::Execute(thread_count, tasks.data(), ruy_context);
+}
+
+} // namespace batch_matmul
+
+/**
+ * @brief BatchMatMul computing lhs x rhs for each batch, with broadcasting batch dimensions
+ *
+ * lhs is [..., rows, depth] ([..., depth, rows] if adj_x) and rhs is [..., depth, cols]
+ * ([..., cols, depth] if adj_y). Matrices are read in place through their layouts, without
+ * transposing them. Float rows of all batches are split across threads. Quantized batches are
+ * multiplied by ruy, which splits each of them across threads of ruy_context.
+ */
 class BatchMatMul
 {
 public:
@@ -41,103 +159,108 @@ public:
   }
 
   /**
-   * @brief   Prepare temporary area for calculation
+   * @brief Mark quantized rhs as constant, so that ruy caches it packed after the first run
    */
-  void prepare(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y)
+  template <typename T> void prepareConstantRhs(const T *rhs_data)
   {
-    if (adj_x)
-    {
-      int32_t rank = lhs_shape.DimensionsCount();
-      _temp_lhs_shape.Resize(rank);
+    static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                  "Only quantized rhs is cached");
+    _constant_rhs = rhs_data;
+  }
 
-      for (int32_t i = 0; i < rank - 2; i++)
-      {
-        _temp_lhs_shape.SetDim(i, lhs_shape.Dims(i));
-      }
-      _temp_lhs_shape.SetDim(rank - 2, lhs_shape.Dims(rank - 1));
-      _temp_lhs_shape.SetDim(rank - 1, lhs_shape.Dims(rank - 2));
+  void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
+                  const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                  float *output_data, ruy::Context *ruy_context = nullptr)
+  {
+    using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using ConstMatrixMap = Eigen::Map<const Matrix>;
+    using MatrixMap = Eigen::Map<Matrix>;
 
-      _temp_lhs.resize(_temp_lhs_shape.FlatSize());
-    }
+    const auto batch_dims = batch_matmul::GetBatchDims(lhs_shape, rhs_shape);
+    const int rank = output_shape.DimensionsCount();
+    const int rows = output_shape.Dims(rank - 2);
+    const int cols = output_shape.Dims(rank - 1);
+    const int depth = lhs_shape.Dims(lhs_shape.DimensionsCount() - (adj_x ? 2 : 1));
+    assert(depth == rhs_shape.Dims(rhs_shape.DimensionsCount() - (adj_y ? 1 : 2)));
 
-    if (!adj_y)
-    {
-      int32_t rank = rhs_shape.DimensionsCount();
-      _temp_rhs_shape.Resize(rank);
+    auto compute = [&](int batch, int row_begin, int row_end) {
+      const float *lhs = lhs_data + batch_dims.lhsOffset(batch);
+      const float *rhs = rhs_data + batch_dims.rhsOffset(batch);
+      const int num_rows = row_end - row_begin;
+      MatrixMap output(output_data + (static_cast<int64_t>(batch) * rows + row_begin) * cols,
+                       num_rows, cols);
 
-      for (int32_t i = 0; i < rank - 2; i++)
-      {
-        _temp_rhs_shape.SetDim(i, rhs_shape.Dims(i));
-      }
-      _temp_rhs_shape.SetDim(rank - 2, rhs_shape.Dims(rank - 1));
-      _temp_rhs_shape.SetDim(rank - 1, rhs_shape.Dims(rank - 2));
+      auto multiply = [&](const auto &lhs_matrix) {
+        if (adj_y)
+          output.noalias() = lhs_matrix * ConstMatrixMap(rhs, cols, depth).transpose();
+        else
+          output.noalias() = lhs_matrix * ConstMatrixMap(rhs, depth, cols);
+      };
+      if (adj_x)
+        multiply(ConstMatrixMap(lhs, depth, rows).middleCols(row_begin, num_rows).transpose());
+      else
+        multiply(ConstMatrixMap(lhs + static_cast<int64_t>(row_begin) * depth, num_rows, depth));
+    };
 
-      _temp_rhs.resize(_temp_rhs_shape.FlatSize());
-    }
+    batch_matmul::ParallelForRows(batch_dims.count(), rows, static_cast<int64_t>(cols) * depth,
+                                  ruy_context, compute);
   }
 
-  void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
-                  const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
-                  float *output_data)
+  template <typename T>
+  void operator()(const BatchMatMulParams &params, const Shape &lhs_shape, const T *lhs_data,
+                  const Shape &rhs_shape, const T *rhs_data, bool adj_x, bool adj_y,
+                  const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
   {
-    // Assume lhs and rhs is not constant
-    // TODO Handle constant input
+    static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                  "Unsupported quantized type");
 
-    if (!adj_y)
-    {
-      transposeRowsCols(rhs_shape, rhs_data, _temp_rhs_shape, _temp_rhs.data());
-    }
+    const auto batch_dims = batch_matmul::GetBatchDims(lhs_shape, rhs_shape);
+    const int rank = output_shape.DimensionsCount();
+    const int rows = output_shape.Dims(rank - 2);
+    const int cols = output_shape.Dims(rank - 1);
+    const int depth = lhs_shape.Dims(lhs_shape.DimensionsCount() - (adj_x ? 2 : 1));
+    assert(depth == rhs_shape.Dims(rhs_shape.DimensionsCount() - (adj_y ? 1 : 2)));
 
-    if (adj_x)
+    std::unique_ptr<ruy::Context> local_context;
+    if (ruy_context == nullptr)
     {
-      transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, _temp_lhs.data());
+      local_context = std::make_unique<ruy::Context>();
+      ruy_context = local_context.get();
     }
 
-    Shape new_lhs_shape = adj_x ? lhs_shape : swapRowColDims(lhs_shape);
-    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
-    const float *new_lhs_data = adj_x ? _temp_lhs.data() : lhs_data;
-    const float *new_rhs_data = adj_y ? rhs_data : _temp_rhs.data();
-
-    // Note we pass RHS args first, LHS args second
-    // Check accumulative dimensions of lhs and rhs of are equal
-    assert(Shape::ExtendedShape(5, new_rhs_shape).Dims(4) ==
-           Shape::ExtendedShape(5, new_lhs_shape).Dims(3));
-    reference::BatchMatMul(new_rhs_shape, new_rhs_data, new_lhs_shape, new_lhs_data, output_shape,
-                           output_data);
-  }
+    ruy::MulParams<int32_t, T> mul_params;
+    mul_params.set_multiplier_fixedpoint(params.output_multiplier);
+    mul_params.set_multiplier_exponent(params.output_shift);
+    mul_params.set_clamp_min(static_cast<T>(params.quantized_activation_min));
+    mul_params.set_clamp_max(static_cast<T>(params.quantized_activation_max));
 
-private:
-  Shape swapRowColDims(const Shape &shape)
-  {
-    Shape swapped_shape(shape);
-    const uint32_t dims = shape.DimensionsCount();
-    swapped_shape.SetDim(dims - 2, shape.Dims(dims - 1));
-    swapped_shape.SetDim(dims - 1, shape.Dims(dims - 2));
+    // [depth, rows] in row-major order is [rows, depth] in col-major order, and so is rhs
+    ruy::Matrix<T> lhs;
+    ruy::MakeSimpleLayout(rows, depth, adj_x ? ruy::Order::kColMajor : ruy::Order::kRowMajor,
+                          lhs.mutable_layout());
+    lhs.set_zero_point(static_cast<T>(-params.lhs_offset));
+    ruy::Matrix<T> rhs;
+    ruy::MakeSimpleLayout(depth, cols, adj_y ? ruy::Order::kColMajor : ruy::Order::kRowMajor,
+                          rhs.mutable_layout());
+    rhs.set_zero_point(static_cast<T>(-params.rhs_offset));
+    if (rhs_data == _constant_rhs)
+      rhs.set_cache_policy(ruy::CachePolicy::kAlwaysCache);
+    ruy::Matrix<T> output;
+    ruy::MakeSimpleLayout(rows, cols, ruy::Order::kRowMajor, output.mutable_layout());
+    output.set_zero_point(static_cast<T>(params.output_offset));
 
-    return swapped_shape;
-  }
-
-  void transposeRowsCols(const Shape &input_shape, const float *input_data,
-                         const Shape &output_shape, float *output_data)
-  {
-    TransposeParams params;
-    int rank = input_shape.DimensionsCount();
-    params.perm_count = rank;
-    for (int i = 0; i < 2; i++)
+    for (int batch = 0; batch < batch_dims.count(); ++batch)
     {
-      params.perm[i] = i;
+      lhs.set_data(lhs_data + batch_dims.lhsOffset(batch));
+      rhs.set_data(rhs_data + batch_dims.rhsOffset(batch));
+      output.set_data(output_data + static_cast<int64_t>(batch) * rows * cols);
+      ruy::Mul(lhs, rhs, mul_params, ruy_context, &output);
     }
-    params.perm[rank - 2] = rank - 1;
-    params.perm[rank - 1] = rank - 2;
-
-    Transpose<float>(params, input_shape, input_data, output_shape, output_data);
   }
 
 private:
-  std::vector<float> _temp_lhs;
-  Shape _temp_lhs_shape;
-  std::vector<float> _temp_rhs;
-  Shape _temp_rhs_shape;
+  // Quantized rhs marked by prepareConstantRhs()
+  const void *_constant_rhs = nullptr;
 };
 
 } // namespace cker
@@ -55,7 +55,11 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+    : _modified_filter_data(), _transposed_filter_data(nullptr), _im2col_shape(4),
+      _need_im2col(false), _prepared(false)
+  {
+  }
 
   void prepareF32(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                   bool &is_replaced_weights, uint32_t dilationWidthFactor,
@@ -71,6 +75,20 @@ public:
     }
   }
 
+  /**
+   * @brief Prepare with the filter already transposed by TransposeFilter()
+   * @note  transposed_filter_data is not copied and should outlive this Conv. It is used to share
+   *        the transposed filter among Convs of the same weights.
+   */
+  void prepareF32Transposed(const float *transposed_filter_data)
+  {
+    if (!_prepared)
+    {
+      _transposed_filter_data = transposed_filter_data;
+      _prepared = true;
+    }
+  }
+
   void prepareQ8uPerTensor(const Shape &input_shape, const Shape &kernel_shape,
                            const Shape &output_shape, uint32_t stride_width, uint32_t stride_height,
                            uint32_t dilation_width_factor, uint32_t dilation_height_factor)
@@ -98,7 +116,7 @@ public:
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
+      multithreaded::Conv(params, input_shape, input_data, filter_shape, _transposed_filter_data,
                           bias_shape, bias_data, output_shape, output_data);
     }
     else
@@ -121,21 +139,17 @@ public:
                        params.dilation_height_factor);
     }
 
-    int im2col_size = _need_im2col ? _im2col_shape.FlatSize() : 1;
-
-    // Use heap if size is larger than 8MB
-    if (im2col_size > 8 * 1024 * 1024)
-    {
-      std::unique_ptr<uint8_t[]> im2col_data = std::make_unique<uint8_t[]>(im2col_size);
-      optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                      bias_data, output_shape, output_data, _im2col_shape, im2col_data.get());
-    }
-    else
+    const size_t im2col_size = im2colSize();
+    uint8_t *im2col_data = _im2col_buffer;
+    if (im2col_size > _im2col_buffer_size)
     {
-      uint8_t im2col_data[im2col_size];
-      optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                      bias_data, output_shape, output_data, _im2col_shape, im2col_data);
+      // The buffer given by setIm2colBuffer() is too small, e.g. input shape has been changed
+      if (_im2col_data.size() < im2col_size)
+        _im2col_data.resize(im2col_size);
+      im2col_data = _im2col_data.data();
     }
+    optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                    bias_data, output_shape, output_data, _im2col_shape, im2col_data);
   }
 
   void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
@@ -161,21 +175,53 @@ public:
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
-private:
+  /**
+   * @brief Return the size of im2col buffer in bytes for uint8 kernel, which is known after
+   *        prepareQ8uPerTensor()
+   */
+  size_t im2colSize() const { return _need_im2col ? _im2col_shape.FlatSize() : 0; }
+
+  /**
+   * @brief Set im2col buffer for uint8 kernel, which is owned by caller
+   *
+   * If the buffer is smaller than im2colSize() at run, the kernel allocates its own buffer.
+   */
+  void setIm2colBuffer(uint8_t *buffer, size_t size)
+  {
+    _im2col_buffer = buffer;
+    _im2col_buffer_size = buffer != nullptr ? size : 0;
+  }
+
+  /**
+   * @brief Return whether float filter is transposed for the multithreaded kernel
+   */
   bool usableMultiThreaded(PaddingType padding_type, uint32_t dilation_width_factor,
-                           int32_t dilation_height_factor)
+                           int32_t dilation_height_factor) const
   {
     return padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1 &&
            dilation_width_factor == 1 && dilation_height_factor == 1;
   }
 
-  void transposeFilter(const Shape &filter_shape, const float *filter_data,
-                       bool &is_replaced_weights)
+  /**
+   * @brief Transpose float filter for the multithreaded kernel
+   *
+   * @param transposed_filter_data Buffer of filter_shape.FlatSize() elements
+   */
+  static void TransposeFilter(const Shape &filter_shape, const float *filter_data,
+                              float *transposed_filter_data)
   {
     const auto output_depth = filter_shape.Dims(0);
     const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
-    _modified_filter_data.resize(hwcn_filter_shape.FlatSize());
-    TransposeFloatTensor(filter_data, hwcn_filter_shape, &_modified_filter_data[0]);
+    TransposeFloatTensor(filter_data, hwcn_filter_shape, transposed_filter_data);
+  }
+
+private:
+  void transposeFilter(const Shape &filter_shape, const float *filter_data,
+                       bool &is_replaced_weights)
+  {
+    _modified_filter_data.resize(filter_shape.FlatSize());
+    TransposeFilter(filter_shape, filter_data, &_modified_filter_data[0]);
+    _transposed_filter_data = _modified_filter_data.data();
     is_replaced_weights = true;
   }
 
@@ -200,9 +246,15 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  // Either _modified_filter_data or the one given by prepareF32Transposed()
+  const float *_transposed_filter_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  // im2col buffer given by caller, or _im2col_data as fallback
+  uint8_t *_im2col_buffer = nullptr;
+  size_t _im2col_buffer_size = 0;
+  std::vector<uint8_t> _im2col_data;
   // Per channel output multiplier and shift.
   std::vector<int32_t> _per_channel_output_multiplier;
   std::vector<int> _per_channel_output_shift;
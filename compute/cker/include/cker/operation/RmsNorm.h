@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RMS_NORM_H__
+#define __NNFW_CKER_RMS_NORM_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/Utils.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Normalize each row of the last dimension by its root mean square:
+//   output = gamma * input / sqrt(mean(input^2) + epsilon) + beta
+//
+// Each row is read twice (sum of squares, then scale) and written once, so no intermediate
+// tensor of Mul/Mean/Rsqrt/Add chain is materialized. Row operations are vectorized by Eigen.
+inline void RmsNorm(const RmsNormParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &gamma_shape, const float *gamma_data, const Shape &beta_shape,
+                    const float *beta_data, const Shape &output_shape, float *output_data)
+{
+  const int32_t num_dims = input_shape.DimensionsCount();
+  if (num_dims < 1)
+    throw std::runtime_error("cker::RmsNorm: Unsupported rank");
+
+  const int32_t size = MatchingDim(input_shape, num_dims - 1, output_shape, num_dims - 1);
+  const int32_t rows = FlatSizeSkipDim(input_shape, num_dims - 1);
+
+  // gamma and beta are 1D tensors of [size] or [1]
+  const bool single_gamma = gamma_shape.FlatSize() == 1;
+  const bool single_beta = beta_shape.FlatSize() == 1;
+  if ((!single_gamma && gamma_shape.FlatSize() != size) ||
+      (beta_data != nullptr && !single_beta && beta_shape.FlatSize() != size))
+    throw std::runtime_error("cker::RmsNorm: gamma and beta size must match last dimension");
+
+  const MatrixMap<const float> input(input_data, size, rows);
+  MatrixMap<float> output(output_data, size, rows);
+  const VectorMap<const float> gamma(gamma_data, single_gamma ? 1 : size, 1);
+
+  for (int32_t row = 0; row < rows; ++row)
+  {
+    const auto in_row = input.col(row).array();
+    auto out_row = output.col(row).array();
+
+    const float mean_square = in_row.square().sum() / static_cast<float>(size);
+    const float inv_rms = 1.0f / std::sqrt(mean_square + params.epsilon);
+
+    if (single_gamma)
+      out_row = in_row * (gamma_data[0] * inv_rms);
+    else
+      out_row = in_row * gamma.array() * inv_rms;
+
+    if (beta_data == nullptr)
+      continue;
+
+    if (single_beta)
+      out_row += beta_data[0];
+    else
+      out_row += VectorMap<const float>(beta_data, size, 1).array();
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RMS_NORM_H__
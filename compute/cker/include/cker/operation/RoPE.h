@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ROPE_H__
+#define __NNFW_CKER_ROPE_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <Eigen/Core>
+
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace rope
+{
+
+// Number of sin/cos table rows, which must be a product of trailing input dimensions except
+// the last one. e.g. input [B, H, S, D] can use table of [S, D], [1, S, D] or [H, S, D].
+inline int32_t TableRows(const Shape &input_shape, const Shape &table_shape)
+{
+  const int32_t num_dims = input_shape.DimensionsCount();
+  const int32_t table_dims = table_shape.DimensionsCount();
+  const int32_t depth = input_shape.Dims(num_dims - 1);
+  if (table_dims < 1 || table_shape.Dims(table_dims - 1) != depth)
+    throw std::runtime_error("cker::RoPE: last dimension of sin/cos table must match input");
+
+  const int32_t table_rows = table_shape.FlatSize() / depth;
+  int32_t suffix_rows = 1;
+  for (int32_t i = num_dims - 2; i >= 0 && suffix_rows < table_rows; --i)
+    suffix_rows *= input_shape.Dims(i);
+  if (suffix_rows != table_rows)
+    throw std::runtime_error("cker::RoPE: sin/cos table is not broadcastable to input");
+
+  return table_rows;
+}
+
+} // namespace rope
+
+// Rotary position embedding on the last dimension
+//   GPT_NEOX : rotate (x[i], x[i + D/2]) pairs
+//   GPT_J    : rotate (x[2i], x[2i + 1]) pairs
+//
+// For each pair (x0, x1) at table indices (i0, i1),
+//   y0 = x0 * cos[i0] - x1 * sin[i0]
+//   y1 = x0 * sin[i1] + x1 * cos[i1]
+// Each row is computed in one pass with Eigen array expressions to be vectorized.
+inline void RoPE(const RoPEMode mode, const Shape &input_shape, const float *input_data,
+                 const Shape &sin_table_shape, const float *sin_table_data,
+                 const Shape &cos_table_shape, const float *cos_table_data,
+                 const Shape &output_shape, float *output_data)
+{
+  const int32_t num_dims = input_shape.DimensionsCount();
+  if (num_dims < 1)
+    throw std::runtime_error("cker::RoPE: Unsupported rank");
+
+  const int32_t depth = MatchingDim(input_shape, num_dims - 1, output_shape, num_dims - 1);
+  if (depth % 2 != 0)
+    throw std::runtime_error("cker::RoPE: last dimension must be even");
+
+  const int32_t rows = FlatSizeSkipDim(input_shape, num_dims - 1);
+  const int32_t sin_rows = rope::TableRows(input_shape, sin_table_shape);
+  const int32_t cos_rows = rope::TableRows(input_shape, cos_table_shape);
+  const int32_t half = depth / 2;
+
+  using ConstArray = Eigen::Map<const Eigen::ArrayXf, 0, Eigen::InnerStride<>>;
+  using Array = Eigen::Map<Eigen::ArrayXf, 0, Eigen::InnerStride<>>;
+
+  if (mode != RoPEMode::kGptNeox && mode != RoPEMode::kGptJ)
+    throw std::runtime_error("cker::RoPE: Unsupported mode");
+
+  // Offset between x0 and x1 of a pair, and stride between pairs
+  const int32_t pair_offset = (mode == RoPEMode::kGptNeox) ? half : 1;
+  const int32_t stride = (mode == RoPEMode::kGptNeox) ? 1 : 2;
+
+  for (int32_t row = 0; row < rows; ++row)
+  {
+    const float *in = input_data + static_cast<size_t>(row) * depth;
+    const float *sin = sin_table_data + static_cast<size_t>(row % sin_rows) * depth;
+    const float *cos = cos_table_data + static_cast<size_t>(row % cos_rows) * depth;
+    float *out = output_data + static_cast<size_t>(row) * depth;
+
+    const Eigen::InnerStride<> inner{stride};
+    const ConstArray x0(in, half, inner);
+    const ConstArray x1(in + pair_offset, half, inner);
+    const ConstArray sin0(sin, half, inner);
+    const ConstArray sin1(sin + pair_offset, half, inner);
+    const ConstArray cos0(cos, half, inner);
+    const ConstArray cos1(cos + pair_offset, half, inner);
+    Array y0(out, half, inner);
+    Array y1(out + pair_offset, half, inner);
+
+    // NOTE Input and output must not share buffer
+    y0 = x0 * cos0 - x1 * sin0;
+    y1 = x0 * sin1 + x1 * cos1;
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ROPE_H__
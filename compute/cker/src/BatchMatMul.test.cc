@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Naive lhs x rhs with broadcasting batch dimensions, in double
+std::vector<double> matmul(const Shape &lhs_shape, const std::vector<double> &lhs,
+                           const Shape &rhs_shape, const std::vector<double> &rhs, bool adj_x,
+                           bool adj_y, const Shape &output_shape)
+{
+  const int rank = output_shape.DimensionsCount();
+  const int rows = output_shape.Dims(rank - 2);
+  const int cols = output_shape.Dims(rank - 1);
+  const int depth = lhs_shape.Dims(lhs_shape.DimensionsCount() - (adj_x ? 2 : 1));
+  const int lhs_batches = lhs_shape.FlatSize() / (rows * depth);
+  const int rhs_batches = rhs_shape.FlatSize() / (cols * depth);
+  const int batches = output_shape.FlatSize() / (rows * cols);
+
+  std::vector<double> output(output_shape.FlatSize());
+  for (int b = 0; b < batches; ++b)
+  {
+    // Only broadcasting of all batch dimensions is tested
+    const double *l = lhs.data() + (lhs_batches == 1 ? 0 : b) * rows * depth;
+    const double *r = rhs.data() + (rhs_batches == 1 ? 0 : b) * cols * depth;
+    for (int i = 0; i < rows; ++i)
+      for (int j = 0; j < cols; ++j)
+      {
+        double sum = 0;
+        for (int k = 0; k < depth; ++k)
+          sum += (adj_x ? l[k * rows + i] : l[i * depth + k]) *
+                 (adj_y ? r[j * depth + k] : r[k * cols + j]);
+        output[(b * rows + i) * cols + j] = sum;
+      }
+  }
+  return output;
+}
+
+Shape matrixShape(int batches, int rows, int cols, bool adj)
+{
+  return adj ? Shape{batches, cols, rows} : Shape{batches, rows, cols};
+}
+
+void testFloat(int lhs_batches, int rhs_batches, int rows, int cols, int depth, bool adj_x,
+               bool adj_y, ruy::Context *ruy_context)
+{
+  const int batches = std::max(lhs_batches, rhs_batches);
+  const Shape lhs_shape = matrixShape(lhs_batches, rows, depth, adj_x);
+  const Shape rhs_shape = matrixShape(rhs_batches, depth, cols, adj_y);
+  const Shape output_shape{batches, rows, cols};
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> lhs(lhs_shape.FlatSize());
+  std::vector<float> rhs(rhs_shape.FlatSize());
+  for (auto &v : lhs)
+    v = dist(gen);
+  for (auto &v : rhs)
+    v = dist(gen);
+
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::BatchMatMul batchmatmul;
+  batchmatmul(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+              output.data(), ruy_context);
+
+  const auto expected =
+    matmul(lhs_shape, std::vector<double>(lhs.begin(), lhs.end()), rhs_shape,
+           std::vector<double>(rhs.begin(), rhs.end()), adj_x, adj_y, output_shape);
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4);
+}
+
+template <typename T>
+void testQuant(bool adj_x, bool adj_y, bool constant_rhs, ruy::Context *ruy_context)
+{
+  const int batches = 3;
+  const int rows = 5;
+  const int cols = 7;
+  const int depth = 11;
+  const Shape lhs_shape = matrixShape(batches, rows, depth, adj_x);
+  const Shape rhs_shape = matrixShape(batches, depth, cols, adj_y);
+  const Shape output_shape{batches, rows, cols};
+
+  const int32_t lhs_zero_point = 3;
+  const int32_t rhs_zero_point = -2 + (std::is_same<T, uint8_t>::value ? 130 : 0);
+  const int32_t output_zero_point = 1;
+  const double output_scale = 4.0; // lhs and rhs scales are 1
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(),
+                                          std::numeric_limits<T>::max());
+  std::vector<T> lhs(lhs_shape.FlatSize());
+  std::vector<T> rhs(rhs_shape.FlatSize());
+  for (auto &v : lhs)
+    v = static_cast<T>(dist(gen));
+  for (auto &v : rhs)
+    v = static_cast<T>(dist(gen));
+
+  nnfw::cker::BatchMatMulParams params;
+  params.lhs_offset = -lhs_zero_point;
+  params.rhs_offset = -rhs_zero_point;
+  params.output_offset = output_zero_point;
+  // 1/4 = 0.5 * 2^-1
+  params.output_multiplier = 1 << 30;
+  params.output_shift = -1;
+  params.quantized_activation_min = std::numeric_limits<T>::min();
+  params.quantized_activation_max = std::numeric_limits<T>::max();
+
+  nnfw::cker::BatchMatMul batchmatmul;
+  if (constant_rhs)
+    batchmatmul.prepareConstantRhs(rhs.data());
+
+  std::vector<T> output(output_shape.FlatSize());
+  batchmatmul(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+              output.data(), ruy_context);
+  // Run again with cached rhs
+  if (constant_rhs)
+    batchmatmul(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+                output.data(), ruy_context);
+
+  std::vector<double> real_lhs(lhs.size());
+  std::vector<double> real_rhs(rhs.size());
+  for (size_t i = 0; i < lhs.size(); ++i)
+    real_lhs[i] = lhs[i] - lhs_zero_point;
+  for (size_t i = 0; i < rhs.size(); ++i)
+    real_rhs[i] = rhs[i] - rhs_zero_point;
+  const auto expected =
+    matmul(lhs_shape, real_lhs, rhs_shape, real_rhs, adj_x, adj_y, output_shape);
+  for (size_t i = 0; i < output.size(); ++i)
+  {
+    const double quantized = std::min<double>(
+      std::max<double>(std::round(expected[i] / output_scale) + output_zero_point,
+                       std::numeric_limits<T>::min()),
+      std::numeric_limits<T>::max());
+    EXPECT_NEAR(output[i], quantized, 1);
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, BatchMatMul)
+{
+  for (bool adj_x : {false, true})
+    for (bool adj_y : {false, true})
+    {
+      testFloat(2, 2, 3, 4, 5, adj_x, adj_y, nullptr);
+      // Broadcast batch
+      testFloat(1, 3, 4, 2, 3, adj_x, adj_y, nullptr);
+      testFloat(3, 1, 4, 2, 3, adj_x, adj_y, nullptr);
+    }
+
+  // Rank 2 and 4
+  {
+    nnfw::cker::BatchMatMul batchmatmul;
+    std::vector<float> lhs = {1, 2, 3, 4, 5, 6};
+    std::vector<float> rhs = {1, 0, 0, 1, 1, 1};
+    std::vector<float> expected = {4, 5, 10, 11};
+    std::vector<float> output(4);
+    batchmatmul(Shape{2, 3}, lhs.data(), Shape{3, 2}, rhs.data(), false, false, Shape{2, 2},
+                output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+
+    batchmatmul(Shape{1, 1, 2, 3}, lhs.data(), Shape{1, 1, 3, 2}, rhs.data(), false, false,
+                Shape{1, 1, 2, 2}, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
+
+TEST(CKer_Operation, BatchMatMulMultiThread)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (bool adj_x : {false, true})
+    for (bool adj_y : {false, true})
+    {
+      // Rows of a batch are split across threads
+      testFloat(3, 3, 37, 64, 48, adj_x, adj_y, &ruy_context);
+      testFloat(1, 2, 100, 32, 64, adj_x, adj_y, &ruy_context);
+    }
+}
+
+TEST(CKer_Operation, BatchMatMulQuant8)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+  for (bool adj_x : {false, true})
+    for (bool adj_y : {false, true})
+      for (bool constant_rhs : {false, true})
+      {
+        testQuant<uint8_t>(adj_x, adj_y, constant_rhs, &ruy_context);
+        testQuant<int8_t>(adj_x, adj_y, constant_rhs, &ruy_context);
+      }
+}
+
+TEST(CKer_Operation, BatchMatMulQuant8NoContext)
+{
+  testQuant<uint8_t>(true, false, true, nullptr);
+  testQuant<int8_t>(false, true, false, nullptr);
+}
+
+TEST(CKer_Operation, neg_BatchMatMulQuant8ChangedRhs)
+{
+  // Rhs which is not the constant one is not taken from the cache
+  nnfw::cker::BatchMatMulParams params;
+  params.lhs_offset = 0;
+  params.rhs_offset = 0;
+  params.output_offset = 0;
+  params.output_multiplier = 1 << 30;
+  params.output_shift = 1;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  std::vector<int8_t> lhs = {1, 2};
+  std::vector<int8_t> rhs1 = {1, 1};
+  std::vector<int8_t> rhs2 = {2, 3};
+  std::vector<int8_t> output(1);
+
+  nnfw::cker::BatchMatMul batchmatmul;
+  batchmatmul.prepareConstantRhs(rhs1.data());
+  batchmatmul(params, Shape{1, 2}, lhs.data(), Shape{2, 1}, rhs1.data(), false, false,
+              Shape{1, 1}, output.data());
+  EXPECT_EQ(output[0], 3);
+  batchmatmul(params, Shape{1, 2}, lhs.data(), Shape{2, 1}, rhs2.data(), false, false,
+              Shape{1, 1}, output.data());
+  EXPECT_EQ(output[0], 8);
+}
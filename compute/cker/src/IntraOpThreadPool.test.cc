@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/IntraOpThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+using nnfw::cker::IntraOpThreadPool;
+
+TEST(CKer_IntraOpThreadPool, execute)
+{
+  IntraOpThreadPool pool{3};
+  std::vector<int> done(pool.maxConcurrency(), 0);
+  pool.execute(pool.maxConcurrency(), [&](int i) { done[i] = i + 1; });
+
+  for (int i = 0; i < pool.maxConcurrency(); ++i)
+    ASSERT_EQ(done[i], i + 1);
+}
+
+TEST(CKer_IntraOpThreadPool, execute_concurrently)
+{
+  // Every task waits for the others, which finishes only if all of them run at the same time
+  IntraOpThreadPool pool{3};
+  std::atomic<int> arrived{0};
+  pool.execute(pool.maxConcurrency(), [&](int) {
+    arrived++;
+    while (arrived.load() < 4)
+      std::this_thread::yield();
+  });
+  ASSERT_EQ(arrived.load(), 4);
+}
+
+TEST(CKer_IntraOpThreadPool, execute_from_many_threads)
+{
+  IntraOpThreadPool pool{2};
+  std::atomic<int> count{0};
+  std::vector<std::future<void>> callers;
+  for (int c = 0; c < 4; ++c)
+  {
+    callers.emplace_back(std::async(std::launch::async, [&] {
+      for (int r = 0; r < 100; ++r)
+      {
+        std::atomic<int> arrived{0};
+        pool.execute(3, [&](int) {
+          arrived++;
+          while (arrived.load() < 3)
+            std::this_thread::yield();
+          count++;
+        });
+      }
+    }));
+  }
+  for (auto &&caller : callers)
+    caller.get();
+
+  ASSERT_EQ(count.load(), 4 * 100 * 3);
+}
+
+TEST(CKer_IntraOpThreadPool, regions_of_callers_run_together)
+{
+  // Each region waits until the region of the other caller has started, which finishes only if
+  // regions are not serialized in the pool
+  IntraOpThreadPool pool{4};
+  std::atomic<int> started{0};
+  auto caller = [&] {
+    pool.execute(3, [&](int i) {
+      if (i == 0)
+        started++;
+      while (started.load() < 2)
+        std::this_thread::yield();
+    });
+  };
+  auto other = std::async(std::launch::async, caller);
+  caller();
+  other.get();
+
+  ASSERT_EQ(started.load(), 2);
+}
+
+TEST(CKer_IntraOpThreadPool, parallelFor)
+{
+  IntraOpThreadPool pool{3};
+  std::vector<int> done(100, 0);
+  pool.parallelFor(100, [&](int i) { done[i] = i + 1; });
+
+  for (int i = 0; i < 100; ++i)
+    ASSERT_EQ(done[i], i + 1);
+}
+
+TEST(CKer_IntraOpThreadPool, parallelFor_inline_when_busy)
+{
+  IntraOpThreadPool pool{1};
+  std::atomic<bool> blocking{false};
+  std::atomic<bool> release{false};
+  // Keep the only worker busy
+  auto other = std::async(std::launch::async, [&] {
+    pool.execute(2, [&](int i) {
+      if (i == 1)
+      {
+        blocking = true;
+        while (!release.load())
+          std::this_thread::yield();
+      }
+    });
+  });
+  while (!blocking.load())
+    std::this_thread::yield();
+
+  ASSERT_EQ(pool.availableConcurrency(), 1);
+  int on_caller = 0;
+  const auto caller = std::this_thread::get_id();
+  pool.parallelFor(10, [&](int) {
+    if (std::this_thread::get_id() == caller)
+      on_caller++;
+  });
+  release = true;
+  other.get();
+
+  ASSERT_EQ(on_caller, 10);
+}
+
+TEST(CKer_IntraOpThreadPool, schedule)
+{
+  std::atomic<int> count{0};
+  std::atomic<int> on_worker{0};
+  {
+    IntraOpThreadPool pool{2};
+    ASSERT_EQ(pool.currentThreadId(), -1);
+    for (int i = 0; i < 100; ++i)
+      pool.schedule([&] {
+        if (pool.currentThreadId() >= 0)
+          on_worker++;
+        count++;
+      });
+    // Queued tasks are drained before the pool is destroyed
+  }
+  ASSERT_EQ(count.load(), 100);
+  ASSERT_EQ(on_worker.load(), 100);
+}
+
+TEST(CKer_IntraOpThreadPool, reserve)
+{
+  IntraOpThreadPool pool{1};
+  pool.reserve(3);
+  ASSERT_EQ(pool.numThreads(), 3);
+
+  // New workers take part in a region that needs all of them
+  std::atomic<int> arrived{0};
+  pool.execute(pool.maxConcurrency(), [&](int) {
+    arrived++;
+    while (arrived.load() < 4)
+      std::this_thread::yield();
+  });
+  ASSERT_EQ(arrived.load(), 4);
+
+  // Workers are never removed
+  pool.reserve(2);
+  ASSERT_EQ(pool.numThreads(), 3);
+}
+
+TEST(CKer_IntraOpThreadPool, GetIntraOpThreadPool_grows)
+{
+  auto &pool = nnfw::cker::GetIntraOpThreadPool(2);
+  const int num_threads = pool.numThreads();
+
+  // A request for more threads grows the same pool
+  auto &grown = nnfw::cker::GetIntraOpThreadPool(num_threads + 3);
+  ASSERT_EQ(&grown, &pool);
+  ASSERT_EQ(grown.numThreads(), num_threads + 2);
+
+  // Requests for fewer threads and kernels' calls leave it as it is
+  ASSERT_EQ(nnfw::cker::GetIntraOpThreadPool(2).numThreads(), num_threads + 2);
+  ASSERT_EQ(nnfw::cker::GetIntraOpThreadPool().numThreads(), num_threads + 2);
+}
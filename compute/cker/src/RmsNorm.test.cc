@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/RmsNorm.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+TEST(CKer_Operation, RmsNorm)
+{
+  // Single gamma and beta
+  {
+    nnfw::cker::RmsNormParams params;
+    params.epsilon = 0.f;
+    nnfw::cker::Shape input_shape{1, 2, 4};
+    std::vector<float> input = {1, 1, 1, 1, 2, 2, 2, 2};
+    nnfw::cker::Shape gamma_shape{1};
+    std::vector<float> gamma = {2};
+    nnfw::cker::Shape beta_shape{1};
+    std::vector<float> beta = {1};
+    std::vector<float> expected = {3, 3, 3, 3, 3, 3, 3, 3};
+    std::vector<float> output(expected.size());
+
+    nnfw::cker::RmsNorm(params, input_shape, input.data(), gamma_shape, gamma.data(), beta_shape,
+                        beta.data(), input_shape, output.data());
+
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+  }
+
+  // Per-channel gamma and beta
+  {
+    nnfw::cker::RmsNormParams params;
+    params.epsilon = 1e-6f;
+    nnfw::cker::Shape input_shape{2, 2};
+    std::vector<float> input = {3, 4, -6, 8};
+    nnfw::cker::Shape gamma_shape{2};
+    std::vector<float> gamma = {1, 2};
+    nnfw::cker::Shape beta_shape{2};
+    std::vector<float> beta = {0, -1};
+    std::vector<float> output(input.size());
+
+    nnfw::cker::RmsNorm(params, input_shape, input.data(), gamma_shape, gamma.data(), beta_shape,
+                        beta.data(), input_shape, output.data());
+
+    const float rms0 = std::sqrt((9.f + 16.f) / 2.f + 1e-6f);
+    const float rms1 = std::sqrt((36.f + 64.f) / 2.f + 1e-6f);
+    EXPECT_NEAR(output[0], 3.f / rms0, 1e-5f);
+    EXPECT_NEAR(output[1], 2.f * 4.f / rms0 - 1.f, 1e-5f);
+    EXPECT_NEAR(output[2], -6.f / rms1, 1e-5f);
+    EXPECT_NEAR(output[3], 2.f * 8.f / rms1 - 1.f, 1e-5f);
+  }
+}
+
+TEST(CKer_Operation, neg_RmsNormGammaSizeMismatch)
+{
+  nnfw::cker::RmsNormParams params;
+  params.epsilon = 1e-6f;
+  nnfw::cker::Shape input_shape{1, 4};
+  std::vector<float> input = {1, 2, 3, 4};
+  nnfw::cker::Shape gamma_shape{3};
+  std::vector<float> gamma = {1, 1, 1};
+  nnfw::cker::Shape beta_shape{1};
+  std::vector<float> beta = {0};
+  std::vector<float> output(input.size());
+
+  EXPECT_ANY_THROW(nnfw::cker::RmsNorm(params, input_shape, input.data(), gamma_shape,
+                                       gamma.data(), beta_shape, beta.data(), input_shape,
+                                       output.data()));
+}
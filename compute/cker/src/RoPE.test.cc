@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/RoPE.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, RoPE)
+{
+  // input [1, 2, 4], table [2, 4]
+  nnfw::cker::Shape input_shape{1, 2, 4};
+  std::vector<float> input = {1, 2, 3, 4, 5, 6, 7, 8};
+  nnfw::cker::Shape table_shape{2, 4};
+  std::vector<float> sin_table = {0, 0, 0, 0, 1, 0.5, 1, 0.5};
+  std::vector<float> cos_table = {1, 1, 1, 1, 0, 2, 0, 2};
+
+  // GPT_NEOX rotates (x[i], x[i + 2]) pairs
+  {
+    std::vector<float> expected = {1, 2, 3, 4, -7, 8, 5, 19};
+    std::vector<float> output(input.size());
+
+    nnfw::cker::RoPE(nnfw::cker::RoPEMode::kGptNeox, input_shape, input.data(), table_shape,
+                     sin_table.data(), table_shape, cos_table.data(), input_shape, output.data());
+
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+  }
+
+  // GPT_J rotates (x[2i], x[2i + 1]) pairs
+  {
+    std::vector<float> expected = {1, 2, 3, 4, -6, 14.5, -8, 19.5};
+    std::vector<float> output(input.size());
+
+    nnfw::cker::RoPE(nnfw::cker::RoPEMode::kGptJ, input_shape, input.data(), table_shape,
+                     sin_table.data(), table_shape, cos_table.data(), input_shape, output.data());
+
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
+
+TEST(CKer_Operation, neg_RoPEOddDepth)
+{
+  nnfw::cker::Shape input_shape{1, 3};
+  std::vector<float> input = {1, 2, 3};
+  nnfw::cker::Shape table_shape{1, 3};
+  std::vector<float> table = {0, 0, 0};
+  std::vector<float> output(input.size());
+
+  EXPECT_ANY_THROW(nnfw::cker::RoPE(nnfw::cker::RoPEMode::kGptNeox, input_shape, input.data(),
+                                    table_shape, table.data(), table_shape, table.data(),
+                                    input_shape, output.data()));
+}
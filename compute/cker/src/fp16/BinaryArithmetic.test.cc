@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/fp16/operation/BinaryArithmetic.h>
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+namespace
+{
+using nnfw::cker::BinaryArithmeticOpType;
+
+std::vector<Half> ToHalf(const std::vector<float> &values)
+{
+  std::vector<Half> result;
+  for (auto value : values)
+    result.emplace_back(value);
+  return result;
+}
+
+nnfw::cker::BinaryArithmeticOpParam NoActivation()
+{
+  nnfw::cker::BinaryArithmeticOpParam param;
+  param.float_activation_min = std::numeric_limits<float>::lowest();
+  param.float_activation_max = std::numeric_limits<float>::max();
+  return param;
+}
+} // namespace
+
+TEST(CKer_Operation_FP16, BinaryArithmetic)
+{
+  // Long enough to use vector and scalar paths
+  {
+    std::vector<float> input1 = {1.5f, -2.f, 3.25f, 4.f, -5.5f, 6.f, 7.f, -8.f, 9.5f, 10.f, 0.f};
+    std::vector<float> input2 = {2.f, 0.5f, -1.f, 4.f, 2.f, -3.f, 0.25f, 8.f, 1.f, -2.f, 3.f};
+    std::vector<Half> output(input1.size());
+    const auto half1 = ToHalf(input1);
+    const auto half2 = ToHalf(input2);
+    nnfw::cker::Shape shape{static_cast<int>(input1.size())};
+
+    nnfw::cker::fp16::BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+      NoActivation(), shape, half1.data(), shape, half2.data(), shape, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], input1[i] + input2[i]);
+
+    nnfw::cker::fp16::BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(
+      NoActivation(), shape, half1.data(), shape, half2.data(), shape, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], input1[i] * input2[i]);
+  }
+
+  // Activation
+  {
+    std::vector<float> input1 = {-3.f, -1.f, 0.5f, 2.f, 5.f, 6.5f, -0.5f, 1.f, 10.f};
+    std::vector<float> input2 = {1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f};
+    std::vector<float> expected = {0.f, 0.f, 1.5f, 3.f, 6.f, 6.f, 0.5f, 2.f, 6.f};
+    std::vector<Half> output(input1.size());
+    const auto half1 = ToHalf(input1);
+    const auto half2 = ToHalf(input2);
+    nnfw::cker::Shape shape{1, 3, 3, 1};
+
+    auto param = NoActivation();
+    param.float_activation_min = 0.f;
+    param.float_activation_max = 6.f;
+    nnfw::cker::fp16::BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+      param, shape, half1.data(), shape, half2.data(), shape, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+  }
+
+  // Broadcast
+  {
+    std::vector<float> input1 = {10.f, -9.f, -11.f, 7.f, 1.f, 2.f};
+    std::vector<float> input2 = {-3.f, 0.5f};
+    std::vector<float> expected = {13.f, -9.5f, -8.f, 6.5f, 4.f, 1.5f};
+    std::vector<Half> output(input1.size());
+    const auto half1 = ToHalf(input1);
+    const auto half2 = ToHalf(input2);
+
+    nnfw::cker::fp16::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::SUB>(
+      NoActivation(), nnfw::cker::Shape{1, 3, 2}, half1.data(), nnfw::cker::Shape{2},
+      half2.data(), nnfw::cker::Shape{1, 3, 2}, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
+
+TEST(CKer_Operation_FP16, neg_BinaryArithmeticBroadcastRank)
+{
+  std::vector<Half> input(1, Half(1.f));
+  std::vector<Half> output(1);
+  nnfw::cker::Shape shape{1, 1, 1, 1, 1};
+
+  EXPECT_ANY_THROW(nnfw::cker::fp16::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+    NoActivation(), shape, input.data(), shape, input.data(), shape, output.data()));
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/fp16/operation/Conv.h>
+#include <cker/fp16/operation/DepthwiseConv.h>
+#include <cker/fp16/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+std::vector<Half> ToHalf(const std::vector<float> &values)
+{
+  std::vector<Half> result;
+  for (auto value : values)
+    result.emplace_back(value);
+  return result;
+}
+
+// Values exact in half precision, varied by seed
+std::vector<float> Sequence(int size, int seed)
+{
+  std::vector<float> values(size);
+  for (int i = 0; i < size; ++i)
+    values[i] = static_cast<float>((i * 7 + seed * 5) % 11 - 5) * 0.125f;
+  return values;
+}
+} // namespace
+
+TEST(CKer_Operation_FP16, Conv)
+{
+  // input [1, 3, 3, 2], filter [2, 2, 2, 2], stride 1, padding 1 on top and left
+  std::vector<float> input = {1.f, 0.f,  2.f, 1.f, 0.f, -1.f, 3.f, 2.f, -2.f,
+                              1.f, 0.5f, 0.f, 1.f, 1.f, 2.f,  0.f, 0.f, 1.f};
+  std::vector<float> filter = {1.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f,
+                               0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f};
+  std::vector<float> bias = {0.f, 1.f};
+  const auto half_input = ToHalf(input);
+  const auto half_filter = ToHalf(filter);
+  const auto half_bias = ToHalf(bias);
+
+  nnfw::cker::ConvParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  nnfw::cker::Shape input_shape{1, 3, 3, 2};
+  nnfw::cker::Shape filter_shape{2, 2, 2, 2};
+  nnfw::cker::Shape output_shape{1, 3, 3, 2};
+  std::vector<Half> output(output_shape.FlatSize());
+  std::vector<float> packed_filter(nnfw::cker::fp16::PackedWeightsSize(2, 8));
+  nnfw::cker::fp16::PackWeights(half_filter.data(), 2, 8, packed_filter.data());
+  nnfw::cker::fp16::Conv(params, input_shape, half_input.data(), filter_shape,
+                         packed_filter.data(), nnfw::cker::Shape{2}, half_bias.data(),
+                         output_shape, output.data());
+
+  // Output channel 0 is top-left channel 0 plus bottom-right channel 1, and output channel 1 is
+  // the sum of bottom-right channels plus bias
+  auto at = [&](int y, int x, int c) -> float {
+    if (y < 0 || y >= 3 || x < 0 || x >= 3)
+      return 0.f;
+    return input[(y * 3 + x) * 2 + c];
+  };
+  for (int y = 0; y < 3; ++y)
+  {
+    for (int x = 0; x < 3; ++x)
+    {
+      const float expected0 = at(y - 1, x - 1, 0) + at(y, x, 1);
+      const float expected1 = at(y, x, 0) + at(y, x, 1) + 1.f;
+      EXPECT_FLOAT_EQ(output[(y * 3 + x) * 2], expected0);
+      EXPECT_FLOAT_EQ(output[(y * 3 + x) * 2 + 1], expected1);
+    }
+  }
+}
+
+TEST(CKer_Operation_FP16, Conv_blocks)
+{
+  // input [2, 7, 6, 3], filter [11, 3, 3, 3], stride 2 and dilation 2 with padding, so that
+  // output pixels and channels are not multiples of the block and panel sizes of GEMM
+  const int batches = 2, in_h = 7, in_w = 6, in_d = 3;
+  const int out_d = 11, f_h = 3, f_w = 3;
+  const int out_h = 3, out_w = 3;
+  const auto input = Sequence(batches * in_h * in_w * in_d, 0);
+  const auto filter = Sequence(out_d * f_h * f_w * in_d, 1);
+  const auto bias = Sequence(out_d, 2);
+  const auto half_input = ToHalf(input);
+  const auto half_filter = ToHalf(filter);
+  const auto half_bias = ToHalf(bias);
+
+  nnfw::cker::ConvParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.dilation_width_factor = 2;
+  params.dilation_height_factor = 2;
+  params.float_activation_min = -1.f;
+  params.float_activation_max = 1.f;
+
+  const int patch_size = f_h * f_w * in_d;
+  std::vector<float> packed_filter(nnfw::cker::fp16::PackedWeightsSize(out_d, patch_size));
+  nnfw::cker::fp16::PackWeights(half_filter.data(), out_d, patch_size, packed_filter.data());
+  std::vector<Half> output(batches * out_h * out_w * out_d);
+  nnfw::cker::fp16::Conv(params, nnfw::cker::Shape{batches, in_h, in_w, in_d}, half_input.data(),
+                         nnfw::cker::Shape{out_d, f_h, f_w, in_d}, packed_filter.data(),
+                         nnfw::cker::Shape{out_d}, half_bias.data(),
+                         nnfw::cker::Shape{batches, out_h, out_w, out_d}, output.data());
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int y = 0; y < out_h; ++y)
+    {
+      for (int x = 0; x < out_w; ++x)
+      {
+        for (int oc = 0; oc < out_d; ++oc)
+        {
+          float expected = bias[oc];
+          for (int fy = 0; fy < f_h; ++fy)
+          {
+            for (int fx = 0; fx < f_w; ++fx)
+            {
+              const int in_y = y * 2 - 1 + fy * 2;
+              const int in_x = x * 2 - 1 + fx * 2;
+              if (in_y < 0 || in_y >= in_h || in_x < 0 || in_x >= in_w)
+                continue;
+              for (int ic = 0; ic < in_d; ++ic)
+                expected += input[((b * in_h + in_y) * in_w + in_x) * in_d + ic] *
+                            filter[((oc * f_h + fy) * f_w + fx) * in_d + ic];
+            }
+          }
+          expected = std::min(std::max(expected, -1.f), 1.f);
+          EXPECT_NEAR(output[((b * out_h + y) * out_w + x) * out_d + oc], expected, 1e-3f);
+        }
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation_FP16, DepthwiseConv)
+{
+  // input [1, 2, 2, 2], filter [1, 2, 2, 4] with depth multiplier 2, valid padding
+  std::vector<float> input = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f};
+  std::vector<float> filter = {1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, -1.f,
+                               1.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f,  1.f};
+  std::vector<float> bias = {0.f, 1.f, 0.f, -1.f};
+  // oc 0 and 1 come from ic 0, oc 2 and 3 from ic 1
+  std::vector<float> expected = {16.f, 8.f, 8.f, 11.f};
+  const auto half_input = ToHalf(input);
+  const auto half_filter = ToHalf(filter);
+  const auto half_bias = ToHalf(bias);
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.padding_values.width = 0;
+  params.padding_values.height = 0;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.depth_multiplier = 2;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  nnfw::cker::Shape input_shape{1, 2, 2, 2};
+  nnfw::cker::Shape filter_shape{1, 2, 2, 4};
+  std::vector<Half> output(expected.size());
+  nnfw::cker::fp16::DepthwiseConv(params, input_shape, half_input.data(), filter_shape,
+                                  half_filter.data(), nnfw::cker::Shape{4}, half_bias.data(),
+                                  nnfw::cker::Shape{1, 1, 1, 4}, output.data());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation_FP16, SoftMax)
+{
+  std::vector<float> input = {1.f, 2.f, 3.f, -1.f, 0.f, 0.f, 0.f, 0.f};
+  const auto half_input = ToHalf(input);
+  std::vector<Half> output(input.size());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.0;
+  nnfw::cker::fp16::Softmax(params, nnfw::cker::Shape{2, 4}, half_input.data(),
+                            nnfw::cker::Shape{2, 4}, output.data());
+
+  for (int b = 0; b < 2; ++b)
+  {
+    float sum = 0.f;
+    for (int c = 0; c < 4; ++c)
+      sum += std::exp(input[b * 4 + c]);
+    for (int c = 0; c < 4; ++c)
+      EXPECT_NEAR(output[b * 4 + c], std::exp(input[b * 4 + c]) / sum, 1e-3f);
+  }
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/fp16/operation/FullyConnected.h>
+#include <cker/fp16/operation/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+std::vector<Half> ToHalf(const std::vector<float> &values)
+{
+  std::vector<Half> result;
+  for (auto value : values)
+    result.emplace_back(value);
+  return result;
+}
+
+// Values exact in half precision, varied by seed
+std::vector<float> Sequence(int size, int seed)
+{
+  std::vector<float> values(size);
+  for (int i = 0; i < size; ++i)
+    values[i] = static_cast<float>((i * 7 + seed * 5) % 11 - 5) * 0.125f;
+  return values;
+}
+} // namespace
+
+TEST(CKer_Operation_FP16, FullyConnected)
+{
+  // input [2, 5], weights [3, 5], bias [3]
+  std::vector<float> input = {1.f, 2.f, 3.f, 4.f, 5.f, -1.f, 0.5f, 0.f, 2.f, -2.f};
+  std::vector<float> weights = {0.5f, 1.f,  -1.f, 0.f,   2.f, 1.f, 1.f,  1.f,
+                                1.f,  1.f,  0.f,  -0.5f, 0.f, 0.5f, 0.25f};
+  std::vector<float> bias = {1.f, -20.f, 0.f};
+  // Relu
+  std::vector<float> expected = {10.5f, 0.f, 2.25f, 0.f, 0.f, 0.25f};
+  std::vector<Half> output(expected.size());
+  const auto half_input = ToHalf(input);
+  const auto half_weights = ToHalf(weights);
+  const auto half_bias = ToHalf(bias);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = std::numeric_limits<float>::max();
+  nnfw::cker::Shape weights_shape{3, 5};
+  std::vector<float> packed_weights(nnfw::cker::fp16::PackedWeightsSize(3, 5));
+  nnfw::cker::fp16::PackWeights(half_weights.data(), 3, 5, packed_weights.data());
+  nnfw::cker::fp16::FullyConnected(params, nnfw::cker::Shape{2, 5}, half_input.data(),
+                                   weights_shape, packed_weights.data(), nnfw::cker::Shape{3},
+                                   half_bias.data(), nnfw::cker::Shape{2, 3}, output.data());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation_FP16, FullyConnected_blocks)
+{
+  // Units and rows are not multiples of the panel and block sizes of GEMM
+  const int num_units = 19;
+  const int input_size = 33;
+  for (const int batch_size : {1, 21})
+  {
+    const auto input = Sequence(batch_size * input_size, 0);
+    const auto weights = Sequence(num_units * input_size, 1);
+    const auto bias = Sequence(num_units, 2);
+    const auto half_input = ToHalf(input);
+    const auto half_weights = ToHalf(weights);
+    const auto half_bias = ToHalf(bias);
+
+    nnfw::cker::FullyConnectedParams params;
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+    std::vector<float> packed_weights(nnfw::cker::fp16::PackedWeightsSize(num_units, input_size));
+    nnfw::cker::fp16::PackWeights(half_weights.data(), num_units, input_size,
+                                  packed_weights.data());
+    std::vector<Half> output(batch_size * num_units);
+    nnfw::cker::fp16::FullyConnected(
+      params, nnfw::cker::Shape{batch_size, input_size}, half_input.data(),
+      nnfw::cker::Shape{num_units, input_size}, packed_weights.data(),
+      nnfw::cker::Shape{num_units}, half_bias.data(), nnfw::cker::Shape{batch_size, num_units},
+      output.data());
+
+    for (int b = 0; b < batch_size; ++b)
+    {
+      for (int u = 0; u < num_units; ++u)
+      {
+        float expected = bias[u];
+        for (int i = 0; i < input_size; ++i)
+          expected += input[b * input_size + i] * weights[u * input_size + i];
+        EXPECT_NEAR(output[b * num_units + u], expected, 1e-3f * (1.f + std::abs(expected)));
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation_FP16, BatchMatMul)
+{
+  // lhs [2, 2, 3], rhs [3, 2] broadcast to both batches
+  std::vector<float> lhs = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, -1.f, 0.f, 1.f, 0.5f, 0.5f, 0.5f};
+  std::vector<float> rhs = {1.f, 0.f, 0.f, 1.f, 2.f, -1.f};
+  std::vector<float> expected = {7.f, -1.f, 16.f, -1.f, 1.f, -1.f, 1.5f, 0.f};
+  std::vector<Half> output(expected.size());
+  const auto half_lhs = ToHalf(lhs);
+  const auto half_rhs = ToHalf(rhs);
+
+  nnfw::cker::fp16::BatchMatMul(nnfw::cker::Shape{2, 2, 3}, half_lhs.data(),
+                                nnfw::cker::Shape{3, 2}, half_rhs.data(), false, false,
+                                nnfw::cker::Shape{2, 2, 2}, output.data());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+
+  // Same result with transposed operands
+  std::vector<float> lhs_t = {1.f, 4.f, 2.f, 5.f, 3.f, 6.f, -1.f, 0.5f, 0.f, 0.5f, 1.f, 0.5f};
+  std::vector<float> rhs_t = {1.f, 0.f, 2.f, 0.f, 1.f, -1.f};
+  const auto half_lhs_t = ToHalf(lhs_t);
+  const auto half_rhs_t = ToHalf(rhs_t);
+
+  nnfw::cker::fp16::BatchMatMul(nnfw::cker::Shape{2, 3, 2}, half_lhs_t.data(),
+                                nnfw::cker::Shape{2, 3}, half_rhs_t.data(), true, true,
+                                nnfw::cker::Shape{2, 2, 2}, output.data());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation_FP16, BatchMatMul_blocks)
+{
+  // lhs [2, 21, 13] and rhs [2, 13, 19], transposed by adj_x and adj_y
+  const int batches = 2;
+  const int rows = 21;
+  const int depth = 13;
+  const int cols = 19;
+  const auto lhs = Sequence(batches * rows * depth, 0);
+  const auto rhs = Sequence(batches * depth * cols, 1);
+  std::vector<float> expected(batches * rows * cols, 0.f);
+  for (int b = 0; b < batches; ++b)
+    for (int r = 0; r < rows; ++r)
+      for (int c = 0; c < cols; ++c)
+        for (int d = 0; d < depth; ++d)
+          expected[(b * rows + r) * cols + c] +=
+            lhs[(b * rows + r) * depth + d] * rhs[(b * depth + d) * cols + c];
+
+  for (const bool adj_x : {false, true})
+  {
+    for (const bool adj_y : {false, true})
+    {
+      std::vector<float> lhs_in = lhs;
+      std::vector<float> rhs_in = rhs;
+      if (adj_x)
+      {
+        for (int b = 0; b < batches; ++b)
+          for (int r = 0; r < rows; ++r)
+            for (int d = 0; d < depth; ++d)
+              lhs_in[(b * depth + d) * rows + r] = lhs[(b * rows + r) * depth + d];
+      }
+      if (adj_y)
+      {
+        for (int b = 0; b < batches; ++b)
+          for (int d = 0; d < depth; ++d)
+            for (int c = 0; c < cols; ++c)
+              rhs_in[(b * cols + c) * depth + d] = rhs[(b * depth + d) * cols + c];
+      }
+      const auto half_lhs = ToHalf(lhs_in);
+      const auto half_rhs = ToHalf(rhs_in);
+      nnfw::cker::Shape lhs_shape =
+        adj_x ? nnfw::cker::Shape{batches, depth, rows} : nnfw::cker::Shape{batches, rows, depth};
+      nnfw::cker::Shape rhs_shape =
+        adj_y ? nnfw::cker::Shape{batches, cols, depth} : nnfw::cker::Shape{batches, depth, cols};
+
+      std::vector<Half> output(expected.size());
+      nnfw::cker::fp16::BatchMatMul(lhs_shape, half_lhs.data(), rhs_shape, half_rhs.data(), adj_x,
+                                    adj_y, nnfw::cker::Shape{batches, rows, cols}, output.data());
+      for (size_t i = 0; i < output.size(); ++i)
+        EXPECT_NEAR(output[i], expected[i], 1e-3f * (1.f + std::abs(expected[i])))
+          << "adj_x " << adj_x << " adj_y " << adj_y << " #" << i;
+    }
+  }
+}
@@ -94,11 +94,14 @@ struct OMTrainingContext
  * use cmsis_nn - will CMSIS NN kernels be used or not (needed to some internal settings) wof_ptr -
  * a pointer to the data that stores weights separate from the model train_mode - a flag to indicate
  * whether we are currently in training mode or not
+ * use_memory_arena - place all activation tensors in one arena planned at import instead of heap
+ * allocation per tensor (Note: only for non training mode)
  */
 struct OMConfig
 {
   bool keep_input = false;
   bool cmsis_nn = false;
+  bool use_memory_arena = false;
   // For case with divided weights and circle file
   char *wof_ptr = nullptr;
   bool train_mode = false;
@@ -54,6 +54,9 @@ public:
 
   void *getInputDataAt(uint32_t position);
   void *getOutputDataAt(uint32_t position);
+
+  // Activation memory planned at import with OMConfig::use_memory_arena
+  uint32_t getArenaSize();
 };
 
 } // namespace onert_micro
@@ -58,6 +58,9 @@ public:
   OMStatus getRuntimeGraphAt(uint32_t pos, OMRuntimeGraph **runtime_graph);
 
   OMStatus allocateInputs();
+
+  // Total size of memory arenas planned at import (0 if not planned)
+  uint32_t getArenaSize();
 };
 
 } // namespace core
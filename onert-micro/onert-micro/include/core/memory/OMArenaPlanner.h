@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ONERT_MICRO_CORE_MEMORY_ARENA_PLANNER_H
+#define ONERT_MICRO_CORE_MEMORY_ARENA_PLANNER_H
+
+#include <cstdint>
+#include <vector>
+
+namespace onert_micro
+{
+namespace core
+{
+namespace memory
+{
+
+/*
+ * OMArenaPlanner - assigns offsets in one arena to buffers with known lifetimes
+ * Buffers whose lifetimes overlap never share memory. Placement is greedy by size with first fit:
+ * from the largest buffer, each one takes the lowest aligned offset that doesn't overlap buffers
+ * already placed and alive at the same time.
+ */
+struct OMArenaPlanner
+{
+  static constexpr uint32_t kAlignment = 16;
+
+  struct Buffer
+  {
+    uint32_t size = 0;
+    // Lifetime in kernel indices, both inclusive
+    int32_t first_use = 0;
+    int32_t last_use = 0;
+    // Result of planning
+    uint32_t offset = 0;
+  };
+
+  // Fill offsets of buffers and return required arena size
+  static uint32_t plan(std::vector<Buffer> &buffers);
+};
+
+} // namespace memory
+} // namespace core
+} // namespace onert_micro
+
+#endif // ONERT_MICRO_CORE_MEMORY_ARENA_PLANNER_H
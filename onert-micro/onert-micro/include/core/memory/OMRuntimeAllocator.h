@@ -21,6 +21,8 @@
 #include "core/OMRuntimeContext.h"
 #include "core/OMRuntimeStorage.h"
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 
@@ -33,10 +35,30 @@ namespace memory
 
 class OMRuntimeAllocator
 {
+private:
+  struct ArenaSlot
+  {
+    uint32_t offset;
+    uint32_t size;
+  };
+
 private:
   std::vector<std::vector<uint16_t>> _alloc_plan;
   std::vector<std::vector<uint16_t>> _dealloc_plan;
 
+  // Preallocated memory for tensors planned by planArena (empty if not planned)
+  std::unique_ptr<uint8_t[]> _arena;
+  uint32_t _arena_size = 0;
+  std::unordered_map<uint16_t, ArenaSlot> _arena_slots;
+
+private:
+  bool isArenaData(const uint8_t *data) const
+  {
+    return _arena != nullptr && data >= _arena.get() && data < _arena.get() + _arena_size;
+  }
+
+  OMStatus allocateTensorData(uint16_t tensor_index, uint32_t size, uint8_t **data);
+
 public:
   OMRuntimeAllocator() = default;
   OMRuntimeAllocator(const OMRuntimeAllocator &) = delete;
@@ -49,6 +71,13 @@ public:
 
   std::vector<std::vector<uint16_t>> &getDeallocPlan() { return _dealloc_plan; }
 
+  // Assign all the tensors in alloc plan and graph inputs to offsets of one arena, using their
+  // lifetimes from alloc/dealloc plans. After it, tensors take memory from the arena instead of
+  // heap, except for a dynamic shape tensor which is larger than planned.
+  OMStatus planArena(OMRuntimeContext *context, OMRuntimeStorage *storage);
+
+  uint32_t getArenaSize() const { return _arena_size; }
+
   OMStatus allocateGraphInputs(OMRuntimeContext *context, OMRuntimeStorage *storage);
 
   OMStatus clearAllTensorsData(OMRuntimeContext *context, OMRuntimeStorage *storage);
@@ -56,3 +56,5 @@ uint32_t OMInterpreter::getOutputSizeAt(uint32_t position)
 }
 
 OMStatus OMInterpreter::allocateInputs() { return _runtime_module.allocateInputs(); }
+
+uint32_t OMInterpreter::getArenaSize() { return _runtime_module.getArenaSize(); }
@@ -57,7 +57,7 @@ OMStatus OMRuntimeModule::importModel(const char *model_ptr, const OMConfig &con
   // 1 - parse reader
   // 2 - load default graph
   // 3 - optimize it until can
-  // 4 - AllocDeallocPlan creation
+  // 4 - AllocDeallocPlan creation (and arena planning)
   // 5 - KernelConfigure
   // 6 - Allocate inputs
 
@@ -110,6 +110,8 @@ OMStatus OMRuntimeModule::importModel(const char *model_ptr, const OMConfig &con
       // Non trainable mode
       status = import::OMExecutionPlanCreator::createExecutionPlan(runtime_storage, runtime_context,
                                                                    runtime_allocator, config);
+      if (status == Ok and config.use_memory_arena)
+        status = runtime_allocator.planArena(&runtime_context, &runtime_storage);
     }
     else
     {
@@ -140,6 +142,14 @@ OMStatus OMRuntimeModule::importModel(const char *model_ptr, const OMConfig &con
   return Ok;
 }
 
+uint32_t OMRuntimeModule::getArenaSize()
+{
+  uint32_t arena_size = 0;
+  for (auto &graph : _graphs)
+    arena_size += graph.getRuntimeAllocator().getArenaSize();
+  return arena_size;
+}
+
 OMStatus OMRuntimeModule::allocateInputs()
 {
   assert(_graphs.size() > 0);
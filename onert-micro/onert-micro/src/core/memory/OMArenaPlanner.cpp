@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/memory/OMArenaPlanner.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace onert_micro::core::memory;
+
+namespace
+{
+
+uint32_t alignOffset(uint32_t offset)
+{
+  constexpr uint32_t alignment = OMArenaPlanner::kAlignment;
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+uint32_t OMArenaPlanner::plan(std::vector<Buffer> &buffers)
+{
+  // Place larger buffers first
+  std::vector<size_t> order(buffers.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&buffers](size_t lhs, size_t rhs) {
+    return buffers[lhs].size > buffers[rhs].size;
+  });
+
+  uint32_t arena_size = 0;
+  std::vector<size_t> placed;
+  std::vector<size_t> interfering;
+  placed.reserve(buffers.size());
+  interfering.reserve(buffers.size());
+
+  for (const auto index : order)
+  {
+    Buffer &buffer = buffers[index];
+
+    // Placed buffers alive at the same time, in offset order
+    interfering.clear();
+    for (const auto placed_index : placed)
+    {
+      const Buffer &other = buffers[placed_index];
+      if (other.first_use <= buffer.last_use && buffer.first_use <= other.last_use)
+        interfering.push_back(placed_index);
+    }
+    std::sort(interfering.begin(), interfering.end(), [&buffers](size_t lhs, size_t rhs) {
+      return buffers[lhs].offset < buffers[rhs].offset;
+    });
+
+    // Find the lowest gap that fits
+    uint32_t offset = 0;
+    for (const auto other_index : interfering)
+    {
+      const Buffer &other = buffers[other_index];
+      if (offset + buffer.size <= other.offset)
+        break;
+      offset = std::max(offset, alignOffset(other.offset + other.size));
+    }
+
+    buffer.offset = offset;
+    arena_size = std::max(arena_size, offset + buffer.size);
+    placed.push_back(index);
+  }
+
+  return arena_size;
+}
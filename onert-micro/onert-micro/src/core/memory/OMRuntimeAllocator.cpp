@@ -16,9 +16,13 @@
 
 #include "core/memory/OMRuntimeAllocator.h"
 #include "core/memory/OMMemoryManager.h"
+#include "core/memory/OMArenaPlanner.h"
 
 #include "core/OMDataType.h"
+
+#include <algorithm>
 #include <limits>
+#include <unordered_set>
 
 using namespace onert_micro::core::memory;
 using namespace onert_micro;
@@ -31,6 +35,9 @@ OMStatus OMRuntimeAllocator::clearAllTensorsData(OMRuntimeContext *context,
   for (auto &cur_tensor_index_data : tensor_index_to_data)
   {
     uint8_t *allocated_data = cur_tensor_index_data.second;
+    // Arena memory is kept for the next run
+    if (isArenaData(allocated_data))
+      continue;
 #ifdef OM_MEMORY_ESTIMATE
     auto tensor_index = cur_tensor_index_data.first;
 
@@ -91,7 +98,7 @@ OMStatus OMRuntimeAllocator::allocate(size_t kernel_index, OMRuntimeContext *con
     assert(storage->getDataByTensorIndex(&allocated_data, tensor_index) == Ok &&
            allocated_data == nullptr && "Double allocate, memory leak");
     OMStatus status =
-      OMMemoryManager::allocateMemory(casted_num_elements * type_size, &allocated_data);
+      allocateTensorData(tensor_index, casted_num_elements * type_size, &allocated_data);
     if (status != Ok)
       return status;
 
@@ -121,6 +128,14 @@ OMStatus OMRuntimeAllocator::deallocate(size_t kernel_index, OMRuntimeStorage *s
     if (status != Ok)
       return status;
 
+    if (isArenaData(allocated_data))
+    {
+      status = storage->removeTensorFromTensorIndexToData(tensor_index);
+      if (status != Ok)
+        return status;
+      continue;
+    }
+
     auto tensor = context->getTensorByIndex(tensor_index);
     auto num_elements = OMRuntimeShape(tensor).flatSize();
 
@@ -163,8 +178,11 @@ OMStatus OMRuntimeAllocator::deallocate(size_t kernel_index, OMRuntimeStorage *s
     if (allocated_data == nullptr)
       continue;
 
-    status = OMMemoryManager::deallocateMemory(allocated_data);
-    assert(status == Ok); // note that status always 0
+    if (not isArenaData(allocated_data))
+    {
+      status = OMMemoryManager::deallocateMemory(allocated_data);
+      assert(status == Ok); // note that status always 0
+    }
 
     status = storage->removeTensorFromTensorIndexToData(tensor_index);
     if (status != Ok)
@@ -197,6 +215,8 @@ OMStatus OMRuntimeAllocator::allocateGraphInputs(OMRuntimeContext *context,
     uint8_t *allocated_data = nullptr;
     // First clear if already allocated
     status = storage->getDataByTensorIndex(&allocated_data, tensor_index);
+    if (isArenaData(allocated_data))
+      allocated_data = nullptr;
 
 #ifdef OM_MEMORY_ESTIMATE
 #ifndef DIS_DYN_SHAPES
@@ -212,7 +232,7 @@ OMStatus OMRuntimeAllocator::allocateGraphInputs(OMRuntimeContext *context,
 #endif // OM_MEMORY_ESTIMATE
 
     // Then Allocate
-    status = OMMemoryManager::allocateMemory(casted_num_elements * type_size, &allocated_data);
+    status = allocateTensorData(tensor_index, casted_num_elements * type_size, &allocated_data);
     if (status != Ok)
       return status;
 
@@ -221,3 +241,137 @@ OMStatus OMRuntimeAllocator::allocateGraphInputs(OMRuntimeContext *context,
 
   return status;
 }
+
+OMStatus OMRuntimeAllocator::allocateTensorData(uint16_t tensor_index, uint32_t size,
+                                                uint8_t **data)
+{
+  auto it = _arena_slots.find(tensor_index);
+  // Dynamic shape tensor can be larger than planned one
+  if (it != _arena_slots.end() and size <= it->second.size)
+  {
+    *data = _arena.get() + it->second.offset;
+    return Ok;
+  }
+
+  return OMMemoryManager::allocateMemory(size, data);
+}
+
+OMStatus OMRuntimeAllocator::planArena(OMRuntimeContext *context, OMRuntimeStorage *storage)
+{
+  _arena.reset();
+  _arena_size = 0;
+  _arena_slots.clear();
+
+  const auto num_kernels = static_cast<int32_t>(_alloc_plan.size());
+  assert(_dealloc_plan.size() == _alloc_plan.size() + 1);
+  if (_dealloc_plan.size() != _alloc_plan.size() + 1)
+    return UnknownError;
+
+  // Buffer owners: tensors allocated by alloc plan or as graph inputs
+  std::unordered_map<uint16_t, OMArenaPlanner::Buffer> buffers;
+  auto add_buffer = [&](uint16_t tensor_index, int32_t first_use) {
+    const circle::Tensor *tensor = context->getTensorByIndex(tensor_index);
+    const int32_t num_elements = OMRuntimeShape(tensor).flatSize();
+    // Unknown size: leave it to heap
+    if (num_elements <= 0)
+      return;
+    const auto type_size =
+      static_cast<uint32_t>(getOMDataTypeSize(onertMicroDatatype(tensor->type())));
+    if (static_cast<uint32_t>(num_elements) > std::numeric_limits<uint32_t>::max() / type_size)
+      return;
+
+    OMArenaPlanner::Buffer buffer;
+    buffer.size = static_cast<uint32_t>(num_elements) * type_size;
+    buffer.first_use = first_use;
+    buffers[tensor_index] = buffer;
+  };
+
+  const auto *graph_inputs = context->getCircleInputs();
+  for (uint32_t i = 0; graph_inputs != nullptr and i < graph_inputs->size(); ++i)
+    add_buffer(graph_inputs->operator[](i), 0);
+  for (int32_t i = 0; i < num_kernels; ++i)
+  {
+    for (const uint16_t tensor_index : _alloc_plan[i])
+      add_buffer(tensor_index, i);
+  }
+
+  // Inplace kernel moves data of i-th input to i-th output, so the output shares the buffer
+  std::unordered_map<uint16_t, uint16_t> tensor_to_owner;
+  std::unordered_set<uint16_t> moved_tensors;
+  for (const auto &buffer : buffers)
+    tensor_to_owner[buffer.first] = buffer.first;
+
+  const reader::CircleOperators *operators = context->getCircleOperators();
+  for (int32_t i = 0; i < num_kernels; ++i)
+  {
+    if (storage->getKernelType(i) != Inplace)
+      continue;
+
+    const auto *op = operators->operator[](i);
+    const auto *op_inputs = op->inputs();
+    const auto *op_outputs = op->outputs();
+    for (uint32_t j = 0; j < op_outputs->size() and j < op_inputs->size(); ++j)
+    {
+      const auto input_index = op_inputs->operator[](j);
+      const auto output_index = op_outputs->operator[](j);
+      if (input_index == -1 or output_index == -1)
+        continue;
+      auto it = tensor_to_owner.find(input_index);
+      if (it == tensor_to_owner.end())
+        continue;
+
+      const uint16_t owner = it->second;
+      tensor_to_owner[output_index] = owner;
+      moved_tensors.insert(input_index);
+
+      // Output may be larger if its shape is different
+      const circle::Tensor *tensor = context->getTensorByIndex(output_index);
+      const int32_t num_elements = OMRuntimeShape(tensor).flatSize();
+      const auto type_size =
+        static_cast<uint32_t>(getOMDataTypeSize(onertMicroDatatype(tensor->type())));
+      if (num_elements > 0)
+        buffers[owner].size =
+          std::max(buffers[owner].size, static_cast<uint32_t>(num_elements) * type_size);
+    }
+  }
+
+  // Buffer is alive until the last use of tensors sharing it. Tensor moved to inplace output
+  // doesn't use the buffer anymore, and other tensor without deallocation lives until the end.
+  std::unordered_map<uint16_t, int32_t> tensor_last_use;
+  for (int32_t i = 0; i <= num_kernels; ++i)
+  {
+    for (const uint16_t tensor_index : _dealloc_plan[i])
+      tensor_last_use[tensor_index] = i;
+  }
+  for (auto &buffer : buffers)
+    buffer.second.last_use = buffer.second.first_use;
+  for (const auto &item : tensor_to_owner)
+  {
+    if (moved_tensors.count(item.first) > 0)
+      continue;
+    auto it = tensor_last_use.find(item.first);
+    const int32_t last_use = it != tensor_last_use.end() ? it->second : num_kernels;
+    auto &buffer = buffers[item.second];
+    buffer.last_use = std::max(buffer.last_use, last_use);
+  }
+
+  std::vector<uint16_t> owners;
+  std::vector<OMArenaPlanner::Buffer> planned;
+  owners.reserve(buffers.size());
+  planned.reserve(buffers.size());
+  for (const auto &buffer : buffers)
+  {
+    owners.push_back(buffer.first);
+    planned.push_back(buffer.second);
+  }
+
+  _arena_size = OMArenaPlanner::plan(planned);
+  if (_arena_size == 0)
+    return Ok;
+
+  _arena.reset(new uint8_t[_arena_size]);
+  for (size_t i = 0; i < owners.size(); ++i)
+    _arena_slots[owners[i]] = ArenaSlot{planned[i].offset, planned[i].size};
+
+  return Ok;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/memory/OMArenaPlanner.h"
+
+#include <gtest/gtest.h>
+
+namespace onert_micro
+{
+namespace core
+{
+namespace memory
+{
+namespace test
+{
+
+using namespace testing;
+
+namespace
+{
+
+OMArenaPlanner::Buffer makeBuffer(uint32_t size, int32_t first_use, int32_t last_use)
+{
+  OMArenaPlanner::Buffer buffer;
+  buffer.size = size;
+  buffer.first_use = first_use;
+  buffer.last_use = last_use;
+  return buffer;
+}
+
+bool isLifetimeOverlapped(const OMArenaPlanner::Buffer &lhs, const OMArenaPlanner::Buffer &rhs)
+{
+  return lhs.first_use <= rhs.last_use && rhs.first_use <= lhs.last_use;
+}
+
+bool isMemoryOverlapped(const OMArenaPlanner::Buffer &lhs, const OMArenaPlanner::Buffer &rhs)
+{
+  return lhs.offset < rhs.offset + rhs.size && rhs.offset < lhs.offset + lhs.size;
+}
+
+} // namespace
+
+TEST(OMArenaPlannerTest, Empty_P)
+{
+  std::vector<OMArenaPlanner::Buffer> buffers;
+
+  EXPECT_EQ(OMArenaPlanner::plan(buffers), 0);
+}
+
+TEST(OMArenaPlannerTest, DisjointLifetimes_P)
+{
+  std::vector<OMArenaPlanner::Buffer> buffers = {makeBuffer(40, 0, 0), makeBuffer(100, 1, 1),
+                                                 makeBuffer(60, 2, 2)};
+
+  const uint32_t arena_size = OMArenaPlanner::plan(buffers);
+
+  // Every buffer reuses the same memory
+  EXPECT_EQ(arena_size, 100);
+  for (const auto &buffer : buffers)
+    EXPECT_EQ(buffer.offset, 0);
+}
+
+TEST(OMArenaPlannerTest, OverlappedLifetimes_P)
+{
+  // 0: [0, 1], 1: [1, 2], 2: [2, 3]
+  std::vector<OMArenaPlanner::Buffer> buffers = {makeBuffer(100, 0, 1), makeBuffer(50, 1, 2),
+                                                 makeBuffer(80, 2, 3)};
+
+  const uint32_t arena_size = OMArenaPlanner::plan(buffers);
+
+  // The largest and the last one don't meet, the middle one goes after both of them
+  EXPECT_EQ(buffers[0].offset, 0);
+  EXPECT_EQ(buffers[2].offset, 0);
+  EXPECT_EQ(buffers[1].offset, 112);
+  EXPECT_EQ(arena_size, 162);
+}
+
+TEST(OMArenaPlannerTest, ReuseGap_P)
+{
+  std::vector<OMArenaPlanner::Buffer> buffers = {makeBuffer(100, 0, 2), makeBuffer(64, 0, 0),
+                                                 makeBuffer(32, 1, 1)};
+
+  const uint32_t arena_size = OMArenaPlanner::plan(buffers);
+
+  // The last one takes the place of the second one which is dead already
+  EXPECT_EQ(buffers[0].offset, 0);
+  EXPECT_EQ(buffers[1].offset, 112);
+  EXPECT_EQ(buffers[2].offset, 112);
+  EXPECT_EQ(arena_size, 176);
+}
+
+TEST(OMArenaPlannerTest, Alignment_P)
+{
+  std::vector<OMArenaPlanner::Buffer> buffers = {makeBuffer(7, 0, 3), makeBuffer(5, 0, 3),
+                                                 makeBuffer(3, 0, 3)};
+
+  const uint32_t arena_size = OMArenaPlanner::plan(buffers);
+
+  for (const auto &buffer : buffers)
+    EXPECT_EQ(buffer.offset % OMArenaPlanner::kAlignment, 0);
+  EXPECT_EQ(arena_size, 2 * OMArenaPlanner::kAlignment + 3);
+}
+
+TEST(OMArenaPlannerTest, NoOverlapOfAliveBuffers_P)
+{
+  // Lifetimes and sizes of a chain of kernels with some long living buffers
+  std::vector<OMArenaPlanner::Buffer> buffers;
+  uint32_t sum_size = 0;
+  for (int32_t i = 0; i < 32; ++i)
+  {
+    const uint32_t size = 4 * (1 + (i * 37) % 29);
+    const int32_t last_use = i + 1 + (i % 5 == 0 ? 7 : i % 3);
+    buffers.push_back(makeBuffer(size, i, last_use));
+    sum_size += size + OMArenaPlanner::kAlignment;
+  }
+
+  const uint32_t arena_size = OMArenaPlanner::plan(buffers);
+
+  EXPECT_LE(arena_size, sum_size);
+  for (size_t i = 0; i < buffers.size(); ++i)
+  {
+    EXPECT_LE(buffers[i].offset + buffers[i].size, arena_size);
+    for (size_t j = i + 1; j < buffers.size(); ++j)
+    {
+      if (isLifetimeOverlapped(buffers[i], buffers[j]))
+        EXPECT_FALSE(isMemoryOverlapped(buffers[i], buffers[j]))
+          << "buffers " << i << " and " << j << " are alive together";
+    }
+  }
+}
+
+} // namespace test
+} // namespace memory
+} // namespace core
+} // namespace onert_micro
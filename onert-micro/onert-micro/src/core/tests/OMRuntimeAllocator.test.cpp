@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/memory/OMRuntimeAllocator.h"
+#include "core/memory/OMArenaPlanner.h"
+#include "core/OMDataType.h"
+#include "import/OMExecutionPlanCreator.h"
+#include "train/tests/models/numbers_classification_model.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace onert_micro
+{
+namespace core
+{
+namespace memory
+{
+namespace test
+{
+
+using namespace testing;
+
+class OMRuntimeAllocatorTest : public ::testing::Test
+{
+public:
+  OMRuntimeAllocatorTest()
+  {
+    using onert_micro::train::test::models::numbers_classification_model;
+    const auto *model_ptr = reinterpret_cast<const char *>(numbers_classification_model);
+    EXPECT_EQ(context.setModel(model_ptr, 0), Ok);
+    EXPECT_EQ(import::OMExecutionPlanCreator::createExecutionPlan(storage, context, allocator,
+                                                                  config),
+              Ok);
+  }
+
+  uint32_t getTensorSize(uint16_t tensor_index)
+  {
+    const circle::Tensor *tensor = context.getTensorByIndex(tensor_index);
+    const auto type_size = getOMDataTypeSize(onertMicroDatatype(tensor->type()));
+    return OMRuntimeShape(tensor).flatSize() * type_size;
+  }
+
+  OMConfig config = {};
+  OMRuntimeContext context;
+  OMRuntimeStorage storage;
+  OMRuntimeAllocator allocator;
+};
+
+TEST_F(OMRuntimeAllocatorTest, ArenaSize_P)
+{
+  // Graph inputs and tensors of alloc plan are placed in the arena
+  std::vector<uint16_t> tensors;
+  const auto *graph_inputs = context.getCircleInputs();
+  for (uint32_t i = 0; i < graph_inputs->size(); ++i)
+    tensors.push_back(graph_inputs->operator[](i));
+  for (const auto &kernel_plan : allocator.getAllocPlan())
+    tensors.insert(tensors.end(), kernel_plan.begin(), kernel_plan.end());
+
+  uint32_t sum_size = 0;
+  uint32_t max_size = 0;
+  for (const uint16_t tensor_index : tensors)
+  {
+    sum_size += getTensorSize(tensor_index) + OMArenaPlanner::kAlignment;
+    max_size = std::max(max_size, getTensorSize(tensor_index));
+  }
+
+  EXPECT_EQ(allocator.getArenaSize(), 0);
+  EXPECT_EQ(allocator.planArena(&context, &storage), Ok);
+
+  EXPECT_GE(allocator.getArenaSize(), max_size);
+  EXPECT_LE(allocator.getArenaSize(), sum_size);
+}
+
+TEST_F(OMRuntimeAllocatorTest, NoOverlapOfAliveTensors_P)
+{
+  ASSERT_EQ(allocator.planArena(&context, &storage), Ok);
+  ASSERT_EQ(allocator.allocateGraphInputs(&context, &storage), Ok);
+
+  const size_t num_kernels = allocator.getAllocPlan().size();
+  ASSERT_GT(num_kernels, 1);
+  for (size_t i = 0; i < num_kernels; ++i)
+  {
+    ASSERT_EQ(allocator.allocate(i, &context, &storage), Ok);
+
+    // Memory ranges of the tensors alive while the kernel runs
+    std::vector<std::pair<const uint8_t *, const uint8_t *>> ranges;
+    for (const auto &tensor_data : storage.getTensorIndexToData())
+    {
+      if (tensor_data.second == nullptr)
+        continue;
+      const uint32_t size = getTensorSize(tensor_data.first);
+      ranges.emplace_back(tensor_data.second, tensor_data.second + size);
+    }
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t j = 1; j < ranges.size(); ++j)
+      EXPECT_LE(ranges[j - 1].second, ranges[j].first) << "at kernel " << i;
+
+    ASSERT_EQ(allocator.deallocate(i, &storage), Ok);
+  }
+
+  EXPECT_EQ(allocator.clearAllTensorsData(&context, &storage), Ok);
+}
+
+TEST_F(OMRuntimeAllocatorTest, Replan_P)
+{
+  ASSERT_EQ(allocator.planArena(&context, &storage), Ok);
+  const uint32_t arena_size = allocator.getArenaSize();
+
+  // Planning is deterministic and doesn't accumulate
+  EXPECT_EQ(allocator.planArena(&context, &storage), Ok);
+  EXPECT_EQ(allocator.getArenaSize(), arena_size);
+}
+
+TEST_F(OMRuntimeAllocatorTest, BrokenPlan_NEG)
+{
+  allocator.getDeallocPlan().pop_back();
+
+  EXPECT_DEATH(allocator.planArena(&context, &storage), "");
+}
+
+} // namespace test
+} // namespace memory
+} // namespace core
+} // namespace onert_micro
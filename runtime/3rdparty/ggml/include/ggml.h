@@ -2054,6 +2054,15 @@ extern "C" {
     // note: the drawback of this API is that you must have ensured that the context has enough memory for the work data
     GGML_API enum ggml_status  ggml_graph_compute_with_ctx(struct ggml_context * ctx, struct ggml_cgraph * cgraph, int n_threads);
 
+    // [FIX] add
+    // same as ggml_graph_compute() but runs on threads provided by caller
+    // runner must call task(task_data, ith) for ith in [0, n_threads) concurrently and return after all of them finish
+    typedef void (*ggml_compute_task_t)(void * task_data, int ith);
+    typedef void (*ggml_compute_runner_t)(void * runner_data, int n_threads, ggml_compute_task_t task, void * task_data);
+    GGML_API enum ggml_status  ggml_graph_compute_with_runner(struct ggml_cgraph * cgraph, struct ggml_cplan * cplan,
+                                                              ggml_compute_runner_t runner, void * runner_data);
+    // [FIX] end
+
     GGML_API struct ggml_tensor * ggml_graph_get_tensor(struct ggml_cgraph * cgraph, const char * name);
 
     GGML_API void                 ggml_graph_export(const struct ggml_cgraph * cgraph, const char * fname);
@@ -3205,9 +3205,11 @@ void ggml_numa_init(enum ggml_numa_strategy numa_flag) {
 #endif
 }
 
+#endif // [FIX] end
 bool ggml_is_numa(void) {
     return g_state.numa.n_nodes > 1;
 }
+#if 0 // [FIX] disable
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -3339,6 +3341,7 @@ bool ggml_is_3d(const struct ggml_tensor * tensor) {
     return tensor->ne[3] == 1;
 }
 
+#endif // [FIX] end
 int ggml_n_dims(const struct ggml_tensor * tensor) {
     for (int i = GGML_MAX_DIMS - 1; i >= 1; --i) {
         if (tensor->ne[i] > 1) {
@@ -3347,6 +3350,7 @@ int ggml_n_dims(const struct ggml_tensor * tensor) {
     }
     return 1;
 }
+#if 0 // [FIX] disable
 
 static inline bool ggml_can_mul_mat(const struct ggml_tensor * t0, const struct ggml_tensor * t1) {
     static_assert(GGML_MAX_DIMS == 4, "GGML_MAX_DIMS is not 4 - update this function");
@@ -3410,6 +3414,7 @@ GGML_CALL bool ggml_is_transposed(const struct ggml_tensor * tensor) {
     return tensor->nb[0] > tensor->nb[1];
 }
 
+#endif // [FIX] end
 static bool ggml_is_contiguous_n(const struct ggml_tensor * tensor, int n) {
     size_t next_nb = ggml_type_size(tensor->type);
     if (tensor->ne[0] != ggml_blck_size(tensor->type) && tensor->nb[0] != next_nb) {
@@ -3439,6 +3444,7 @@ GGML_CALL bool ggml_is_contiguous(const struct ggml_tensor * tensor) {
 GGML_CALL bool ggml_is_contiguous_0(const struct ggml_tensor * tensor) {
     return ggml_is_contiguous_n(tensor, 0);
 }
+#if 0 // [FIX] disable
 
 GGML_CALL bool ggml_is_contiguous_1(const struct ggml_tensor * tensor) {
     return ggml_is_contiguous_n(tensor, 1);
@@ -12252,6 +12258,7 @@ static void ggml_compute_forward_group_norm(
     }
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_mul_mat
 
 static void ggml_compute_forward_mul_mat_one_chunk(
@@ -12560,6 +12567,7 @@ UseGgmlGemm2:;
     }
 }
 
+#if 0 // [FIX] disable
 // ggml_compute_forward_mul_mat_id
 
 static void ggml_compute_forward_mul_mat_id(
@@ -16898,10 +16906,12 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_group_norm(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_MUL_MAT:
             {
                 ggml_compute_forward_mul_mat(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_MUL_MAT_ID:
             {
                 ggml_compute_forward_mul_mat_id(params, tensor);
@@ -19061,6 +19071,52 @@ enum ggml_status ggml_graph_compute(struct ggml_cgraph * cgraph, struct ggml_cpl
     return state_shared.ec;
 }
 
+// [FIX] add
+static void ggml_graph_compute_task(void * task_data, int ith) {
+    struct ggml_compute_state * workers = (struct ggml_compute_state *) task_data;
+    ggml_graph_compute_thread(&workers[ith]);
+}
+
+enum ggml_status ggml_graph_compute_with_runner(struct ggml_cgraph * cgraph, struct ggml_cplan * cplan,
+                                                ggml_compute_runner_t runner, void * runner_data) {
+    GGML_ASSERT(cplan);
+    GGML_ASSERT(cplan->n_threads > 0);
+    GGML_ASSERT(cplan->work_size == 0 || cplan->work_data != NULL);
+    GGML_ASSERT(runner);
+
+    int n_threads = cplan->n_threads;
+
+    struct ggml_compute_state_shared state_shared = {
+        /*.cgraph                  =*/ cgraph,
+        /*.cgraph_plan             =*/ cplan,
+        /*.n_threads               =*/ n_threads,
+        /*.n_barrier               =*/ 0,
+        /*.n_barrier_passed        =*/ 0,
+        /*.abort_callback          =*/ NULL,
+        /*.abort_callback_data     =*/ NULL,
+        /*.current_chunk           =*/ 0,
+        /*.ec                      =*/ GGML_STATUS_SUCCESS,
+    };
+
+    struct ggml_compute_state * workers = alloca(sizeof(struct ggml_compute_state)*n_threads);
+
+    for (int j = 0; j < n_threads; ++j) {
+        workers[j] = (struct ggml_compute_state) {
+            .thrd   = 0,
+            .ith    = j,
+            .shared = &state_shared,
+        };
+    }
+
+    runner(runner_data, n_threads, ggml_graph_compute_task, workers);
+
+    // don't leave affinity set on the caller thread
+    clear_numa_thread_affinity();
+
+    return state_shared.ec;
+}
+// [FIX] end
+
 enum ggml_status ggml_graph_compute_with_ctx(struct ggml_context * ctx, struct ggml_cgraph * cgraph, int n_threads) {
     struct ggml_cplan cplan = ggml_graph_plan(cgraph, n_threads);
 
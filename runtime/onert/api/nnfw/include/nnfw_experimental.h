@@ -117,25 +117,28 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
 /**
- * @brief Prepare session to be ready for inference
+ * @brief Prepare session to run partitioned models as a streaming pipeline
  *
- * This phase may finalize model compilation, scheduling, and additional settings.
+ * Each model of multi-model nnpackage runs on its own thread as a pipeline stage, and stages are
+ * joined by bounded queues. So next input can enter the first model while previous input is still
+ * in the next model. This function compiles the nnpackage if it is not prepared yet.
  *
- * @deprecated Deprecated since 1.22.1
+ * @note Backend mapping file is not supported yet, so \p map_file_path must be NULL.
+ *       Use {@link nnfw_set_available_backends} or configuration before this function instead.
  *
- * @param session the session to be prepared
- * @return NNFW_STATUS_NO_ERROR if successful
+ * @param[in] session       the session to be prepared
+ * @param[in] map_file_path reserved for backend mapping file, it must be NULL
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
  */
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path = nullptr);
 
 /**
- * @brief     Set input buffer
- *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p inputs given to this
- * function can be reused for many inferences. \p lengths must be greater or equal than the operand
- * requires. if you give empty \p inputs to this function, then this function will join all threads.
+ * @brief     Push inputs of one inference to pipeline
  *
- * @deprecated Deprecated since 1.22.1
+ * This function must be called after {@link nnfw_prepare_pipeline}. \p inputs are copied into
+ * pipeline, so they can be reused after this function returns. This function blocks while the
+ * pipeline is full. If you give empty \p inputs to this function, then the input stream is
+ * finished and this function will join all threads. Outputs of pushed inputs can still be popped.
  *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
@@ -150,10 +153,10 @@ NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *
 /**
  * @brief       Get last outputs of partitioned model in session
  *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p outputs given to this
- * function must be cleared for memory management.
- *
- * @deprecated Deprecated since 1.22.1
+ * This function must be called after {@link nnfw_prepare_pipeline}. It waits for the oldest
+ * pushed inference and appends its output buffers to \p outputs. Appended buffers are allocated
+ * by runtime with \p new uint8_t[], so they must be released by user with \p delete[].
+ * If input stream is finished and all outputs are popped, \p outputs is left unchanged.
  *
  * @param[in]   session Session from last outputs is to be extracted
  * @param[out]  outputs Raw buffer for outputs, it must be \p std::vector<void *> type pointer for
@@ -611,6 +614,14 @@ typedef enum
    * TODO: Use workspace
    */
   NNFW_RUN_CONFIG_PROFILE,
+  /**
+   * Record latencies of executions into histograms (value: record 1 in N executions, default 1)
+   *
+   * Without this configuration, 1 in 100 executions are recorded (STATS_SAMPLING config).
+   * Recorded latencies can be queried by {@link nnfw_get_run_stats},
+   * {@link nnfw_get_operation_stats} and {@link nnfw_get_backend_stats}.
+   */
+  NNFW_RUN_CONFIG_STATS,
 } NNFW_RUN_CONFIG;
 
 /**
@@ -638,6 +649,57 @@ NNFW_STATUS nnfw_set_execute_config(nnfw_session *session, const NNFW_RUN_CONFIG
  */
 NNFW_STATUS nnfw_reset_execute_config(nnfw_session *session);
 
+/**
+ * @brief Latency statistics of sampled executions
+ */
+typedef struct
+{
+  /** The number of sampled executions */
+  uint64_t count;
+  /** Median latency in nanoseconds */
+  uint64_t p50;
+  /** 99th percentile latency in nanoseconds */
+  uint64_t p99;
+  /** Sum of latencies in nanoseconds */
+  uint64_t total;
+} nnfw_latency_stats;
+
+/**
+ * @brief     Get latency statistics of whole runs
+ *
+ * Latencies of sampled runs are recorded, see {@link NNFW_RUN_CONFIG_STATS}.
+ * This function can be called while the session is running.
+ *
+ * @param[in]  session nnfw_session to get statistics
+ * @param[out] stats   Latency statistics of runs
+ * @return     @c NNFW_STATUS_NO_ERROR if successful,
+ *             @c NNFW_STATUS_INVALID_STATE if the session is not prepared
+ */
+NNFW_STATUS nnfw_get_run_stats(nnfw_session *session, nnfw_latency_stats *stats);
+
+/**
+ * @brief     Get latency statistics of an operation in the primary subgraph
+ *
+ * @param[in]  session nnfw_session to get statistics
+ * @param[in]  index   Index of operation in the primary subgraph
+ * @param[out] stats   Latency statistics of the operation
+ * @return     @c NNFW_STATUS_NO_ERROR if successful,
+ *             @c NNFW_STATUS_ERROR if there is no such operation or nothing is recorded yet
+ */
+NNFW_STATUS nnfw_get_operation_stats(nnfw_session *session, uint32_t index,
+                                     nnfw_latency_stats *stats);
+
+/**
+ * @brief     Get latency statistics of operations in the primary subgraph run on a backend
+ *
+ * @param[in]  session nnfw_session to get statistics
+ * @param[in]  backend Backend id (ex: "cpu")
+ * @param[out] stats   Latency statistics of operations run on the backend
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_backend_stats(nnfw_session *session, const char *backend,
+                                   nnfw_latency_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -364,19 +364,23 @@ NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *b
   return session->set_backends_per_operation(backend_settings);
 }
 
-NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *, const char *)
+NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path)
 {
-  return nnfw_session::deprecated("nnfw_prepare_pipeline: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_pipeline(map_file_path);
 }
 
-NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *, void *, void *)
+NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths)
 {
-  return nnfw_session::deprecated("nnfw_push_pipeline_input: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->push_pipeline_input(reinterpret_cast<std::vector<void *> *>(inputs),
+                                      reinterpret_cast<std::vector<uint32_t> *>(lengths));
 }
 
-NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *, void *)
+NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
 {
-  return nnfw_session::deprecated("nnfw_pop_pipeline_output: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->pop_pipeline_output(reinterpret_cast<std::vector<void *> *>(outputs));
 }
 
 NNFW_STATUS nnfw_set_workspace(nnfw_session *session, const char *dir)
@@ -535,3 +539,23 @@ NNFW_STATUS nnfw_reset_execute_config(nnfw_session *session)
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->reset_execute_config();
 }
+
+NNFW_STATUS nnfw_get_run_stats(nnfw_session *session, nnfw_latency_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_run_stats(stats);
+}
+
+NNFW_STATUS nnfw_get_operation_stats(nnfw_session *session, uint32_t index,
+                                     nnfw_latency_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_operation_stats(index, stats);
+}
+
+NNFW_STATUS nnfw_get_backend_stats(nnfw_session *session, const char *backend,
+                                   nnfw_latency_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_backend_stats(backend, stats);
+}
@@ -21,6 +21,7 @@
 #include "util/Exceptions.h"
 #include "util/logging.h"
 #include "exec/Execution.h"
+#include "exec/LatencyStats.h"
 #include "loader/CircleLoader.h"
 #include "loader/ModelLoader.h"
 #include "loader/TFLiteLoader.h"
@@ -36,6 +37,8 @@
 #include "odc/QuantizeManager.h"
 #include "odc/CodegenManager.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -500,6 +503,13 @@ NNFW_STATUS nnfw_session::run()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_execution->isPipelineStarted())
+  {
+    std::cerr << "Error during nnfw_session::run : "
+              << "run cannot be used with pipeline execution" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   try
   {
     _execution->execute();
@@ -935,6 +945,18 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     _coptions->he_profiling_mode = toBool(value);
   }
+  else if (skey == config::SEARCH_ORDER)
+  {
+    _coptions->search_order = toBool(value);
+  }
+  else if (skey == config::TRAIN_RECOMPUTE_BUDGET)
+  {
+    _coptions->train_recompute_budget = toInt(value);
+  }
+  else if (skey == config::TRAIN_NUM_REPLICAS)
+  {
+    _coptions->train_num_replicas = toInt(value);
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -1158,6 +1180,103 @@ NNFW_STATUS nnfw_session::set_backends_per_operation(const char *backend_setting
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
+{
+  // TODO Support backend mapping file for each partitioned model
+  if (map_file_path != nullptr)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : "
+              << "backend mapping file is not supported yet" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (isStateModelLoaded())
+  {
+    auto status = prepare();
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+  }
+
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    _execution->startPipeline(0);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *inputs,
+                                              std::vector<uint32_t> *lengths)
+{
+  if (inputs == nullptr || lengths == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun() || !_execution->isPipelineStarted())
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : "
+              << "push_pipeline_input should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    // Empty inputs mean the end of input stream
+    if (inputs->empty())
+    {
+      _execution->finishPipeline();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    std::vector<const void *> input_buffers{inputs->begin(), inputs->end()};
+    std::vector<size_t> input_lengths{lengths->begin(), lengths->end()};
+    _execution->pushPipelineInput(input_buffers, input_lengths);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *outputs)
+{
+  if (outputs == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun() || !_execution->hasPipelineOutput())
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+              << "pop_pipeline_output should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    // Leave outputs empty when input stream is finished and all outputs are popped
+    _execution->popPipelineOutput(*outputs);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::train_get_traininfo(nnfw_train_info *info)
 {
   if (isStateInitialized())
@@ -2009,7 +2128,7 @@ NNFW_STATUS nnfw_session::reset_prepare_config()
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::set_execute_config(const NNFW_RUN_CONFIG key, const char *)
+NNFW_STATUS nnfw_session::set_execute_config(const NNFW_RUN_CONFIG key, const char *value)
 {
   if (!isStatePreparedOrFinishedRun())
   {
@@ -2032,6 +2151,14 @@ NNFW_STATUS nnfw_session::set_execute_config(const NNFW_RUN_CONFIG key, const ch
     case NNFW_RUN_CONFIG_PROFILE:
       _execution->executionOptions().profile = true;
       break;
+    case NNFW_RUN_CONFIG_STATS:
+    {
+      int interval = value ? std::atoi(value) : 1;
+      if (interval <= 0)
+        return NNFW_STATUS_ERROR;
+      _execution->executionOptions().stats_sampling = interval;
+      break;
+    }
     default:
       return NNFW_STATUS_ERROR;
   }
@@ -2050,6 +2177,103 @@ NNFW_STATUS nnfw_session::reset_execute_config()
   _execution->executionOptions().dump_minmax = false;
   _execution->executionOptions().trace = false;
   _execution->executionOptions().profile = false;
+  // Stats are sampled by default, so go back to the configured interval instead of disabling them
+  _execution->executionOptions().stats_sampling =
+    std::max(onert::util::getConfigInt(onert::util::config::STATS_SAMPLING), 0);
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+namespace
+{
+
+void fillLatencyStats(const onert::exec::LatencyHistogram &hist, nnfw_latency_stats *stats)
+{
+  stats->count = hist.count();
+  stats->p50 = hist.percentile(0.5);
+  stats->p99 = hist.percentile(0.99);
+  stats->total = hist.total();
+}
+
+} // namespace
+
+NNFW_STATUS nnfw_session::latencyStats(const char *caller,
+                                       const onert::exec::LatencyStats **stats)
+{
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::" << caller << " : Invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  *stats = _execution->latencyStats();
+  if (*stats == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::" << caller << " : Not supported executor"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_run_stats(nnfw_latency_stats *stats)
+{
+  if (stats == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_run_stats : stats is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  const onert::exec::LatencyStats *latency_stats = nullptr;
+  const auto status = latencyStats("get_run_stats", &latency_stats);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  fillLatencyStats(latency_stats->run(), stats);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_operation_stats(uint32_t index, nnfw_latency_stats *stats)
+{
+  if (stats == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_operation_stats : stats is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  const onert::exec::LatencyStats *latency_stats = nullptr;
+  const auto status = latencyStats("get_operation_stats", &latency_stats);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  auto hist = latency_stats->operation(onert::ir::OperationIndex{index});
+  if (hist == nullptr)
+    return NNFW_STATUS_ERROR;
+
+  fillLatencyStats(*hist, stats);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_backend_stats(const char *backend, nnfw_latency_stats *stats)
+{
+  if (backend == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_backend_stats : backend is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+  if (stats == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_backend_stats : stats is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  const onert::exec::LatencyStats *latency_stats = nullptr;
+  const auto status = latencyStats("get_backend_stats", &latency_stats);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
 
+  onert::exec::LatencyHistogram hist;
+  latency_stats->backend(backend, hist);
+  fillLatencyStats(hist, stats);
   return NNFW_STATUS_NO_ERROR;
 }
@@ -24,7 +24,6 @@
 
 #include <string>
 #include <memory>
-#include <thread>
 #include <vector>
 
 namespace onert
@@ -37,6 +36,7 @@ namespace exec
 {
 class Execution;
 struct ExecutionOptions;
+class LatencyStats;
 } // namespace exec
 namespace ir
 {
@@ -170,6 +170,10 @@ public:
    */
   NNFW_STATUS set_backends_per_operation(const char *backend_settings);
 
+  NNFW_STATUS prepare_pipeline(const char *map_file_path);
+  NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
+  NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
+
   NNFW_STATUS train_get_traininfo(nnfw_train_info *info);
   NNFW_STATUS train_set_traininfo(const nnfw_train_info *info);
   NNFW_STATUS train_prepare();
@@ -199,10 +203,15 @@ public:
   NNFW_STATUS set_execute_config(const NNFW_RUN_CONFIG key, const char *value);
   NNFW_STATUS reset_execute_config();
 
+  NNFW_STATUS get_run_stats(nnfw_latency_stats *stats);
+  NNFW_STATUS get_operation_stats(uint32_t index, nnfw_latency_stats *stats);
+  NNFW_STATUS get_backend_stats(const char *backend, nnfw_latency_stats *stats);
+
 private:
   const onert::ir::IGraph *primary_subgraph();
   uint32_t getInputSize();
   uint32_t getOutputSize();
+  NNFW_STATUS latencyStats(const char *caller, const onert::exec::LatencyStats **stats);
   NNFW_STATUS loadModelFile(const std::string &model_file_path, const std::string &model_type);
 
   bool isStateInitialized();
@@ -222,7 +231,6 @@ private:
   std::shared_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
   std::unique_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
-  std::vector<std::thread> _threads;
   std::unique_ptr<onert::ir::train::TrainingInfo> _train_info;
   std::unique_ptr<onert::odc::QuantizeManager> _quant_manager;
   std::unique_ptr<onert::odc::CodegenManager> _codegen_manager;
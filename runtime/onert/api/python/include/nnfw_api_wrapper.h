@@ -19,8 +19,19 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
+#include <vector>
+
 namespace py = pybind11;
 
+/**
+ * @brief   numpy array whose buffer is C-contiguous
+ *
+ * Arrays of the same type and C-contiguous are bound as they are. Others are converted into a
+ * new array when conversion is allowed.
+ */
+template <typename T>
+using contiguous_array = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
 /**
  *  @brief  tensor info describes the type and shape of tensors
  *
@@ -113,6 +124,9 @@ class NNFW_SESSION
 {
 private:
   nnfw_session *session;
+  // numpy arrays set as inputs and outputs, kept alive while the session uses their buffers
+  std::vector<py::object> inputs;
+  std::vector<py::object> outputs;
 
 public:
   NNFW_SESSION(const char *package_file_path, const char *backends);
@@ -127,29 +141,27 @@ public:
    * @brief   process input array according to data type of numpy array sent by Python
    *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
    */
-  template <typename T> void set_input(uint32_t index, py::array_t<T> &buffer)
+  template <typename T> void set_input(uint32_t index, contiguous_array<T> &buffer)
   {
     nnfw_tensorinfo tensor_info;
     nnfw_input_tensorinfo(this->session, index, &tensor_info);
     NNFW_TYPE type = tensor_info.dtype;
-    uint32_t input_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * input_elements;
 
-    ensure_status(nnfw_set_input(session, index, type, buffer.request().ptr, length));
+    ensure_status(nnfw_set_input(session, index, type, buffer.data(), buffer.nbytes()));
+    keep(inputs, index, buffer);
   }
   /**
    * @brief   process output array according to data type of numpy array sent by Python
    *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
    */
-  template <typename T> void set_output(uint32_t index, py::array_t<T> &buffer)
+  template <typename T> void set_output(uint32_t index, contiguous_array<T> &buffer)
   {
     nnfw_tensorinfo tensor_info;
     nnfw_output_tensorinfo(this->session, index, &tensor_info);
     NNFW_TYPE type = tensor_info.dtype;
-    uint32_t output_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * output_elements;
 
-    ensure_status(nnfw_set_output(session, index, type, buffer.request().ptr, length));
+    ensure_status(nnfw_set_output(session, index, type, buffer.mutable_data(), buffer.nbytes()));
+    keep(outputs, index, buffer);
   }
   uint32_t input_size();
   uint32_t output_size();
@@ -159,4 +171,7 @@ public:
   void set_output_layout(uint32_t index, const char *layout);
   tensorinfo input_tensorinfo(uint32_t index);
   tensorinfo output_tensorinfo(uint32_t index);
+
+private:
+  void keep(std::vector<py::object> &buffers, uint32_t index, const py::array &buffer);
 };
@@ -1,6 +1,7 @@
 import numpy as np
 import os
 import shutil
+from concurrent.futures import ThreadPoolExecutor
 
 from .native import libnnfw_api_pybind
 
@@ -22,12 +23,18 @@ class session(libnnfw_api_pybind.nnfw_session):
         self.set_outputs(self.output_size())
 
     def set_inputs(self, size, inputs_array=[]):
-        """Set inputs for each index"""
+        """Set inputs for each index
+
+        An array which is already C-contiguous and has the input type is used without copy,
+        so it should not be modified until the inference is done.
+        """
+        self.inputs = []
         for i in range(size):
             input_tensorinfo = self.input_tensorinfo(i)
 
             if len(inputs_array) > i:
-                input_array = np.array(inputs_array[i], dtype=input_tensorinfo.dtype)
+                input_array = np.ascontiguousarray(inputs_array[i],
+                                                   dtype=input_tensorinfo.dtype)
             else:
                 print(
                     f"model's input size is {size} but given inputs_array size is {len(inputs_array)}.\n{i}-th index input is replaced by an array filled with 0."
@@ -40,6 +47,7 @@ class session(libnnfw_api_pybind.nnfw_session):
 
     def set_outputs(self, size):
         """Set outputs for each index"""
+        self.outputs = []
         for i in range(size):
             output_tensorinfo = self.output_tensorinfo(i)
             output_array = np.zeros((num_elems(output_tensorinfo)),
@@ -54,5 +62,62 @@ class session(libnnfw_api_pybind.nnfw_session):
         return self.outputs
 
 
+class session_pool:
+    """Sessions of the same nnpackage running slices of a batch on threads
+
+    Each session runs the model with its own batch size, which is the first dimension of the
+    inputs. A batch given to inference() is sliced by the batch size and the slices are
+    distributed to the sessions. The sessions run in parallel since they release the GIL
+    while running.
+    """
+    def __init__(self, nnpackage_path, num_sessions=os.cpu_count(), backends="cpu"):
+        self.sessions = [session(nnpackage_path, backends) for _ in range(num_sessions)]
+        self.executor = ThreadPoolExecutor(max_workers=num_sessions)
+        self.batch_size = self.sessions[0].input_tensorinfo(0).dims[0]
+
+    def __del__(self):
+        self.executor.shutdown()
+
+    def _run(self, sess, slices):
+        outputs = []
+        for inputs_array in slices:
+            sess.set_inputs(sess.input_size(), inputs_array)
+            sess.run()
+            outputs.append([
+                output.reshape(sess.output_tensorinfo(i).dims).copy()
+                for i, output in enumerate(sess.outputs)
+            ])
+        return outputs
+
+    def inference(self, inputs_array):
+        """Inference a batch whose size is a multiple of the model's batch size
+
+        Returns outputs concatenated in the order of the batch.
+        """
+        batch = len(inputs_array[0])
+        if batch % self.batch_size != 0:
+            raise ValueError(
+                f"batch size {batch} is not a multiple of model's batch size {self.batch_size}"
+            )
+
+        num_sessions = len(self.sessions)
+        slices = [[x[b:b + self.batch_size] for x in inputs_array]
+                  for b in range(0, batch, self.batch_size)]
+        futures = [
+            self.executor.submit(self._run, sess, slices[i::num_sessions])
+            for i, sess in enumerate(self.sessions)
+        ]
+        results = [future.result() for future in futures]
+
+        # Slice k was run by session (k % num_sessions) as its (k // num_sessions)-th
+        ordered = [
+            results[k % num_sessions][k // num_sessions] for k in range(len(slices))
+        ]
+        return [
+            np.concatenate([outputs[i] for outputs in ordered])
+            for i in range(len(ordered[0]))
+        ]
+
+
 def tensorinfo():
     return libnnfw_api_pybind.nnfw_tensorinfo()
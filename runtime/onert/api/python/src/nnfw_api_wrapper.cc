@@ -157,6 +157,9 @@ void set_dims(tensorinfo &tensor_info, const py::list &array)
 
 NNFW_SESSION::NNFW_SESSION(const char *package_file_path, const char *backends)
 {
+  // Loading and preparing do not touch Python objects
+  py::gil_scoped_release release;
+
   this->session = nullptr;
   ensure_status(nnfw_create_session(&(this->session)));
   ensure_status(nnfw_load_model_from_file(this->session, package_file_path));
@@ -175,6 +178,8 @@ void NNFW_SESSION::close_session()
 {
   ensure_status(nnfw_close_session(this->session));
   this->session = nullptr;
+  inputs.clear();
+  outputs.clear();
 }
 void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor_info)
 {
@@ -227,6 +232,12 @@ tensorinfo NNFW_SESSION::input_tensorinfo(uint32_t index)
   }
   return ti;
 }
+void NNFW_SESSION::keep(std::vector<py::object> &buffers, uint32_t index, const py::array &buffer)
+{
+  if (buffers.size() <= index)
+    buffers.resize(index + 1);
+  buffers[index] = buffer;
+}
 tensorinfo NNFW_SESSION::output_tensorinfo(uint32_t index)
 {
   nnfw_tensorinfo tensor_info = nnfw_tensorinfo();
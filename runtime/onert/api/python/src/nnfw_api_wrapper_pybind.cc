@@ -48,149 +48,159 @@ PYBIND11_MODULE(libnnfw_api_pybind, m)
          "Parameters:\n"
          "\tindex (int): Index of input to be set (0-indexed)\n"
          "\ttensor_info (tensorinfo): Tensor info to be set")
-    .def("run", &NNFW_SESSION::run, "Run inference")
-    .def("run_async", &NNFW_SESSION::run_async, "Run inference asynchronously")
-    .def("wait", &NNFW_SESSION::wait, "Wait for asynchronous run to finish")
+    .def("run", &NNFW_SESSION::run, py::call_guard<py::gil_scoped_release>(),
+         "Run inference")
+    .def("run_async", &NNFW_SESSION::run_async, py::call_guard<py::gil_scoped_release>(),
+         "Run inference asynchronously")
+    .def("wait", &NNFW_SESSION::wait, py::call_guard<py::gil_scoped_release>(),
+         "Wait for asynchronous run to finish")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<float> &buffer) {
         session.set_input<float>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int> &buffer) {
         session.set_input<int>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<uint8_t> &buffer) {
         session.set_input<uint8_t>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<bool> &buffer) {
         session.set_input<bool>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int64_t> &buffer) {
         session.set_input<int64_t>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int8_t> &buffer) {
         session.set_input<int8_t>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int16_t> &buffer) {
         session.set_input<int16_t>(index, buffer);
       },
       py::arg("index"), py::arg("buffer"),
       "Set input buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+      "\tbuffer (numpy): Raw buffer for input. It is bound without copy if it is C-contiguous "
+      "and has the input type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<float> &buffer) {
         session.set_output<float>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int> &buffer) {
         session.set_output<int>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<uint8_t> &buffer) {
         session.set_output<uint8_t>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<bool> &buffer) {
         session.set_output<bool>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int64_t> &buffer) {
         session.set_output<int64_t>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int8_t> &buffer) {
         session.set_output<int8_t>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def(
       "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
+      [](NNFW_SESSION &session, uint32_t index, contiguous_array<int16_t> &buffer) {
         session.set_output<int16_t>(index, buffer);
       },
-      py::arg("index"), py::arg("buffer"),
+      py::arg("index"), py::arg("buffer").noconvert(),
       "Set output buffer\n"
       "Parameters:\n"
       "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+      "\tbuffer (numpy): Raw buffer for output. It must be C-contiguous and have the output type")
     .def("input_size", &NNFW_SESSION::input_size,
          "Get the number of inputs defined in loaded model\n"
          "Returns:\n"
@@ -48,8 +48,9 @@ public:
     auto tb = std::make_shared<TensorBuilder>(tr);
     context->tensor_registry = tr;
     context->tensor_builder = tb;
-    context->kernel_gen = std::make_shared<KernelGenerator>(graph, tb, tr, custom_kernel_builder,
-                                                            context->external_context());
+    context->kernel_gen =
+      std::make_shared<KernelGenerator>(graph, tb, tr, custom_kernel_builder,
+                                        context->external_context(), context->scratch_manager());
     return context;
   }
 
@@ -19,6 +19,7 @@
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
 #include "util/logging.h"
+#include "util/ConfigSource.h"
 #include "ir/Index.h"
 #include "ir/OperandIndexMap.h"
 #include "ir/OperandIndexSequence.h"
@@ -56,6 +57,11 @@ FunctionMap BackendContext::genKernels()
     fn_seq->iterate([&](exec::IFunction &ifunc) { ifunc.prepare(); });
   }
 
+  // Kernels have requested their scratch buffers while they are prepared
+  // TODO Get compiler options from compiler, and use it rather than getting it from Env
+  const bool is_linear = util::getConfigString(util::config::EXECUTOR) == "Linear";
+  _scratch_manager->allocate(_data.op_order, is_linear);
+
   return ret;
 }
 
@@ -21,6 +21,7 @@
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
 #include "ExternalContext.h"
+#include "ScratchManager.h"
 
 namespace onert
 {
@@ -37,7 +38,9 @@ public:
                  std::shared_ptr<TensorBuilder> tensor_builder = nullptr,
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
-      tensor_builder{tensor_builder}, kernel_gen{kernel_gen}, _external_context(new ExternalContext)
+      tensor_builder{tensor_builder}, kernel_gen{kernel_gen},
+      _external_context(new ExternalContext(this->data().num_workers)),
+      _scratch_manager(new ScratchManager)
   {
   }
 
@@ -45,6 +48,7 @@ public:
   FunctionMap genKernels() override;
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
+  std::shared_ptr<ScratchManager> scratch_manager() { return _scratch_manager; }
 
 public:
   // TODO Make it private
@@ -56,6 +60,7 @@ private:
   //      the thread pool is also created in duplicate
   // TODO Create one ruy context for session
   std::shared_ptr<ExternalContext> _external_context;
+  std::shared_ptr<ScratchManager> _scratch_manager;
 };
 
 } // namespace cpu
@@ -49,6 +49,8 @@
 #include "ops/ReshapeLayer.h"
 #include "ops/ResizeBilinearLayer.h"
 #include "ops/ReverseLayer.h"
+#include "ops/RmsNormLayer.h"
+#include "ops/RoPELayer.h"
 #include "ops/SelectLayer.h"
 #include "ops/ShapeLayer.h"
 #include "ops/SliceLayer.h"
@@ -224,16 +226,30 @@ ops::ReduceType convertReduceType(ir::operation::Reduce::ReduceType reduce_type_
       throw std::runtime_error("cpu KernelGenerator : Not supported operation yet");
   }
 }
+
+nnfw::cker::RoPEMode convertRoPEMode(ir::operation::RoPE::RoPEMode rope_mode_ir)
+{
+  switch (rope_mode_ir)
+  {
+    case ir::operation::RoPE::RoPEMode::GPT_NEOX:
+      return nnfw::cker::RoPEMode::kGptNeox;
+    case ir::operation::RoPE::RoPEMode::GPT_J:
+      return nnfw::cker::RoPEMode::kGptJ;
+    default:
+      throw std::runtime_error("cpu KernelGenerator : Not supported RoPE mode yet");
+  }
+}
 } // namespace
 
 KernelGenerator::KernelGenerator(
   const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
   const std::shared_ptr<basic::TensorRegistry> &tensor_reg,
   const std::shared_ptr<backend::custom::IKernelBuilder> &kernel_builder,
-  const std::shared_ptr<ExternalContext> &external_context)
+  const std::shared_ptr<ExternalContext> &external_context,
+  const std::shared_ptr<ScratchManager> &scratch_manager)
   : basic::KernelGeneratorBase{graph}, _ctx(graph.operands()), _operations_ctx{graph.operations()},
     _tensor_builder(tensor_builder), _tensor_reg{tensor_reg}, _kernel_builder(kernel_builder),
-    _external_context(external_context)
+    _external_context(external_context), _scratch_manager(scratch_manager)
 {
   // DO NOTHING
 }
@@ -254,6 +270,7 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
   ret->dynamic_tensor_ctx(dyn_ctx);
 
   auto &op = _graph.operations().at(ind);
+  _current_op_ind = ind;
   op.accept(*this);
   assert(_return_fn); // _return_fn must have been generated
   ret->append(std::move(_return_fn));
@@ -314,7 +331,8 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor, is_cacheable_weights);
+                  activation, ofm_tensor, is_cacheable_weights,
+                  _scratch_manager->create(_current_op_ind));
 
     _return_fn = std::move(fn);
     return;
@@ -333,7 +351,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _scratch_manager->create(_current_op_ind));
 
   _return_fn = std::move(fn);
 }
@@ -1068,6 +1086,45 @@ void KernelGenerator::visit(const ir::operation::L2Normalization &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::RmsNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::RmsNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::RmsNorm::Input::BETA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+
+  auto fn = std::make_unique<ops::RmsNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, node.param().epsilon, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RoPE &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::RoPE::Input::INPUT)};
+  const auto sin_index{node.getInputs().at(ir::operation::RoPE::Input::SIN_TABLE)};
+  const auto cos_index{node.getInputs().at(ir::operation::RoPE::Input::COS_TABLE)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto sin_tensor = _tensor_reg->getPortableTensor(sin_index);
+  auto cos_tensor = _tensor_reg->getPortableTensor(cos_index);
+
+  auto fn = std::make_unique<ops::RoPELayer>();
+
+  fn->configure(input_tensor, sin_tensor, cos_tensor, convertRoPEMode(node.param().mode),
+                output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Range &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1211,7 +1268,7 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_KERNEL_GENERATOR_H__
 
 #include "ExternalContext.h"
+#include "ScratchManager.h"
 #include "TensorBuilder.h"
 #include "backend/basic/TensorRegistry.h"
 #include "Tensor.h"
@@ -40,7 +41,8 @@ public:
   KernelGenerator(const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
                   const std::shared_ptr<basic::TensorRegistry> &tensor_reg,
                   const std::shared_ptr<custom::IKernelBuilder> &kernel_builder,
-                  const std::shared_ptr<ExternalContext> &external_context);
+                  const std::shared_ptr<ExternalContext> &external_context,
+                  const std::shared_ptr<ScratchManager> &scratch_manager);
 
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex op_ind) override;
 
@@ -81,6 +83,8 @@ public:
   void visit(const ir::operation::Reshape &) override;
   void visit(const ir::operation::ResizeBilinear &node) override;
   void visit(const ir::operation::Reverse &) override;
+  void visit(const ir::operation::RmsNorm &) override;
+  void visit(const ir::operation::RoPE &) override;
   void visit(const ir::operation::Select &) override;
   void visit(const ir::operation::Shape &) override;
   void visit(const ir::operation::Slice &) override;
@@ -104,6 +108,9 @@ private:
   std::shared_ptr<basic::TensorRegistry> _tensor_reg;
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
   const std::shared_ptr<ExternalContext> _external_context;
+  const std::shared_ptr<ScratchManager> _scratch_manager;
+  // Operation being generated, which owns scratch buffers created by its kernels
+  ir::OperationIndex _current_op_ind;
 };
 
 } // namespace cpu
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ScratchManager.h"
+
+#include <util/logging.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+std::shared_ptr<ScratchBuffer> ScratchManager::create(const ir::OperationIndex &op_ind)
+{
+  auto buffer = std::make_shared<ScratchBuffer>();
+  _buffers[op_ind].emplace_back(buffer);
+  return buffer;
+}
+
+void ScratchManager::allocate(const std::vector<ir::OperationIndex> &op_order, bool overlap)
+{
+  // Keep every buffer aligned, so that kernels can store any type in it
+  constexpr size_t kAlignment = 16;
+
+  // Plan buffers as operands which are defined and killed by one operation
+  std::vector<std::pair<ir::OperandIndex, ScratchBuffer *>> plans;
+  for (const auto &op_ind : op_order)
+  {
+    auto it = _buffers.find(op_ind);
+    if (it == _buffers.end())
+      continue;
+
+    const auto first = plans.size();
+    for (const auto &buffer : it->second)
+    {
+      if (buffer->size() == 0)
+        continue;
+      const auto size = (buffer->size() + kAlignment - 1) / kAlignment * kAlignment;
+      const ir::OperandIndex ind{static_cast<uint32_t>(plans.size())};
+      _mem_mgr.claimPlan(ind, size);
+      plans.emplace_back(ind, buffer.get());
+    }
+    if (overlap)
+    {
+      for (auto i = first; i < plans.size(); ++i)
+        _mem_mgr.releasePlan(plans[i].first);
+    }
+  }
+
+  if (plans.empty())
+    return;
+
+  _mem_mgr.allocate();
+  for (const auto &[ind, buffer] : plans)
+    buffer->_data = _mem_mgr.getBuffer(ind);
+  VERBOSE(ScratchManager) << "Allocate " << plans.size() << " scratch buffers" << std::endl;
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
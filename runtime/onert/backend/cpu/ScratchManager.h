@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_SCRATCH_MANAGER_H__
+#define __ONERT_BACKEND_CPU_SCRATCH_MANAGER_H__
+
+#include <backend/basic/MemoryManager.h>
+#include <ir/Index.h>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+/**
+ * @brief Temporary buffer of a kernel (e.g. im2col), which is used only while the kernel runs
+ */
+class ScratchBuffer
+{
+public:
+  /**
+   * @brief Request at least size bytes. It takes effect only before ScratchManager::allocate().
+   */
+  void request(size_t size) { _size = std::max(_size, size); }
+
+  size_t size() const { return _size; }
+
+  /**
+   * @brief Buffer of size() bytes, or nullptr before allocation or if nothing was requested
+   */
+  uint8_t *data() const { return _data; }
+
+private:
+  friend class ScratchManager;
+
+  size_t _size = 0;
+  uint8_t *_data = nullptr;
+};
+
+/**
+ * @brief Manage scratch buffers of kernels in one arena
+ *
+ * Kernels request buffers while they are configured and prepared, instead of allocating them on
+ * every run. Buffers of an operation live only while the operation runs, so the memory planner
+ * overlaps buffers of different operations.
+ */
+class ScratchManager
+{
+public:
+  ScratchManager() = default;
+
+public:
+  /**
+   * @brief Create a buffer used by the operation
+   */
+  std::shared_ptr<ScratchBuffer> create(const ir::OperationIndex &op_ind);
+
+  /**
+   * @brief Plan buffers in the execution order and allocate them
+   *
+   * @param op_order Execution order of operations
+   * @param overlap  Whether buffers of different operations may share memory. It should be false
+   *                 if operations can run at the same time.
+   */
+  void allocate(const std::vector<ir::OperationIndex> &op_order, bool overlap);
+
+private:
+  std::unordered_map<ir::OperationIndex, std::vector<std::shared_ptr<ScratchBuffer>>> _buffers;
+  basic::MemoryManager _mem_mgr;
+};
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_SCRATCH_MANAGER_H__
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ScratchManager.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using namespace onert::backend::cpu;
+using onert::ir::OperationIndex;
+
+namespace
+{
+
+bool isOverlapped(const ScratchBuffer &lhs, const ScratchBuffer &rhs)
+{
+  return lhs.data() < rhs.data() + rhs.size() && rhs.data() < lhs.data() + lhs.size();
+}
+
+} // namespace
+
+TEST(ScratchManager, request)
+{
+  ScratchManager manager;
+  auto buffer = manager.create(OperationIndex{0});
+  buffer->request(10);
+  buffer->request(5);
+  ASSERT_EQ(buffer->size(), 10);
+  ASSERT_EQ(buffer->data(), nullptr);
+
+  manager.allocate({OperationIndex{0}}, true);
+  ASSERT_EQ(buffer->size(), 10);
+  ASSERT_NE(buffer->data(), nullptr);
+}
+
+TEST(ScratchManager, reuse_across_operations)
+{
+  ScratchManager manager;
+  auto buffer0 = manager.create(OperationIndex{0});
+  auto buffer1 = manager.create(OperationIndex{0});
+  auto buffer2 = manager.create(OperationIndex{1});
+  buffer0->request(100);
+  buffer1->request(64);
+  buffer2->request(128);
+
+  manager.allocate({OperationIndex{0}, OperationIndex{1}}, true);
+
+  // Buffers of one operation are used together
+  ASSERT_FALSE(isOverlapped(*buffer0, *buffer1));
+  // Buffers of different operations share memory
+  ASSERT_TRUE(isOverlapped(*buffer0, *buffer2) || isOverlapped(*buffer1, *buffer2));
+}
+
+TEST(ScratchManager, no_overlap)
+{
+  ScratchManager manager;
+  std::vector<std::shared_ptr<ScratchBuffer>> buffers;
+  std::vector<OperationIndex> op_order;
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    op_order.emplace_back(i);
+    buffers.emplace_back(manager.create(OperationIndex{i}));
+    buffers.back()->request(32 * (i + 1));
+  }
+
+  // Operations may run at the same time
+  manager.allocate(op_order, false);
+
+  for (size_t i = 0; i < buffers.size(); ++i)
+    for (size_t j = i + 1; j < buffers.size(); ++j)
+      ASSERT_FALSE(isOverlapped(*buffers[i], *buffers[j]));
+}
+
+TEST(ScratchManager, alignment)
+{
+  ScratchManager manager;
+  std::vector<std::shared_ptr<ScratchBuffer>> buffers;
+  for (size_t size : {3, 5, 7, 17})
+  {
+    buffers.emplace_back(manager.create(OperationIndex{0}));
+    buffers.back()->request(size);
+  }
+
+  manager.allocate({OperationIndex{0}}, true);
+
+  for (const auto &buffer : buffers)
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(buffer->data()) % 16, 0);
+  for (size_t i = 0; i < buffers.size(); ++i)
+    for (size_t j = i + 1; j < buffers.size(); ++j)
+      ASSERT_FALSE(isOverlapped(*buffers[i], *buffers[j]));
+}
+
+TEST(ScratchManager, neg_not_requested)
+{
+  ScratchManager manager;
+  auto empty = manager.create(OperationIndex{0});
+  auto not_run = manager.create(OperationIndex{1});
+  not_run->request(16);
+
+  // Nothing to allocate for operations in the order
+  manager.allocate({OperationIndex{0}}, true);
+
+  ASSERT_EQ(empty->data(), nullptr);
+  ASSERT_EQ(not_run->data(), nullptr);
+}
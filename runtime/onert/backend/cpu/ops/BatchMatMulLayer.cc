@@ -16,6 +16,9 @@
 
 #include "BatchMatMulLayer.h"
 
+#include "GGMLHelper.h"
+
+#include <cker/fp16/operation/BatchMatMul.h>
 #include <cker/operation/BatchMatMul.h>
 
 namespace onert
@@ -29,7 +32,7 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-    _kernel(new nnfw::cker::BatchMatMul())
+    _kernel(new nnfw::cker::BatchMatMul()), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -39,19 +42,63 @@ BatchMatMulLayer::~BatchMatMulLayer() = default;
 void BatchMatMulLayer::batchMatMulFloat32()
 {
   nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
-  nnfw::cker::Shape lhs_shape = getShape(_lhs);
-  nnfw::cker::Shape rhs_shape = getShape(_rhs);
-  nnfw::cker::Shape output_shape = getShape(_output);
+  batchmatmul_kernel(getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs),
+                     getBuffer<float>(_rhs), _adj_x, _adj_y, getShape(_output),
+                     getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::batchMatMulFloat16()
+{
+  nnfw::cker::fp16::BatchMatMul(getShape(_lhs), getBuffer<Half>(_lhs), getShape(_rhs),
+                                getBuffer<Half>(_rhs), _adj_x, _adj_y, getShape(_output),
+                                getBuffer<Half>(_output));
+}
+
+template <typename T> void BatchMatMulLayer::batchMatMulQuant8()
+{
+  const double real_multiplier =
+    static_cast<double>(_lhs->data_scale()) * _rhs->data_scale() / _output->data_scale();
+
+  nnfw::cker::BatchMatMulParams op_params;
+  op_params.lhs_offset = -_lhs->data_zero_point();
+  op_params.rhs_offset = -_rhs->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  QuantizeMultiplier(real_multiplier, &op_params.output_multiplier, &op_params.output_shift);
+  CalculateActivationRangeQuantized(ir::Activation::NONE, _output,
+                                    &op_params.quantized_activation_min,
+                                    &op_params.quantized_activation_max);
+
+  nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
+  batchmatmul_kernel(op_params, getShape(_lhs), getBuffer<T>(_lhs), getShape(_rhs),
+                     getBuffer<T>(_rhs), _adj_x, _adj_y, getShape(_output), getBuffer<T>(_output),
+                     _external_context->ruy_context());
+}
 
-  // TODO implement for constant input
+void BatchMatMulLayer::batchMatMulGGMLWeight()
+{
+  // rhs [..., N, K] (adj_y) is kept block-quantized along K. ggml broadcasts rhs over lhs batch
+  // and splits output columns (N) across threads.
+  auto lhs = getGGMLTensor(_lhs);
+  auto rhs = getGGMLTensor(_rhs);
+  auto output = getGGMLTensor(_output);
+  for (int i = 2; i < GGML_MAX_DIMS; ++i)
+  {
+    if (lhs.ne[i] % rhs.ne[i] != 0)
+      throw std::runtime_error{"BatchMatMul: GGML rhs batch must be broadcastable to lhs batch"};
+  }
+  {
+    output.op = GGML_OP_MUL_MAT;
+    output.src[0] = &rhs;
+    output.src[1] = &lhs;
+  }
 
-  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
-  batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, getBuffer<float>(_rhs), _adj_x,
-                     _adj_y, output_shape, getBuffer<float>(_output));
+  computeGGMLNode(&output, _external_context->ruy_context()->max_num_threads(),
+                  _ggml_work_buffer);
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -62,6 +109,30 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _external_context = external_context;
+
+  if (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+      _rhs->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    // ggml blocks run along the last dimension, so it should be the reduction axis
+    if (_adj_x || !_adj_y)
+      throw std::runtime_error{"BatchMatMul: GGML rhs requires adj_x false and adj_y true"};
+    if (_lhs->data_type() != OperandType::FLOAT32 || _output->data_type() != OperandType::FLOAT32)
+      throw std::runtime_error{"BatchMatMul: GGML rhs requires float lhs and output"};
+    _external_context->initGgmlContext();
+  }
+}
+
+void BatchMatMulLayer::prepare()
+{
+  // Let ruy cache packed constant rhs instead of packing it on every run
+  if (!_rhs->is_constant() || _rhs->is_dynamic())
+    return;
+
+  if (_rhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
+    _kernel->prepareConstantRhs(getBuffer<uint8_t>(_rhs));
+  else if (_rhs->data_type() == OperandType::QUANT_INT8_ASYMM)
+    _kernel->prepareConstantRhs(getBuffer<int8_t>(_rhs));
 }
 
 void BatchMatMulLayer::run()
@@ -70,6 +141,27 @@ void BatchMatMulLayer::run()
   {
     batchMatMulFloat32();
   }
+  else if ((_lhs->data_type() == OperandType::FLOAT16) &&
+           (_rhs->data_type() == OperandType::FLOAT16))
+  {
+    batchMatMulFloat16();
+  }
+  else if ((_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
+           (_rhs->data_type() == OperandType::QUANT_UINT8_ASYMM))
+  {
+    batchMatMulQuant8<uint8_t>();
+  }
+  else if ((_lhs->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+           (_rhs->data_type() == OperandType::QUANT_INT8_ASYMM))
+  {
+    batchMatMulQuant8<int8_t>();
+  }
+  else if ((_lhs->data_type() == OperandType::FLOAT32) &&
+           (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+            _rhs->data_type() == OperandType::QUANT_GGML_Q8_0))
+  {
+    batchMatMulGGMLWeight();
+  }
   else
   {
     throw std::runtime_error{"BatchMatMul: unsupported data type"};
@@ -19,9 +19,12 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -48,8 +51,16 @@ public:
 public:
   void batchMatMulFloat32();
 
+  void batchMatMulFloat16();
+
+  template <typename T> void batchMatMulQuant8();
+
+  void batchMatMulGGMLWeight();
+
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
+
+  void prepare() override;
 
   void run() override;
 
@@ -62,6 +73,10 @@ private:
   bool _adj_y;
 
   std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+
+  std::shared_ptr<ExternalContext> _external_context;
+  // Work buffer for ggml kernel (lhs quantized to ggml dot product type)
+  std::vector<uint8_t> _ggml_work_buffer;
 };
 
 } // namespace ops
@@ -16,6 +16,7 @@
 
 #include "BinaryArithmeticLayer.h"
 
+#include <cker/fp16/operation/BinaryArithmetic.h>
 #include <cker/operation/BinaryArithmeticOps.h>
 
 namespace onert
@@ -30,6 +31,42 @@ namespace ops
 namespace
 {
 
+template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T>
+void binaryArithmetic(bool need_broadcast, nnfw::cker::BinaryArithmeticOpParam &params,
+                      const nnfw::cker::Shape &lhs_shape, const T *lhs_data,
+                      const nnfw::cker::Shape &rhs_shape, const T *rhs_data,
+                      const nnfw::cker::Shape &output_shape, T *output_data)
+{
+  if (need_broadcast)
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
+      params, lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape, output_data);
+  }
+  else
+  {
+    nnfw::cker::BinaryArithmeticOp<arithmetic_type>(params, lhs_shape, lhs_data, rhs_shape,
+                                                    rhs_data, output_shape, output_data);
+  }
+}
+
+template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
+void binaryArithmetic(bool need_broadcast, nnfw::cker::BinaryArithmeticOpParam &params,
+                      const nnfw::cker::Shape &lhs_shape, const Half *lhs_data,
+                      const nnfw::cker::Shape &rhs_shape, const Half *rhs_data,
+                      const nnfw::cker::Shape &output_shape, Half *output_data)
+{
+  if (need_broadcast)
+  {
+    nnfw::cker::fp16::BroadcastBinaryArithmeticOp<arithmetic_type>(
+      params, lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape, output_data);
+  }
+  else
+  {
+    nnfw::cker::fp16::BinaryArithmeticOp<arithmetic_type>(
+      params, lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape, output_data);
+  }
+}
+
 template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct Eval
 {
   nnfw::cker::Shape _lhs_shape;
@@ -63,19 +100,9 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     else
       assert(_lhs_shape == getShape(lhs) && _rhs_shape == getShape(rhs) &&
              _output_shape == getShape(output));
-    auto lhs_buffer = getBuffer<T>(lhs);
-    auto rhs_buffer = getBuffer<T>(rhs);
-    auto output_buffer = getBuffer<T>(output);
-    if (_need_broadcast)
-    {
-      nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
-    }
-    else
-    {
-      nnfw::cker::BinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
-    }
+    binaryArithmetic<arithmetic_type>(_need_broadcast, _op_params, _lhs_shape, getBuffer<T>(lhs),
+                                      _rhs_shape, getBuffer<T>(rhs), _output_shape,
+                                      getBuffer<T>(output));
   }
 };
 
@@ -96,6 +123,15 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
       break;
     }
+    case OperandType::FLOAT16:
+    {
+      float output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
+      op_params.float_activation_max = output_activation_max;
+      op_params.float_activation_min = output_activation_min;
+      return Eval<arithmetic_type, Half>(lhs, rhs, output, op_params);
+      break;
+    }
     case OperandType::INT32:
     {
       int32_t output_activation_min = 0, output_activation_max = 0;
@@ -262,7 +298,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       }
       break;
     case ArithmeticType::kDiv:
-      if (_lhs->data_type() == OperandType::FLOAT32)
+      if (_lhs->data_type() == OperandType::FLOAT32 || _lhs->data_type() == OperandType::FLOAT16)
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
           _lhs, _rhs, _output, activation, op_params);
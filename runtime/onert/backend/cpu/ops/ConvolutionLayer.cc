@@ -18,8 +18,11 @@
 #include "OperationUtils.h"
 #include "cker/PortableTensorUtils.h"
 
+#include "../ScratchManager.h"
 #include "../Tensor.h"
 #include "ir/Padding.h"
+#include "ir/SharedDataStore.h"
+#include <cker/fp16/operation/Conv.h>
 #include <cker/operation/Conv.h>
 
 namespace onert
@@ -30,6 +33,31 @@ namespace cpu
 {
 namespace ops
 {
+namespace
+{
+
+class TransposedFilterData final : public ir::Data
+{
+public:
+  TransposedFilterData(const nnfw::cker::Shape &filter_shape, const float *filter_data)
+    : _data(filter_shape.FlatSize())
+  {
+    nnfw::cker::Conv::TransposeFilter(filter_shape, filter_data, _data.data());
+  }
+
+public:
+  size_t size(void) const override { return _data.size() * sizeof(float); }
+  const uint8_t *base(void) const override
+  {
+    return reinterpret_cast<const uint8_t *>(_data.data());
+  }
+
+private:
+  std::vector<float> _data;
+};
+
+} // namespace
+
 ConvolutionLayer::ConvolutionLayer()
   : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
     _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
@@ -65,6 +93,38 @@ void ConvolutionLayer::convFloat32()
          getBuffer<float>(_output));
 }
 
+void ConvolutionLayer::convFloat16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  const auto kernel_shape = getShape(_kernel);
+  if (_fp16_packed_kernel.empty() || !_is_cachable_weights)
+  {
+    const int num_units = kernel_shape.Dims(0);
+    const int depth = kernel_shape.FlatSize() / num_units;
+    _fp16_packed_kernel.resize(nnfw::cker::fp16::PackedWeightsSize(num_units, depth));
+    nnfw::cker::fp16::PackWeights(getBuffer<Half>(_kernel), num_units, depth,
+                                  _fp16_packed_kernel.data());
+  }
+
+  nnfw::cker::fp16::Conv(op_params, getShape(_input), getBuffer<Half>(_input), kernel_shape,
+                         _fp16_packed_kernel.data(), getShape(_bias),
+                         _bias ? getBuffer<Half>(_bias) : nullptr, getShape(_output),
+                         getBuffer<Half>(_output));
+}
+
 void ConvolutionLayer::convQ8uPerTensor()
 {
   int32_t output_activation_min = 0;
@@ -96,6 +156,8 @@ void ConvolutionLayer::convQ8uPerTensor()
   op_params.is_replaced_weights = true;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (_scratch)
+    kernel.setIm2colBuffer(_scratch->data(), _scratch->size());
   kernel(op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
          getBuffer<uint8_t>(_kernel), getShape(_bias), getBuffer<int32_t>(_bias), getShape(_output),
          getBuffer<uint8_t>(_output));
@@ -202,7 +264,8 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
                                  const ir::Activation activation, IPortableTensor *output,
-                                 bool is_cachable_weights)
+                                 bool is_cachable_weights,
+                                 const std::shared_ptr<ScratchBuffer> &scratch)
 {
   _input = input;
   _kernel = kernel;
@@ -219,6 +282,7 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _activation = activation;
   _output = output;
   _is_cachable_weights = is_cachable_weights;
+  _scratch = scratch;
   _is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
                _kernel->data_type() == OperandType::QUANT_INT8_SYMM;
 }
@@ -263,6 +327,10 @@ void ConvolutionLayer::run()
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     const bool per_channel_quantized = _kernel->data_scales().size() > 1;
@@ -311,8 +379,29 @@ void ConvolutionLayer::prepare()
   if (_input->data_type() == OperandType::FLOAT32 && _is_cachable_weights)
   {
     bool is_transposed = false;
-    kernel.prepareF32(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
-                      is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+    auto &store = ir::SharedDataStore::get();
+    ir::SharedDataStore::Key key;
+    if (kernel.usableMultiThreaded(getPaddingType(_paddingType), _dilationWidthFactor,
+                                   _dilationHeightFactor) &&
+        store.findKey(_kernel->buffer(), key))
+    {
+      // Weights are shared with other sessions, so share the transposed ones too
+      const auto kernel_shape = getShape(_kernel);
+      key.layout = "cpu.conv2d.hwcn";
+      key.dims.assign(kernel_shape.DimsData(),
+                      kernel_shape.DimsData() + kernel_shape.DimensionsCount());
+      key.data_type = _kernel->data_type();
+      _shared_kernel = store.getOrCreate(key, [&]() {
+        return std::make_unique<TransposedFilterData>(kernel_shape, getBuffer<float>(_kernel));
+      });
+      kernel.prepareF32Transposed(reinterpret_cast<const float *>(_shared_kernel->base()));
+      is_transposed = true;
+    }
+    else
+    {
+      kernel.prepareF32(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
+                        is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+    }
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -339,6 +428,8 @@ void ConvolutionLayer::prepare()
       kernel.prepareQ8uPerTensor(getShape(_input), getShape(_kernel), getShape(_output),
                                  _strideWidth, _strideHeight, _dilationWidthFactor,
                                  _dilationHeightFactor);
+      if (_scratch)
+        _scratch->request(kernel.im2colSize());
     }
   }
   else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
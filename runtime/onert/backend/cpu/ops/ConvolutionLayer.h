@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_CONVOLUTIONLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include <ir/Data.h>
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -40,6 +41,9 @@ namespace backend
 {
 namespace cpu
 {
+
+class ScratchBuffer;
+
 namespace ops
 {
 
@@ -56,12 +60,14 @@ public:
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t dilationWidthFactor,
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
-                 IPortableTensor *output, bool is_cachable_weights);
+                 IPortableTensor *output, bool is_cachable_weights,
+                 const std::shared_ptr<ScratchBuffer> &scratch = nullptr);
   void prepare() override;
   void run() override;
 
 private:
   void convFloat32();
+  void convFloat16();
   void convQ8uPerTensor();
   void convQ8uPerChannel();
   void convQ8i();
@@ -88,6 +94,12 @@ protected:
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
   std::unique_ptr<nnfw::cker::ConvHybridTempArena> _hybrid_arena;
+  // Transposed weights shared with other sessions running the same model
+  std::shared_ptr<ir::Data> _shared_kernel;
+  // im2col buffer planned by ScratchManager
+  std::shared_ptr<ScratchBuffer> _scratch;
+  // FLOAT16 filter packed in single precision for GEMM, packed once if it is constant
+  std::vector<float> _fp16_packed_kernel;
 
   bool _prepare;
   bool _is_cachable_weights;
@@ -40,6 +40,7 @@ public:
 
 public:
   void convFloat32();
+  void convFloat16();
 
   void convQ8uPerTensor();
   void convQ8uPerChannel();
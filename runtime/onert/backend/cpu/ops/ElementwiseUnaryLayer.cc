@@ -18,6 +18,7 @@
 
 #include "OperationUtils.h"
 
+#include <cker/fp16/Utils.h>
 #include <cker/operation/Dequantize.h>
 #include <cker/operation/Elementwise.h>
 #include <cker/operation/Erf.h>
@@ -87,6 +88,17 @@ void cast(const IPortableTensor *input, IPortableTensor *output)
   auto output_shape = getShape(output);
   const auto num_elements = MatchingFlatSize(input_shape, output_shape);
 
+  if (input->data_type() == ir::DataType::FLOAT16)
+  {
+    nnfw::cker::fp16::ToFloat(getBuffer<Half>(input), getBuffer<float>(output), num_elements);
+    return;
+  }
+  if (output->data_type() == ir::DataType::FLOAT16)
+  {
+    nnfw::cker::fp16::FromFloat(getBuffer<float>(input), getBuffer<Half>(output), num_elements);
+    return;
+  }
+
   switch (input->data_type())
   {
     case ir::DataType::FLOAT32:
@@ -229,6 +241,14 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
       }
       break;
     case ElementwiseUnaryType::kCast:
+      // FLOAT16 is only cast from and to FLOAT32, at the boundary of half precision subgraphs
+      if ((input->data_type() == OperandType::FLOAT16 &&
+           output->data_type() != OperandType::FLOAT32) ||
+          (output->data_type() == OperandType::FLOAT16 &&
+           input->data_type() != OperandType::FLOAT32))
+      {
+        throw std::runtime_error{"Cast: FLOAT16 is only cast from and to FLOAT32"};
+      }
       _kernel = cast;
       break;
     case ElementwiseUnaryType::kCos:
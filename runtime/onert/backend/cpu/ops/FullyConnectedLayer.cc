@@ -16,11 +16,16 @@
 
 #include "FullyConnectedLayer.h"
 
+#include "GGMLHelper.h"
 #include "../Tensor.h"
+#include <cker/fp16/operation/FullyConnected.h>
+#include <cker/operation/Common.h>
 #include <cker/operation/FullyConnected.h>
 #include <cker/TensorUtils.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -60,6 +65,34 @@ void FullyConnectedLayer::fullyConnectedFloat32()
                              getBuffer<float>(_output));
 }
 
+void FullyConnectedLayer::fullyConnectedFloat16()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  float output_activation_min = 0;
+  float output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  op_params.activation = convertActivationType(_activation);
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  const auto weights_shape = getShape(_weights);
+  if (_fp16_packed_weights.empty() || !_weights->is_constant())
+  {
+    const int dims_count = weights_shape.DimensionsCount();
+    const int num_units = weights_shape.Dims(dims_count - 2);
+    const int depth = weights_shape.Dims(dims_count - 1);
+    _fp16_packed_weights.resize(nnfw::cker::fp16::PackedWeightsSize(num_units, depth));
+    nnfw::cker::fp16::PackWeights(getBuffer<Half>(_weights), num_units, depth,
+                                  _fp16_packed_weights.data());
+  }
+
+  nnfw::cker::fp16::FullyConnected(op_params, getShape(_input), getBuffer<Half>(_input),
+                                   weights_shape, _fp16_packed_weights.data(), getShape(_bias),
+                                   _bias ? getBuffer<Half>(_bias) : nullptr, getShape(_output),
+                                   getBuffer<Half>(_output));
+}
+
 // executionMutex is used to protect concurrent access of non-threadsafe resources
 // like gemmlowp::GemmContext.
 void FullyConnectedLayer::fullyConnectedQuant8()
@@ -195,6 +228,49 @@ void FullyConnectedLayer::fullyConnected16x1Float32()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedGGMLWeight()
+{
+  // Weights [num_units, input_size] are kept block-quantized. ggml quantizes the input rows to
+  // the dot product type of weights and computes block dot products, split over output rows
+  // (num_units) across threads.
+  auto input = getGGMLTensor(_input);
+  auto weights = getGGMLTensor(_weights);
+  auto output = getGGMLTensor(_output);
+  // Input is [-1, input_size] like the other paths, whatever its own last dimension is
+  flattenGGMLTensor(input, weights.ne[0]);
+  flattenGGMLTensor(output, weights.ne[1]);
+  {
+    output.op = GGML_OP_MUL_MAT;
+    output.src[0] = &weights;
+    output.src[1] = &input;
+  }
+
+  computeGGMLNode(&output, _external_context->ruy_context()->max_num_threads(),
+                  _ggml_work_buffer);
+
+  if (_bias == nullptr && _activation == ir::Activation::NONE)
+    return;
+
+  float output_activation_min = 0;
+  float output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  float *output_data = getBuffer<float>(_output);
+  const int output_size = getShape(_output).FlatSize();
+  if (_bias)
+  {
+    nnfw::cker::BiasAndClamp(output_activation_min, output_activation_max,
+                             getShape(_bias).FlatSize(), getBuffer<float>(_bias), output_size,
+                             output_data);
+  }
+  else
+  {
+    for (int i = 0; i < output_size; ++i)
+      output_data[i] = std::min(std::max(output_data[i], output_activation_min),
+                                output_activation_max);
+  }
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
@@ -217,6 +293,16 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   }
 #endif
   _external_context = external_context;
+
+  if (weights->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+      weights->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    if (input->data_type() != OperandType::FLOAT32 || output->data_type() != OperandType::FLOAT32)
+      throw std::runtime_error{"FullyConnected: GGML weights require float input and output"};
+    if (_is_shuffled16x1float32)
+      throw std::runtime_error{"FullyConnected: GGML weights do not support weights_format"};
+    _external_context->initGgmlContext();
+  }
 }
 
 void FullyConnectedLayer::run()
@@ -229,10 +315,19 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (_weights->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+           _weights->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    fullyConnectedGGMLWeight();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    fullyConnectedFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     fullyConnectedQuant8();
@@ -245,7 +340,7 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  if (_bias && _bias->is_constant() && _bias->data_type() != OperandType::FLOAT16)
   {
     const int bias_size = getShape(_bias).FlatSize();
     if (nnfw::cker::IsZeroVector(getBuffer<float>(_bias), bias_size))
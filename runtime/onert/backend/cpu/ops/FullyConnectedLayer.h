@@ -23,6 +23,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -49,6 +51,8 @@ public:
 public:
   void fullyConnectedFloat32();
 
+  void fullyConnectedFloat16();
+
   void fullyConnectedQuant8();
 
   void fullyConnectedHybrid();
@@ -57,6 +61,8 @@ public:
 
   void fullyConnected16x1Float32();
 
+  void fullyConnectedGGMLWeight();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
@@ -80,6 +86,11 @@ protected:
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
 
+  // Work buffer for ggml kernel (input quantized to ggml dot product type)
+  std::vector<uint8_t> _ggml_work_buffer;
+  // FLOAT16 weights packed in single precision for GEMM, packed once if they are constant
+  std::vector<float> _fp16_packed_weights;
+
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
   bool _is_weights_freed = false;     // is weights freed?
@@ -16,6 +16,13 @@
 
 #include "GGMLHelper.h"
 
+#include <cker/IntraOpThreadPool.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
 namespace onert
 {
 namespace backend
@@ -25,6 +32,17 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Run ggml compute threads on the process-wide intra-op thread pool
+void runOnIntraOpThreadPool(void *, int n_threads, ggml_compute_task_t task, void *task_data)
+{
+  nnfw::cker::GetIntraOpThreadPool().execute(n_threads, [&](int ith) { task(task_data, ith); });
+}
+
+} // namespace
+
 ggml_type getGGMLType(ir::DataType type)
 {
   switch (type)
@@ -46,7 +64,7 @@ ggml_type getGGMLType(ir::DataType type)
 
 struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
 {
-  struct ggml_tensor res;
+  struct ggml_tensor res = {};
 
   res.type = getGGMLType(tensor->data_type());
   const auto rank = tensor->getShape().rank();
@@ -70,6 +88,48 @@ struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
   return res;
 }
 
+void flattenGGMLTensor(struct ggml_tensor &tensor, int64_t row_size)
+{
+  const int64_t num_elements = ggml_nelements(&tensor);
+  if (row_size <= 0 || num_elements % row_size != 0)
+    throw std::runtime_error("Cannot view " + std::to_string(num_elements) +
+                             " elements as rows of " + std::to_string(row_size));
+
+  tensor.ne[0] = row_size;
+  tensor.ne[1] = num_elements / row_size;
+  for (int i = 2; i < GGML_MAX_DIMS; ++i)
+    tensor.ne[i] = 1;
+
+  tensor.nb[1] = tensor.nb[0] * (tensor.ne[0] / ggml_blck_size(tensor.type));
+  for (int i = 2; i < GGML_MAX_DIMS; ++i)
+    tensor.nb[i] = tensor.nb[i - 1] * tensor.ne[i - 1];
+}
+
+void computeGGMLNode(struct ggml_tensor *node, int n_threads, std::vector<uint8_t> &work_buffer)
+{
+  // create graph
+  struct ggml_cgraph graph;
+  {
+    memset(&graph, 0, sizeof(graph));
+    graph.n_nodes = 1;
+    graph.nodes = &node;
+  }
+
+  // get cplan
+  // ggml threads wait for each other, so all of them should run on the pool at the same time.
+  // Take only the workers idle now, so kernels of other sessions are not waited for.
+  n_threads = std::min(n_threads, nnfw::cker::GetIntraOpThreadPool().availableConcurrency());
+  auto cplan = ggml_graph_plan(&graph, n_threads);
+  if (work_buffer.size() < cplan.work_size)
+    work_buffer.resize(cplan.work_size);
+  cplan.work_data = work_buffer.data();
+
+  // compute
+  if (ggml_graph_compute_with_runner(&graph, &cplan, runOnIntraOpThreadPool, nullptr) !=
+      GGML_STATUS_SUCCESS)
+    throw std::runtime_error("Failed to compute ggml graph");
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -21,6 +21,8 @@
 
 #include <ggml.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -32,6 +34,13 @@ namespace ops
 
 struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor);
 
+// View tensor as 2D [rows, row_size], like reshape to [-1, row_size]
+void flattenGGMLTensor(struct ggml_tensor &tensor, int64_t row_size);
+
+// Compute one ggml node whose sources are already set.
+// work_buffer is grown if necessary and can be reused across calls.
+void computeGGMLNode(struct ggml_tensor *node, int n_threads, std::vector<uint8_t> &work_buffer);
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
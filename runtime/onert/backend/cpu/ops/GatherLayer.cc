@@ -102,25 +102,8 @@ void GatherLayer::runByGGMLQuantInputType()
     output.src[0] = &input;
     output.src[1] = &indices;
   }
-  auto *nodes = &output;
 
-  // create graph
-  struct ggml_cgraph graph;
-  {
-    memset(&graph, 0, sizeof(graph));
-    graph.n_nodes = 1;
-    graph.nodes = &nodes;
-  }
-
-  // get cplan
-  auto cplan = ggml_graph_plan(&graph, _ctx->ruy_context()->max_num_threads());
-  cplan.work_data = (uint8_t *)(malloc(cplan.work_size));
-
-  // compute
-  ggml_graph_compute(&graph, &cplan);
-
-  // free
-  free(cplan.work_data);
+  computeGGMLNode(&output, _ctx->ruy_context()->max_num_threads(), _ggml_work_buffer);
 }
 
 void GatherLayer::run()
@@ -23,6 +23,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -57,6 +59,9 @@ private:
 
   int32_t _axis;
   ExternalContext *_ctx;
+
+  // Work buffer for ggml kernel, grown on the first run and reused afterwards
+  std::vector<uint8_t> _ggml_work_buffer;
 };
 
 } // namespace ops
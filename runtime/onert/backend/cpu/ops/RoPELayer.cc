@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in riting, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RoPELayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/RoPE.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void RoPELayer::configure(const IPortableTensor *input, const IPortableTensor *sin,
+                          const IPortableTensor *cos, nnfw::cker::RoPEMode mode,
+                          IPortableTensor *output)
+{
+  assert(input != nullptr);
+  assert(sin != nullptr);
+  assert(cos != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _sin = sin;
+  _cos = cos;
+  _mode = mode;
+  _output = output;
+}
+
+void RoPELayer::run()
+{
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      nnfw::cker::RoPE(_mode, getShape(_input), getBuffer<float>(_input), getShape(_sin),
+                       getBuffer<float>(_sin), getShape(_cos), getBuffer<float>(_cos),
+                       getShape(_output), getBuffer<float>(_output));
+      break;
+
+    default:
+      throw std::runtime_error{"RoPE: Unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
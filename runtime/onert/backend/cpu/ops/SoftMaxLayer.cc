@@ -18,6 +18,7 @@
 
 #include "OperationUtils.h"
 
+#include <cker/fp16/operation/SoftMax.h>
 #include <cker/operation/SoftMax.h>
 
 namespace onert
@@ -67,6 +68,14 @@ void SoftMaxLayer::softmaxFloat32()
   }
 }
 
+void SoftMaxLayer::softmaxFloat16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.beta = _beta;
+  nnfw::cker::fp16::Softmax(op_params, getShape(_input), getBuffer<Half>(_input),
+                            getShape(_output), getBuffer<Half>(_output));
+}
+
 template <typename T> void SoftMaxLayer::softmaxQuant8()
 {
   nnfw::cker::SoftmaxParams op_params;
@@ -113,6 +122,9 @@ void SoftMaxLayer::run()
     case OperandType::FLOAT32:
       softmaxFloat32();
       break;
+    case OperandType::FLOAT16:
+      softmaxFloat16();
+      break;
     case OperandType::QUANT_UINT8_ASYMM:
       softmaxQuant8<uint8_t>();
       break;
@@ -37,6 +37,7 @@ public:
 
 public:
   void softmaxFloat32();
+  void softmaxFloat16();
 
   template <typename T> void softmaxQuant8();
 
@@ -17,10 +17,13 @@
 #ifndef __ONERT_BACKEND_RUY_EXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_RUY_EXTERNAL_CONTEXT_H__
 
+#include <exec/WorkerIndex.h>
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -35,22 +38,37 @@ private:
   static const int kDefaultNumThreadpoolThreads = 4;
 
 public:
-  ExternalContext() : _ruy_context(new ::ruy::Context)
+  ExternalContext(uint32_t num_workers = 1)
   {
+    for (uint32_t i = 0; i < std::max(num_workers, 1u); ++i)
+      _ruy_contexts.emplace_back(std::make_unique<::ruy::Context>());
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::NUM_THREADS));
   }
 
   void setMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-      max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads = max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
+    // Workers running at once share the threads
+    const int num_workers = static_cast<int>(_ruy_contexts.size());
+    const int num_threads =
+      num_workers > 1 ? std::max(_max_num_threads / num_workers, 1) : _max_num_threads;
+    for (auto &&context : _ruy_contexts)
+      context->set_max_num_threads(num_threads);
   }
 
-  ::ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  // ruy::Context is not thread-safe, and kernels of a backend can run on several workers of
+  // ParallelExecutor at once. So each worker has its own context, and other threads use the first.
+  ::ruy::Context *ruy_context() const
+  {
+    const int worker = exec::workerIndex();
+    if (worker < 0 || worker >= static_cast<int>(_ruy_contexts.size()))
+      return _ruy_contexts.front().get();
+    return _ruy_contexts[worker].get();
+  }
 
 private:
-  const std::unique_ptr<::ruy::Context> _ruy_context;
+  std::vector<std::unique_ptr<::ruy::Context>> _ruy_contexts;
+  int _max_num_threads = kDefaultNumThreadpoolThreads;
 };
 
 } // namespace ruy
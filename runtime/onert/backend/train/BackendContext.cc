@@ -142,30 +142,35 @@ FunctionMap BackendContext::gen()
   planBackwardTensors();
 
   _tensor_builder->allocate();
+  if (!_tdata->share_trainable_tensors)
+    _tensor_builder->allocateTrainable();
   _tensor_builder->allocateBackward();
 
   auto fn_map = generateFunctionMap();
 
-  // Initialize TrainableTensors
-  trainable_graph()->operands().iterate(
-    [&](const ir::OperandIndex &ind, const ir::Operand &operand) {
-      if (external_operands().contains(ind) || !operand.isConstant())
-        return;
+  // Initialize TrainableTensors, unless they are shared from another executor
+  if (!_tdata->share_trainable_tensors)
+  {
+    trainable_graph()->operands().iterate(
+      [&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+        if (external_operands().contains(ind) || !operand.isConstant())
+          return;
 
-      auto tensor = tensor_registry()->getNativeITensor(ind);
-      assert(tensor != nullptr);
+        auto tensor = tensor_registry()->getNativeITensor(ind);
+        assert(tensor != nullptr);
 
-      VERBOSE(FillOperandData) << "Fill data for " << ind << std::endl;
+        VERBOSE(FillOperandData) << "Fill data for " << ind << std::endl;
 
-      auto data = operand.shareData();
-      assert(data && data->base());
-      auto trainable_tensor = dynamic_cast<TrainableTensor *>(tensor);
+        auto data = operand.shareData();
+        assert(data && data->base());
+        auto trainable_tensor = dynamic_cast<TrainableTensor *>(tensor);
 
-      if (trainable_tensor == nullptr)
-        throw std::runtime_error{"This tensor is not trainable tensor"};
+        if (trainable_tensor == nullptr)
+          throw std::runtime_error{"This tensor is not trainable tensor"};
 
-      trainable_tensor->fillBuffer(data);
-    });
+        trainable_tensor->fillBuffer(data);
+      });
+  }
 
   // NOTE For memory optimization, we want to free some operand data
   const_cast<ir::train::TrainableGraph &>(*_tdata->tgraph)
@@ -196,9 +201,13 @@ void BackendContext::planForwardTensors()
   });
 
   const auto ctx_data = data();
-  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
-  tensor_planner.planTrainableTensors(_tensor_builder.get());
+  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands,
+                               ctx_data->recompute_segments, ctx_data->recompute_activations,
+                               ctx_data->keep_gradients};
+  if (!ctx_data->share_trainable_tensors)
+    tensor_planner.planTrainableTensors(_tensor_builder.get());
   tensor_planner.planNonConstTensors(_tensor_builder.get());
+  tensor_planner.planRecomputeTensors(_tensor_builder.get());
 }
 
 void BackendContext::planBackwardTensors()
@@ -231,7 +240,9 @@ void BackendContext::planBackwardTensors()
 
   // Plan tensors only in backwarding to reduce peak memory usage
   const auto ctx_data = data();
-  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
+  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands,
+                               ctx_data->recompute_segments, ctx_data->recompute_activations,
+                               ctx_data->keep_gradients};
   tensor_planner.planGradientTensors(tensor_builder.get());
   tensor_planner.planBackPropTensors(tensor_builder.get());
   tensor_planner.planDisposableBackPropTensors(tensor_builder.get());
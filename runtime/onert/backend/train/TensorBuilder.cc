@@ -120,6 +120,18 @@ void TensorBuilder::notifyLastUse(const ir::OperandIndex &index)
   }
 }
 
+void TensorBuilder::notifyRecomputeFirstUse(const ir::OperandIndex &index)
+{
+  assert(!_as_constants[index]);
+  _tensor_mgr->claimRecomputePlan(index);
+}
+
+void TensorBuilder::notifyRecomputeLastUse(const ir::OperandIndex &index)
+{
+  assert(!_as_constants[index]);
+  _tensor_mgr->releaseRecomputePlan(index);
+}
+
 void TensorBuilder::notifyBackwardFirstUse(const ir::OperandIndex &index)
 {
   // TODO Support momory plan
@@ -170,11 +182,9 @@ bool TensorBuilder::isRegisteredDisposableBackwardTensor(const DisposableTensorI
   return _disposable_backprops.contains(index);
 }
 
-void TensorBuilder::allocate(void)
-{
-  _tensor_mgr->allocateNonConstTensors();
-  _tensor_mgr->allocateTrainableTensors();
-}
+void TensorBuilder::allocate(void) { _tensor_mgr->allocateNonConstTensors(); }
+
+void TensorBuilder::allocateTrainable(void) { _tensor_mgr->allocateTrainableTensors(); }
 
 void TensorBuilder::allocateBackward(void)
 {
@@ -58,6 +58,8 @@ public:
   // TODO Support memory plan of all tensors
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
+  void notifyRecomputeFirstUse(const ir::OperandIndex &);
+  void notifyRecomputeLastUse(const ir::OperandIndex &);
   void notifyBackwardFirstUse(const ir::OperandIndex &);
   void notifyBackwardLastUse(const ir::OperandIndex &);
   void notifyDisposableBackPropFirstUse(const DisposableTensorIndex &);
@@ -68,6 +70,7 @@ public:
   bool isRegisteredDisposableBackwardTensor(const DisposableTensorIndex &index) const;
 
   void allocate(void);
+  void allocateTrainable(void);
   void allocateBackward(void);
 
 private:
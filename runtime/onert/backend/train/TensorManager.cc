@@ -54,7 +54,7 @@ namespace train
 {
 
 TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_t optim_vars_count)
-  : _nonconst_mgr{new MemoryManager()},
+  : _nonconst_mgr{new MemoryManager()}, _recompute_mgr{new MemoryManager()},
     _trainable_mgr{new TrainableMemoryManager(optim_vars_count)},
     _back_prop_mgr{new MemoryManager()}, _gradient_mgr{new MemoryManager()},
     // TODO Find a suitable planner of disposable tensors to reduce peak memory usage
@@ -65,8 +65,19 @@ TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_
 
 void TensorManager::allocateNonConstTensors()
 {
-  allocateMemory(_nonconst_mgr.get(), _tensors->nonconst_tensors(),
-                 std::string{"               TENSOR "});
+  _nonconst_mgr->allocate();
+  _recompute_mgr->allocate();
+
+  for (auto &&[index, tensor] : _tensors->nonconst_tensors())
+  {
+    assert(!tensor->is_dynamic());
+
+    const bool recompute = _recompute_tensors.contains(index);
+    auto *buffer = recompute ? _recompute_mgr->getBuffer(index) : _nonconst_mgr->getBuffer(index);
+    tensor->setBuffer(buffer);
+    VERBOSE(TensorManager) << (recompute ? "     RECOMPUTE TENSOR " : "               TENSOR ")
+                           << index << " : " << static_cast<void *>(buffer) << std::endl;
+  }
 }
 
 void TensorManager::allocateTrainableTensors()
@@ -122,6 +133,23 @@ void TensorManager::releaseNonConstPlan(const ir::OperandIndex &index)
   _nonconst_mgr->releasePlan(index);
 }
 
+void TensorManager::claimRecomputePlan(const ir::OperandIndex &index)
+{
+  auto tensor = _tensors->getNonConstTensor(index);
+  assert(tensor && !tensor->is_dynamic());
+
+  auto size = alignedSize(tensor->total_size(), _align);
+  _recompute_mgr->claimPlan(index, size);
+  _recompute_tensors.add(index);
+}
+
+void TensorManager::releaseRecomputePlan(const ir::OperandIndex &index)
+{
+  assert(_recompute_tensors.contains(index));
+
+  _recompute_mgr->releasePlan(index);
+}
+
 void TensorManager::claimTrainablePlan(const ir::OperandIndex &index)
 {
   auto tensor = _tensors->getTrainableTensor(index);
@@ -23,6 +23,7 @@
 
 #include <ir/OperandIndexMap.h>
 #include <ir/OperandInfo.h>
+#include <util/Set.h>
 
 namespace onert
 {
@@ -53,6 +54,8 @@ public:
 
   void claimNonConstPlan(const ir::OperandIndex &ind);
   void releaseNonConstPlan(const ir::OperandIndex &ind);
+  void claimRecomputePlan(const ir::OperandIndex &ind);
+  void releaseRecomputePlan(const ir::OperandIndex &ind);
   void claimTrainablePlan(const ir::OperandIndex &ind);
   void releaseTrainablePlan(const ir::OperandIndex &ind);
   void claimBackPropPlan(const ir::OperandIndex &ind);
@@ -65,6 +68,9 @@ public:
 
 private:
   std::unique_ptr<MemoryManager> _nonconst_mgr;
+  // Non-constant tensors that are recomputed in backwarding share memory across segments
+  std::unique_ptr<MemoryManager> _recompute_mgr;
+  util::Set<ir::OperandIndex> _recompute_tensors;
   std::unique_ptr<TrainableMemoryManager> _trainable_mgr;
   std::unique_ptr<MemoryManager> _back_prop_mgr;
   std::unique_ptr<MemoryManager> _gradient_mgr;
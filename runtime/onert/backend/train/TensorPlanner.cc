@@ -18,6 +18,8 @@
 
 #include <util/logging.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -25,9 +27,13 @@ namespace backend
 namespace train
 {
 
-TensorPlanner::TensorPlanner(const ir::train::TrainableGraph &tgraph,
-                             const util::Set<ir::OperandIndex> &external_operands)
-  : _tgraph{tgraph}, _external_operands{external_operands}
+TensorPlanner::TensorPlanner(
+  const ir::train::TrainableGraph &tgraph, const util::Set<ir::OperandIndex> &external_operands,
+  const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+  const std::vector<std::vector<ir::OperandIndex>> &recompute_activations, bool keep_gradients)
+  : _tgraph{tgraph}, _external_operands{external_operands},
+    _recompute_segments{recompute_segments}, _recompute_activations{recompute_activations},
+    _keep_gradients{keep_gradients}
 {
   // DO NOTHING
   // TODO Remove the following lines
@@ -45,6 +51,12 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   std::unordered_map<ir::train::TrainingOperandIndex, uint32_t> uses_map;
   std::unordered_map<ir::train::TrainingOperandIndex, uint32_t> defs_map;
 
+  // Tensors recomputed in backwarding are planned in planRecomputeTensors()
+  util::Set<ir::OperandIndex> recomputed;
+  for (const auto &activations : _recompute_activations)
+    for (const auto &index : activations)
+      recomputed.add(index);
+
   // Prepare scanning
   // This assumes TrainingOperationIndex in forwarding are always used
   for (const auto &[operand_index, operand_usedefs] : training_usedefs)
@@ -53,6 +65,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
 
     if (_external_operands.contains(operand_index.index()))
       continue;
+    if (recomputed.contains(operand_index.index()))
+      continue;
 
     if (!operand_index.is_forward() || operand.isConstant())
       continue;
@@ -82,6 +96,47 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
       operands_last_until_end.push_back(operand_index);
   }
 
+  // Recomputing a segment reads and writes the tensors at its boundary again. Keep them until the
+  // segment is recomputed, i.e. just before backwarding its first operation.
+  const auto border = _tgraph.essentialBackwardOrder();
+  std::unordered_map<ir::OperationIndex, std::vector<ir::train::TrainingOperandIndex>>
+    recompute_uses;
+  std::vector<ir::train::TrainingOperandIndex> recompute_uses_until_end;
+  for (const auto &segment : _recompute_segments)
+  {
+    const auto point = std::find_if(border.begin(), border.end(), [&](const auto &op_index) {
+      return std::find(segment.begin(), segment.end(), op_index) != segment.end();
+    });
+
+    util::Set<ir::train::TrainingOperandIndex> boundary;
+    for (const auto &op_index : segment)
+    {
+      if (!_tgraph.operations().exist(op_index))
+        continue;
+
+      const auto &op = _tgraph.operations().at(op_index);
+      for (const auto &index : (op.getInputs() + op.getOutputs()) | ir::Remove::DUPLICATED |
+                                 ir::Remove::UNDEFINED)
+      {
+        const auto operand_index = ir::train::TrainingOperandIndex{index, true};
+        const auto it = uses_map.find(operand_index);
+        if (it == uses_map.end() || it->second == 0 || boundary.contains(operand_index))
+          continue;
+
+        boundary.add(operand_index);
+        it->second++;
+      }
+    }
+
+    for (const auto &operand_index : boundary)
+    {
+      if (point != border.end())
+        recompute_uses[*point].emplace_back(operand_index);
+      else
+        recompute_uses_until_end.emplace_back(operand_index);
+    }
+  }
+
   // Plan used or defined tensors in forwarding nodes
   // At each operation,
   // 1. Scan DEF of outputs. If the DEF, allocate it
@@ -101,6 +156,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
         continue;
       if (!tensor_builder->isRegistered(output))
         continue;
+      if (recomputed.contains(output))
+        continue;
 
       const auto output_index = ir::train::TrainingOperandIndex{output, true};
       assert(defs_map.find(output_index) != defs_map.end());
@@ -136,6 +193,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
         continue;
       if (!tensor_builder->isRegistered(input))
         continue;
+      if (recomputed.contains(input))
+        continue;
 
       const auto input_index = ir::train::TrainingOperandIndex{input, true};
       const auto &operand = training_usedefs.at(input_index).operand();
@@ -154,9 +213,20 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   }
 
   // Plan used tensors in backwarding nodes
-  const auto border = _tgraph.essentialBackwardOrder();
   for (const auto &op_index : border)
   {
+    const auto recompute_it = recompute_uses.find(op_index);
+    if (recompute_it != recompute_uses.end())
+    {
+      for (const auto &operand_index : recompute_it->second)
+      {
+        assert(uses_map[operand_index] > 0);
+        uses_map[operand_index]--;
+        if (uses_map[operand_index] == 0)
+          tensor_builder->notifyLastUse(operand_index.index());
+      }
+    }
+
     const auto &op = _tgraph.operations().at(op_index);
     auto op_inputs = op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
     auto op_outputs = op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
@@ -167,6 +237,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
         continue;
       if (!tensor_builder->isRegistered(index))
         continue;
+      if (recomputed.contains(index))
+        continue;
 
       const auto operand_index = ir::train::TrainingOperandIndex{index, true};
       assert(training_usedefs.find(operand_index) != training_usedefs.end());
@@ -194,6 +266,14 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
     }
   }
 
+  for (const auto &operand_index : recompute_uses_until_end)
+  {
+    assert(uses_map[operand_index] > 0);
+    uses_map[operand_index]--;
+    if (uses_map[operand_index] == 0)
+      tensor_builder->notifyLastUse(operand_index.index());
+  }
+
   for (const auto &operand_index : operands_last_until_end)
   {
     tensor_builder->notifyLastUse(operand_index.index());
@@ -210,6 +290,32 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   VERBOSE(BackendContext) << "Finish planning non-constant tensors" << std::endl;
 }
 
+void TensorPlanner::planRecomputeTensors(TensorBuilder *tensor_builder)
+{
+  VERBOSE(BackendContext) << "Start planning recomputed tensors" << std::endl;
+
+  // Activations of a segment are alive together while the segment is forwarded, recomputed or
+  // backwarded, and segments never run at the same time. So each segment can reuse the memory of
+  // the previous one.
+  for (const auto &activations : _recompute_activations)
+  {
+    std::vector<ir::OperandIndex> planned;
+    for (const auto &index : activations)
+    {
+      if (_external_operands.contains(index) || !tensor_builder->isRegistered(index))
+        continue;
+
+      tensor_builder->notifyRecomputeFirstUse(index);
+      planned.emplace_back(index);
+    }
+
+    for (const auto &index : planned)
+      tensor_builder->notifyRecomputeLastUse(index);
+  }
+
+  VERBOSE(BackendContext) << "Finish planning recomputed tensors" << std::endl;
+}
+
 void TensorPlanner::planTrainableTensors(TensorBuilder *tensor_builder)
 {
   VERBOSE(BackendContext) << "Start planning constant tensors" << std::endl;
@@ -419,6 +525,9 @@ void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder)
   // TODO Use DisposableTensor instead of GradientTensor to plan them together if possible
   //      Backward layers and the corresponding GradientApplier exist in the same back-propagated
   //      operation sequence. So we can use DisposableTensors to plan GradientTensors.
+  // If gradients are kept, they are alive until the whole backwarding ends so that they can be
+  // applied after backwarding, e.g. after being reduced over replicas
+  std::vector<ir::train::TrainingOperandIndex> kept_seq;
   for (const auto &op_index : _tgraph.essentialBackwardOrder())
   {
     std::vector<ir::train::TrainingOperandIndex> cur_seq;
@@ -447,12 +556,23 @@ void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder)
       }
     }
 
+    if (_keep_gradients)
+    {
+      kept_seq.insert(kept_seq.end(), cur_seq.begin(), cur_seq.end());
+      continue;
+    }
+
     for (const auto &operand_index : cur_seq)
     {
       tensor_builder->notifyBackwardLastUse(operand_index.index());
     }
   }
 
+  for (const auto &operand_index : kept_seq)
+  {
+    tensor_builder->notifyBackwardLastUse(operand_index.index());
+  }
+
   VERBOSE(BackendContext) << "Finish planning gradient tensors" << std::endl;
 }
 
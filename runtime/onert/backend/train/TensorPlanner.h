@@ -33,7 +33,10 @@ class TensorPlanner
 {
 public:
   TensorPlanner(const ir::train::TrainableGraph &tgraph,
-                const util::Set<ir::OperandIndex> &external_operands);
+                const util::Set<ir::OperandIndex> &external_operands,
+                const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+                const std::vector<std::vector<ir::OperandIndex>> &recompute_activations,
+                bool keep_gradients);
   TensorPlanner(const TensorPlanner &) = delete;
   TensorPlanner(TensorPlanner &&) = delete;
   TensorPlanner &operator=(const TensorPlanner &) = delete;
@@ -41,6 +44,7 @@ public:
   ~TensorPlanner() = default;
 
   void planNonConstTensors(TensorBuilder *tensor_builder);
+  void planRecomputeTensors(TensorBuilder *tensor_builder);
   void planTrainableTensors(TensorBuilder *tensor_builder);
   void planBackPropTensors(TensorBuilder *tensor_builder);
   void planGradientTensors(TensorBuilder *tensor_builder);
@@ -53,6 +57,9 @@ private:
 private:
   const ir::train::TrainableGraph &_tgraph;
   const util::Set<ir::OperandIndex> &_external_operands;
+  const std::vector<std::vector<ir::OperationIndex>> &_recompute_segments;
+  const std::vector<std::vector<ir::OperandIndex>> &_recompute_activations;
+  bool _keep_gradients;
 };
 
 } // namespace train
@@ -46,6 +46,8 @@ struct ContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Number of executor workers that may run kernels of the backend at once */
+  uint32_t num_workers = 1;
 };
 
 class BackendContext
@@ -22,6 +22,7 @@
 #ifndef __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
+#include <functional>
 #include <memory>
 
 namespace onert
@@ -36,8 +37,17 @@ namespace basic
  */
 class Allocator
 {
+public:
+  using Deleter = std::function<void(uint8_t *)>;
+
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct with memory owned by others, which is handed back to deleter on release
+   * @param[in] base    Memory base pointer
+   * @param[in] deleter Function called with base on release
+   */
+  Allocator(uint8_t *base, Deleter deleter);
   /**
    * @brief Get memory base pointer
    * @return base pointer
@@ -46,7 +56,7 @@ public:
   void release() { _base.reset(); }
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  std::unique_ptr<uint8_t[], Deleter> _base;
 };
 
 } // namespace basic
@@ -55,7 +55,6 @@ private:
 private:
   /**
    * @brief Memory manager for dynamic tensor.
-   * @todo  DynamicMemoryManager is not optimized. Optimized one is needed
    */
   std::shared_ptr<DynamicMemoryManager> _dynamic_mem_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
@@ -21,6 +21,8 @@
 #include "ir/Index.h"
 #include "IMemoryPlanner.h"
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -31,6 +33,8 @@ class ITensor;
 namespace basic
 {
 
+class DynamicMemoryPool;
+
 class MemoryManager
 {
 public:
@@ -55,18 +59,34 @@ protected:
   std::shared_ptr<Allocator> _mem_alloc;
 };
 
+/**
+ * @brief Memory manager for dynamic tensors
+ *
+ * Memory of deallocated tensors is kept in a pool and reused for later allocations, also in later
+ * runs, so that steady-state inference with dynamic shapes does not allocate system memory.
+ */
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  DynamicMemoryManager();
   virtual ~DynamicMemoryManager() = default;
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
+  /**
+   * @brief Reserve memory for tensors of sizes in bytes, which will be allocated later
+   */
+  void reserve(const std::vector<size_t> &sizes);
+  /**
+   * @brief Total bytes of memory held, including memory kept for reuse
+   */
+  size_t reserved_size() const;
+
 private:
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  std::shared_ptr<DynamicMemoryPool> _pool;
 };
 
 } // namespace basic
@@ -124,6 +124,11 @@ public:
 
   void setShape(const ir::Shape &new_shape) override;
 
+  /**
+   * @brief Memory manager that allocates the buffer when the shape changes, nullptr if none
+   */
+  DynamicMemoryManager *dynamic_mem_mgr() const { return _dynamic_mem_mgr; }
+
 protected:
   uint8_t *_buffer;
   size_t _size;
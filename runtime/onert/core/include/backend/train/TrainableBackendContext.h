@@ -52,6 +52,15 @@ struct TrainableContextData
   bool is_linear_executor;
   /* Optimizer information */
   ir::train::OptimizerInfo optim_info;
+  /* Segments of operations run again in backwarding, in forward order */
+  std::vector<std::vector<onert::ir::OperationIndex>> recompute_segments;
+  /* Activations alive only while their segment is running, grouped by segment in forward order */
+  std::vector<std::vector<onert::ir::OperandIndex>> recompute_activations;
+  /* Keep gradients alive until backwarding ends to apply them after backwarding */
+  bool keep_gradients = false;
+  /* Trainable tensors share buffers of another executor, so they are neither planned nor
+   * allocated */
+  bool share_trainable_tensors = false;
 };
 
 class TrainableBackendContext
@@ -65,6 +65,10 @@ struct CompilerOptions
 
   // GENERAL OPTIONS
   std::vector<std::string> backend_list;
+  bool search_order;   //< Whether Linear executor searches an order with lower peak memory
+  int train_recompute_budget; //< Activation memory budget in KB for recomputation in training.
+                              //  0 to minimize memory, negative to keep all activations
+  int train_num_replicas; //< Number of replicas to train a batch on in parallel
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   int graph_dump_level; //< Graph dump level, values between 0 and 2 are valid
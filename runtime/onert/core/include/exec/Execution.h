@@ -35,6 +35,8 @@ namespace onert
 namespace exec
 {
 
+class MultiModelPipeline;
+
 /**
  * @brief Class to define execution instance to collect input/output information for inference
  *        and prepare executor run (TODO)
@@ -48,6 +50,7 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<IExecutors> &executors);
+  ~Execution();
 
 public:
   /**
@@ -171,6 +174,40 @@ public:
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const;
 
+  /**
+   * @brief     Start pipelined execution of multi model package
+   * @note      Each model runs on its own thread as a pipeline stage
+   * @param[in] depth Maximum number of in-flight inferences.
+   *                  If it is 0, the number of models + 1 is used.
+   */
+  void startPipeline(uint32_t depth);
+
+  /**
+   * @brief     Push package inputs to pipeline
+   * @note      It blocks while @c depth inferences are in flight.
+   *            Input buffers are copied, so they can be reused after return.
+   * @param[in] inputs  Input buffers
+   * @param[in] lengths Input buffers' byte size
+   */
+  void pushPipelineInput(const std::vector<const void *> &inputs,
+                         const std::vector<size_t> &lengths);
+
+  /**
+   * @brief      Pop package outputs of the oldest inference in pipeline
+   * @param[out] outputs Output buffers allocated by new uint8_t[], caller must delete them
+   * @return     @c false if pipeline is finished and has no more output, otherwise @c true
+   */
+  bool popPipelineOutput(std::vector<void *> &outputs);
+
+  /**
+   * @brief Stop accepting pipeline inputs and wait for all pipeline stage threads to finish
+   * @note  Outputs of pushed inputs can still be popped, and execute() can be used again
+   */
+  void finishPipeline();
+
+  bool isPipelineStarted() const { return _pipeline != nullptr; }
+  bool hasPipelineOutput() const { return _pipeline != nullptr || _finished_pipeline != nullptr; }
+
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
   size_t getInputTotalSize(ir::IOIndex ind) const;
@@ -178,6 +215,12 @@ public:
 
   ExecutionOptions &executionOptions() { return _ctx.options; }
 
+  /**
+   * @brief   Get latency statistics of the primary subgraph
+   * @return  Latency statistics, nullptr if the executor does not record them
+   */
+  const LatencyStats *latencyStats() const { return entryExecutor()->latencyStats(); }
+
 private:
   const IExecutor *entryExecutor() const { return _executors->entryExecutor(); };
   IExecutor *entryExecutor() { return _executors->entryExecutor(); };
@@ -186,6 +229,9 @@ private:
   const std::shared_ptr<IExecutors> _executors;
   ExecutionContext _ctx;
   std::unique_ptr<std::thread> _exec_thread;
+  std::unique_ptr<MultiModelPipeline> _pipeline;
+  // Finished pipeline kept until its remaining outputs are popped
+  std::unique_ptr<MultiModelPipeline> _finished_pipeline;
   bool finished{false};
 };
 
@@ -68,6 +68,8 @@ struct ExecutionOptions
   bool dump_minmax = false;
   bool trace = false;
   bool profile = false;
+  // Record latencies of 1 in stats_sampling executions, 0 to disable
+  uint32_t stats_sampling = 0;
 
   static void fromGlobalConfig(ExecutionOptions &options);
 };
@@ -36,6 +36,8 @@ namespace onert
 {
 namespace exec
 {
+class LatencyStats;
+
 /**
  * @brief Struct to define interface of Executor
  */
@@ -121,6 +123,19 @@ struct IExecutor
    * @return  Current execution configuration
    */
   virtual const ExecutionOptions &currentOptions() const = 0;
+
+  /**
+   * @brief   Get latency statistics of sampled executions
+   * @return  Latency statistics, nullptr if this executor does not record them
+   */
+  virtual const LatencyStats *latencyStats() const { return nullptr; }
+
+  /**
+   * @brief   Reserve memory of dynamic tensors for a new input shape before execution
+   * @param[in] index Input index
+   * @param[in] shape Shape that the input will have
+   */
+  virtual void reserveForInputShape(const ir::IOIndex &, const ir::Shape &) {}
 };
 
 } // namespace exec
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_LATENCY_STATS_H__
+#define __ONERT_EXEC_LATENCY_STATS_H__
+
+#include "backend/Backend.h"
+#include "ir/Graph.h"
+#include "ir/Index.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Histogram of latencies in nanoseconds with fixed buckets
+ *
+ * Each power of two range is divided into 4 buckets, so a percentile is reported with at most 25%
+ * error. Recording is lock-free and can be done concurrently with other records and reads.
+ */
+class LatencyHistogram
+{
+public:
+  static constexpr uint32_t SUB_BUCKET_BITS = 2;
+  static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+  // Latencies over 2^48 ns (about 3 days) are counted in the last bucket
+  static constexpr uint32_t MAX_EXPONENT = 47;
+  static constexpr uint32_t NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+public:
+  void record(uint64_t ns);
+  void merge(const LatencyHistogram &other);
+
+  uint64_t count() const { return _count.load(std::memory_order_relaxed); }
+  uint64_t total() const { return _total.load(std::memory_order_relaxed); }
+  /**
+   * @brief     Get the latency that the given ratio of records does not exceed
+   * @param[in] ratio Ratio in [0, 1], e.g. 0.99 for p99
+   * @return    Upper bound of the bucket of the percentile, 0 if nothing is recorded
+   */
+  uint64_t percentile(double ratio) const;
+
+  static uint32_t bucket(uint64_t ns);
+  static uint64_t upperBound(uint32_t bucket);
+
+private:
+  std::array<std::atomic<uint64_t>, NUM_BUCKETS> _buckets{};
+  std::atomic<uint64_t> _count{0};
+  std::atomic<uint64_t> _total{0};
+};
+
+/**
+ * @brief Latency histograms of sampled executions of an executor
+ *
+ * It keeps a histogram of whole executions and one for each operation. Histograms are allocated
+ * when the first execution is sampled.
+ */
+class LatencyStats
+{
+public:
+  explicit LatencyStats(const ir::Graph &graph);
+
+public:
+  /**
+   * @brief     Decide whether an execution is recorded
+   * @param[in] interval Record 1 in @c interval executions
+   * @return    @c true if this execution should be recorded
+   */
+  bool sample(uint32_t interval);
+  void recordRun(uint64_t ns);
+  void recordOperation(ir::OperationIndex index, const backend::Backend *backend, uint64_t ns);
+
+  const LatencyHistogram &run() const { return _run; }
+  /**
+   * @brief     Get histogram of an operation
+   * @return    Histogram of the operation, nullptr if there is no such operation or
+   *            nothing has been sampled yet
+   */
+  const LatencyHistogram *operation(ir::OperationIndex index) const;
+  /**
+   * @brief     Merge histograms of operations run on a backend
+   * @param[in] id   Backend id, e.g. "cpu"
+   * @param[out] hist Histogram to merge into
+   */
+  void backend(const std::string &id, LatencyHistogram &hist) const;
+
+private:
+  uint32_t _num_operations;
+  std::atomic<uint64_t> _num_runs{0};
+  LatencyHistogram _run;
+  std::once_flag _allocated;
+  std::atomic<bool> _ready{false};
+  std::vector<LatencyHistogram> _operations;
+  std::vector<std::atomic<const backend::Backend *>> _backends;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_LATENCY_STATS_H__
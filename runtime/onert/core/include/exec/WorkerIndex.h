@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORKER_INDEX_H__
+#define __ONERT_EXEC_WORKER_INDEX_H__
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Get the index of the executor worker running on the calling thread
+ *
+ * Backends use it to pick per-worker resources, e.g. ruy::Context, without locking.
+ *
+ * @return Index of the worker, or -1 if the calling thread is not an executor worker
+ */
+int workerIndex();
+
+/**
+ * @brief Set the index of the executor worker running on the calling thread
+ *
+ * @param index Index of the worker, or -1 to unset
+ */
+void setWorkerIndex(int index);
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORKER_INDEX_H__
@@ -18,6 +18,7 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <cstdint>
 #include <sys/mman.h>
 
 namespace onert
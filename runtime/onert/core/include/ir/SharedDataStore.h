@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_SHARED_DATA_STORE_H__
+#define __ONERT_IR_SHARED_DATA_STORE_H__
+
+#include "ir/Data.h"
+#include "ir/DataType.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Process-wide store of constant data shared by sessions loading the same model file
+ *
+ * Data is owned by the sessions using it and the store only keeps weak references, so data is
+ * released when the last session using it is closed. Besides data as it is in the model file,
+ * data prepared from it by backends (e.g. transposed weights) is kept under the same key with
+ * a different layout.
+ */
+class SharedDataStore
+{
+public:
+  struct Key
+  {
+    // Identity of the model file
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    int64_t file_size = 0;
+    int64_t mtime_ns = 0;
+    // Index of the buffer in the model file
+    uint32_t buffer_index = 0;
+    // Empty for data as it is in the model file, otherwise the name of the layout prepared by
+    // a backend
+    std::string layout;
+    // Shape and type of the data in the layout. A buffer can be used by operands of different
+    // shapes or types, and a backend prepares different data for each of them.
+    std::vector<int32_t> dims;
+    DataType data_type = DataType::FLOAT32;
+
+    bool operator<(const Key &other) const
+    {
+      return std::tie(device, inode, file_size, mtime_ns, buffer_index, layout, dims, data_type) <
+             std::tie(other.device, other.inode, other.file_size, other.mtime_ns,
+                      other.buffer_index, other.layout, other.dims, other.data_type);
+    }
+  };
+
+public:
+  static SharedDataStore &get();
+
+public:
+  /**
+   * @brief Return the data of key, or create it by create() if no session holds it
+   */
+  std::shared_ptr<Data> getOrCreate(const Key &key,
+                                    const std::function<std::unique_ptr<Data>()> &create);
+
+  /**
+   * @brief Find the key of data which is alive and was created by this store
+   *
+   * @param base Base address of the data
+   * @param key  Key of the data if found
+   * @return true if found
+   */
+  bool findKey(const uint8_t *base, Key &key) const;
+
+  /**
+   * @brief Number of data which are alive
+   */
+  size_t size() const;
+
+private:
+  SharedDataStore() = default;
+
+  void release(const Key &key, const Data *data);
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<Data> data;
+    const Data *raw = nullptr;
+  };
+
+  mutable std::mutex _mutex;
+  std::map<Key, Entry> _entries;
+  std::unordered_map<const uint8_t *, Key> _base_to_key;
+};
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_SHARED_DATA_STORE_H__
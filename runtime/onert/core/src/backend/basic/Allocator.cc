@@ -26,13 +26,17 @@ namespace basic
 {
 
 Allocator::Allocator(uint32_t capacity)
+  : _base{new uint8_t[capacity](), std::default_delete<uint8_t[]>{}}
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
-
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
 }
 
+Allocator::Allocator(uint8_t *base, Deleter deleter) : _base{base, std::move(deleter)}
+{
+  // DO NOTHING
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DynamicMemoryPool.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <set>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+std::shared_ptr<Allocator> DynamicMemoryPool::allocate(size_t size)
+{
+  const auto size_class = sizeClass(size);
+  std::unique_ptr<uint8_t[]> block;
+  size_t block_size = size_class;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    // Smallest free block that fits, not to waste a large block for a small tensor
+    auto it = _free_blocks.lower_bound(size_class);
+    if (it != _free_blocks.end() && it->first <= 2 * size_class)
+    {
+      block_size = it->first;
+      block = std::move(it->second);
+      _free_blocks.erase(it);
+    }
+    else
+    {
+      trim(size_class);
+      block = std::make_unique<uint8_t[]>(size_class);
+      _reserved_size += size_class;
+      _high_water_size = std::max(_high_water_size, _reserved_size);
+      _num_allocated_blocks++;
+      VERBOSE(DynamicMemoryPool) << "Allocate block of " << size_class << " bytes (reserved "
+                                 << _reserved_size << " bytes)" << std::endl;
+    }
+    _used_size += block_size;
+  }
+
+  // Blocks still in use when the pool is destroyed are freed by themselves
+  std::weak_ptr<DynamicMemoryPool> pool = weak_from_this();
+  return std::make_shared<Allocator>(block.release(), [pool, block_size](uint8_t *base) {
+    if (auto locked = pool.lock())
+      locked->release(base, block_size);
+    else
+      delete[] base;
+  });
+}
+
+void DynamicMemoryPool::reserve(const std::vector<size_t> &sizes)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  // Sizes of free blocks not taken by a request yet, matched the same way as allocate()
+  std::multiset<size_t> free_sizes;
+  for (const auto &[block_size, block] : _free_blocks)
+    free_sizes.insert(block_size);
+
+  for (const auto size : sizes)
+  {
+    const auto size_class = sizeClass(size);
+    auto it = free_sizes.lower_bound(size_class);
+    if (it != free_sizes.end() && *it <= 2 * size_class)
+    {
+      free_sizes.erase(it);
+      continue;
+    }
+
+    // Reserved blocks raise the high-water mark, so that trim() keeps them
+    _free_blocks.emplace(size_class, std::make_unique<uint8_t[]>(size_class));
+    _reserved_size += size_class;
+    _high_water_size = std::max(_high_water_size, _reserved_size);
+    _num_allocated_blocks++;
+    VERBOSE(DynamicMemoryPool) << "Reserve block of " << size_class << " bytes (reserved "
+                               << _reserved_size << " bytes)" << std::endl;
+  }
+}
+
+size_t DynamicMemoryPool::reserved_size() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _reserved_size;
+}
+
+size_t DynamicMemoryPool::used_size() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _used_size;
+}
+
+size_t DynamicMemoryPool::num_allocated_blocks() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _num_allocated_blocks;
+}
+
+size_t DynamicMemoryPool::sizeClass(size_t size)
+{
+  constexpr size_t kMinSize = 64;
+  if (size <= kMinSize)
+    return kMinSize;
+
+  // Four classes between powers of two
+  size_t power = kMinSize;
+  while (power <= size / 2)
+    power <<= 1;
+  const size_t step = power / 4;
+  return (size + step - 1) / step * step;
+}
+
+void DynamicMemoryPool::release(uint8_t *base, size_t block_size)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  assert(_used_size >= block_size);
+  _used_size -= block_size;
+  _free_blocks.emplace(block_size, base);
+}
+
+void DynamicMemoryPool::trim(size_t size)
+{
+  // Larger free blocks are kept, as they can still serve smaller requests
+  auto end = _free_blocks.lower_bound(size);
+  while (_reserved_size + size > _high_water_size && end != _free_blocks.begin())
+  {
+    auto it = std::prev(end);
+    _reserved_size -= it->first;
+    _free_blocks.erase(it);
+  }
+}
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_DYNAMIC_MEMORY_POOL_H__
+#define __ONERT_BACKEND_BASIC_DYNAMIC_MEMORY_POOL_H__
+
+#include "backend/basic/Allocator.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+/**
+ * @brief Pool of memory blocks for dynamic tensors
+ *
+ * Sizes are rounded up to size classes, and released blocks are kept to be reused. A request is
+ * served by the smallest free block that fits, if it is at most twice the size class. Free blocks
+ * are freed only when a new block would make the pool hold more memory than its high-water mark,
+ * and only the ones smaller than the new block. So once a model has run with its usual shapes,
+ * later runs do not allocate system memory.
+ */
+class DynamicMemoryPool : public std::enable_shared_from_this<DynamicMemoryPool>
+{
+public:
+  DynamicMemoryPool() = default;
+  DynamicMemoryPool(const DynamicMemoryPool &) = delete;
+  DynamicMemoryPool &operator=(const DynamicMemoryPool &) = delete;
+
+public:
+  /**
+   * @brief Get a block of at least size bytes, which goes back to the pool on release
+   */
+  std::shared_ptr<Allocator> allocate(size_t size);
+
+  /**
+   * @brief Put free blocks in advance, so that requests of sizes are served without system memory
+   *
+   * Free blocks that can already serve a request are used for it, so reserving the same sizes
+   * again does not grow the pool.
+   */
+  void reserve(const std::vector<size_t> &sizes);
+
+  /**
+   * @brief Total bytes of blocks in use and in free lists
+   */
+  size_t reserved_size() const;
+
+  /**
+   * @brief Total bytes of blocks in use
+   */
+  size_t used_size() const;
+
+  /**
+   * @brief Number of blocks allocated from system memory so far
+   */
+  size_t num_allocated_blocks() const;
+
+  /**
+   * @brief Size class of size. At most a quarter of a block is wasted.
+   */
+  static size_t sizeClass(size_t size);
+
+private:
+  void release(uint8_t *base, size_t block_size);
+  // Free blocks smaller than size, largest first, until size more bytes fits the high-water mark
+  void trim(size_t size);
+
+private:
+  mutable std::mutex _mutex;
+  // Free blocks by their size
+  std::multimap<size_t, std::unique_ptr<uint8_t[]>> _free_blocks;
+  size_t _reserved_size = 0;
+  size_t _used_size = 0;
+  size_t _high_water_size = 0;
+  size_t _num_allocated_blocks = 0;
+};
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_BASIC_DYNAMIC_MEMORY_POOL_H__
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DynamicMemoryPool.h"
+
+#include "backend/basic/MemoryManager.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::backend::basic;
+
+TEST(DynamicMemoryPool, sizeClass)
+{
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(0), 64);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(64), 64);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(65), 80);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(128), 128);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(1000), 1024);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(1025), 1280);
+
+  for (size_t size = 1; size < 100000; size += 37)
+  {
+    const auto size_class = DynamicMemoryPool::sizeClass(size);
+    ASSERT_GE(size_class, size);
+    ASSERT_LE(size_class, std::max<size_t>(64, size + size / 4));
+  }
+}
+
+TEST(DynamicMemoryPool, reuse)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  auto alloc = pool->allocate(1000);
+  ASSERT_NE(alloc->base(), nullptr);
+  const auto base = alloc->base();
+  ASSERT_EQ(pool->used_size(), 1024);
+  alloc->release();
+  ASSERT_EQ(pool->used_size(), 0);
+  ASSERT_EQ(pool->reserved_size(), 1024);
+
+  // Same size class
+  auto alloc2 = pool->allocate(990);
+  ASSERT_EQ(alloc2->base(), base);
+  ASSERT_EQ(pool->reserved_size(), 1024);
+
+  // Destroying allocator also releases the block
+  alloc2.reset();
+  ASSERT_EQ(pool->used_size(), 0);
+}
+
+TEST(DynamicMemoryPool, trim)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  auto alloc1 = pool->allocate(1024);
+  auto alloc2 = pool->allocate(2048);
+  alloc1.reset();
+  alloc2.reset();
+  ASSERT_EQ(pool->reserved_size(), 3072);
+
+  // Peak usage is 3072 bytes, so free blocks are freed to fit new size class
+  auto alloc3 = pool->allocate(3072);
+  ASSERT_EQ(pool->used_size(), 3072);
+  ASSERT_EQ(pool->reserved_size(), 3072);
+}
+
+TEST(DynamicMemoryPool, best_fit)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  auto alloc1 = pool->allocate(1024);
+  auto alloc2 = pool->allocate(4096);
+  const auto base1 = alloc1->base();
+  const auto base2 = alloc2->base();
+  alloc1.reset();
+  alloc2.reset();
+
+  // Smallest block that fits
+  alloc1 = pool->allocate(1000);
+  ASSERT_EQ(alloc1->base(), base1);
+  // Larger block of another size class
+  alloc2 = pool->allocate(3000);
+  ASSERT_EQ(alloc2->base(), base2);
+  ASSERT_EQ(pool->used_size(), 5120);
+  ASSERT_EQ(pool->num_allocated_blocks(), 2);
+  alloc1.reset();
+
+  // Block more than twice the size class is not used for a small request
+  auto alloc3 = pool->allocate(100);
+  ASSERT_NE(alloc3->base(), base1);
+  ASSERT_EQ(pool->num_allocated_blocks(), 3);
+}
+
+TEST(DynamicMemoryPool, steady_state_runs)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  // Chain of dynamic tensors T1 -> T2 -> T3, where T1 is released after T2 is computed
+  size_t num_allocated_blocks = 0;
+  for (int run = 0; run < 5; ++run)
+  {
+    auto t1 = pool->allocate(1000);
+    auto t2 = pool->allocate(4000);
+    t1.reset();
+    auto t3 = pool->allocate(16000);
+    t2.reset();
+    t3.reset();
+
+    // No block is allocated once the pool is warm
+    if (run >= 2)
+      ASSERT_EQ(pool->num_allocated_blocks(), num_allocated_blocks);
+    num_allocated_blocks = pool->num_allocated_blocks();
+  }
+  ASSERT_LE(num_allocated_blocks, 4);
+  ASSERT_EQ(pool->used_size(), 0);
+}
+
+TEST(DynamicMemoryPool, growing_shapes)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  // Smaller free blocks are freed as the shape grows, so the pool does not keep all of them
+  for (size_t size = 1000; size < 100000; size += 1000)
+  {
+    auto alloc = pool->allocate(size);
+    ASSERT_LE(pool->reserved_size(), 2 * DynamicMemoryPool::sizeClass(size));
+  }
+}
+
+TEST(DynamicMemoryPool, reserve)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  pool->reserve({4000, 4000, 1000});
+  ASSERT_EQ(pool->reserved_size(), 9216);
+  ASSERT_EQ(pool->used_size(), 0);
+  ASSERT_EQ(pool->num_allocated_blocks(), 3);
+
+  // Free blocks serve the same sizes again
+  pool->reserve({4000, 1000});
+  ASSERT_EQ(pool->num_allocated_blocks(), 3);
+
+  // Reserved blocks are used without system memory, and kept by trim()
+  auto alloc1 = pool->allocate(4000);
+  auto alloc2 = pool->allocate(4000);
+  auto alloc3 = pool->allocate(1000);
+  ASSERT_EQ(pool->num_allocated_blocks(), 3);
+  ASSERT_EQ(pool->used_size(), 9216);
+  alloc1.reset();
+  alloc2.reset();
+  alloc3.reset();
+  auto alloc4 = pool->allocate(100);
+  ASSERT_EQ(pool->num_allocated_blocks(), 4);
+  ASSERT_EQ(pool->reserved_size(), 9216 + 112);
+}
+
+TEST(DynamicMemoryPool, reserve_in_use)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+
+  // Blocks in use do not serve the reservation
+  auto alloc = pool->allocate(1000);
+  pool->reserve({1000});
+  ASSERT_EQ(pool->num_allocated_blocks(), 2);
+  ASSERT_EQ(pool->reserved_size(), 2048);
+}
+
+TEST(DynamicMemoryPool, outlive_pool)
+{
+  auto pool = std::make_shared<DynamicMemoryPool>();
+  auto alloc = pool->allocate(100);
+  pool.reset();
+
+  ASSERT_NE(alloc->base(), nullptr);
+  alloc->release();
+  ASSERT_EQ(alloc->base(), nullptr);
+}
+
+TEST(DynamicMemoryManager, allocate_deallocate)
+{
+  DynamicMemoryManager mem_mgr;
+  // Tensors are used only as keys
+  const auto tensor1 = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+  const auto tensor2 = reinterpret_cast<const onert::backend::ITensor *>(0x20);
+
+  // Run twice with the same shapes
+  for (int run = 0; run < 2; ++run)
+  {
+    auto alloc1 = mem_mgr.allocate(tensor1, 256);
+    auto alloc2 = mem_mgr.allocate(tensor2, 512);
+    ASSERT_NE(alloc1->base(), nullptr);
+    ASSERT_NE(alloc2->base(), nullptr);
+    mem_mgr.deallocate(tensor1);
+    mem_mgr.deallocate(tensor2);
+    ASSERT_EQ(mem_mgr.reserved_size(), 768);
+  }
+}
+
+TEST(DynamicMemoryManager, reserve)
+{
+  DynamicMemoryManager mem_mgr;
+  const auto tensor = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+
+  mem_mgr.reserve({1024});
+  ASSERT_EQ(mem_mgr.reserved_size(), 1024);
+  mem_mgr.allocate(tensor, 1000);
+  ASSERT_EQ(mem_mgr.reserved_size(), 1024);
+}
+
+TEST(DynamicMemoryManager, neg_allocate_twice)
+{
+  DynamicMemoryManager mem_mgr;
+  const auto tensor = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+
+  mem_mgr.allocate(tensor, 256);
+  EXPECT_ANY_THROW(mem_mgr.allocate(tensor, 256));
+}
+
+TEST(DynamicMemoryManager, neg_deallocate_unknown)
+{
+  DynamicMemoryManager mem_mgr;
+  const auto tensor = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+
+  EXPECT_ANY_THROW(mem_mgr.deallocate(tensor));
+}
@@ -18,6 +18,7 @@
 
 #include <cassert>
 
+#include "DynamicMemoryPool.h"
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
@@ -72,6 +73,11 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+DynamicMemoryManager::DynamicMemoryManager() : _pool{std::make_shared<DynamicMemoryPool>()}
+{
+  // DO NOTHING
+}
+
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                  uint32_t capacity)
 {
@@ -79,7 +85,7 @@ std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
+  _mem_alloc_map[tensor] = _pool->allocate(capacity);
   return _mem_alloc_map[tensor];
 }
 
@@ -104,6 +110,10 @@ void DynamicMemoryManager::deallocate(void)
   _mem_alloc_map.clear();
 }
 
+void DynamicMemoryManager::reserve(const std::vector<size_t> &sizes) { _pool->reserve(sizes); }
+
+size_t DynamicMemoryManager::reserved_size() const { return _pool->reserved_size(); }
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -39,7 +39,7 @@ public:
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
       tensor_builder{tensor_builder}, kernel_gen{kernel_gen},
-      _external_context(std::make_shared<ExternalContext>())
+      _external_context(std::make_shared<ExternalContext>(this->data().num_workers))
   {
   }
 
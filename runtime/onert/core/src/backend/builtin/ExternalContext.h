@@ -17,6 +17,7 @@
 #ifndef __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 
+#include <exec/WorkerIndex.h>
 #include <util/ConfigSource.h>
 
 #include <ruy/context.h>
@@ -24,7 +25,9 @@
 #include <ruy/ctx.h>
 #include <ruy/tune.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -40,27 +43,43 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(std::make_unique<ruy::Context>())
+  ExternalContext(uint32_t num_workers = 1)
   {
+    for (uint32_t i = 0; i < std::max(num_workers, 1u); ++i)
+      _ruy_contexts.emplace_back(std::make_unique<ruy::Context>());
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::NUM_THREADS));
-    initPerThreadState();
   }
 
   void setMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-      max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads = max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
+    // Workers running at once share the threads
+    const int num_workers = static_cast<int>(_ruy_contexts.size());
+    const int num_threads =
+      num_workers > 1 ? std::max(_max_num_threads / num_workers, 1) : _max_num_threads;
+    for (auto &&context : _ruy_contexts)
+    {
+      context->set_max_num_threads(num_threads);
+      initPerThreadState(context.get());
+    }
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  // ruy::Context is not thread-safe, and kernels of a backend can run on several workers of
+  // ParallelExecutor at once. So each worker has its own context, and other threads use the first.
+  ruy::Context *ruy_context() const
+  {
+    const int worker = exec::workerIndex();
+    if (worker < 0 || worker >= static_cast<int>(_ruy_contexts.size()))
+      return _ruy_contexts.front().get();
+    return _ruy_contexts[worker].get();
+  }
 
 private:
-  void initPerThreadState()
+  static void initPerThreadState(ruy::Context *context)
   {
     // Initialize per-thread state.
-    const int thread_count = _ruy_context->max_num_threads();
-    auto ctx = ruy::get_ctx(_ruy_context.get());
+    const int thread_count = context->max_num_threads();
+    auto ctx = ruy::get_ctx(context);
     ctx->EnsureThreadSpecificResources(thread_count);
     for (int i = 0; i < thread_count; i++)
     {
@@ -69,7 +88,8 @@ private:
   }
 
 private:
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  std::vector<std::unique_ptr<ruy::Context>> _ruy_contexts;
+  int _max_num_threads = kDefaultNumThreadpoolThreads;
 };
 
 } // namespace builtin
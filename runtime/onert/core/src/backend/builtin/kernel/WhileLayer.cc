@@ -22,6 +22,7 @@
 #include <misc/polymorphic_downcast.h>
 
 #include <algorithm>
+#include <array>
 
 namespace onert
 {
@@ -52,13 +53,11 @@ void WhileLayer::run()
   // Copy "_input_tensors" -> "cond subg inputs"
   // Run cond subg
   // Start loop while output of cond subg is ture
-  // // Copy "_input_tensors" -> "body subg inputs" in the first iteration, then copy "body subg
-  // outputs" -> "body subg inputs" in the second or more iterations
-  // // Run body subg
-  // // Copy "body subg outputs" -> "cond subg inputs"
-  // // Run cond subg
-  // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
-  // "_dst_tensors"
+  // // Run body subg with "_input_tensors" in the first iteration, then with "body subg outputs"
+  // of the previous iteration in the second or more iterations
+  // // Run cond subg with "body subg outputs"
+  // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "body subg outputs"
+  // of the last iteration -> "_dst_tensors"
   auto cond_exec = _executors->at(_model_index, _cond_subg_index);
   auto body_exec = _executors->at(_model_index, _body_subg_index);
 
@@ -82,7 +81,6 @@ void WhileLayer::run()
     return ret;
   };
 
-  std::vector<ITensor *> op_inputs(_input_tensors.begin(), _input_tensors.end());
   std::vector<ITensor *> op_outputs(_output_tensors.begin(), _output_tensors.end());
   std::vector<ir::PermuteType> permute_types;
   // Layout in graph is always NHWC, so layout is not changed
@@ -91,61 +89,61 @@ void WhileLayer::run()
   // Copying body inputs to outputs when the loop body is never executed
   if (!getResultCond(cond_output_tensor.get()))
   {
+    std::vector<ITensor *> op_inputs(_input_tensors.begin(), _input_tensors.end());
     PermuteLayer copy_body_inputs_to_op_outputs{op_inputs, op_outputs, permute_types,
                                                 _external_context};
     copy_body_inputs_to_op_outputs.run();
+    _dyn_memory_manager->deallocate(cond_output_tensor.get());
     return;
   }
 
-  // Need some temp tensors to hold the body subgraph output
+  // Need two sets of temp tensors to hold the body subgraph outputs. Body reads the outputs of the
+  // previous iteration from one set and writes to the other, and then the sets are swapped. So
+  // loop-carried tensors are not copied, and they are reallocated only when they grow.
   std::vector<std::unique_ptr<Tensor>> temp_outputs_o;
-  std::vector<IPortableTensor *> temp_outputs;
-  for (uint32_t i = 0; i < body_exec->outputSize(); i++)
+  std::array<std::vector<IPortableTensor *>, 2> temp_outputs;
+  for (auto &&outputs : temp_outputs)
   {
-    auto tensor = std::make_unique<Tensor>(body_exec->outputInfo(i), _dyn_memory_manager);
-    tensor->set_dynamic();
-    tensor->setBuffer(_dyn_memory_manager->allocate(tensor.get(), tensor->total_size()));
-    temp_outputs.push_back(tensor.get());
-    temp_outputs_o.push_back(std::move(tensor));
+    for (uint32_t i = 0; i < body_exec->outputSize(); i++)
+    {
+      auto tensor = std::make_unique<Tensor>(body_exec->outputInfo(i), _dyn_memory_manager);
+      tensor->set_dynamic();
+      tensor->setBuffer(_dyn_memory_manager->allocate(tensor.get(), tensor->total_size()));
+      outputs.push_back(tensor.get());
+      temp_outputs_o.push_back(std::move(tensor));
+    }
   }
 
-  std::vector<ITensor *> body_outputs(temp_outputs.begin(), temp_outputs.end());
-  PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, permute_types,
-                                               _external_context};
-
-  const auto body_execute_with_op_inputs = [&]() {
-    VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_input_tensors, temp_outputs, options);
-    VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
-  };
+  // Loop while Cond subgraph's output is true
+  const std::vector<IPortableTensor *> *body_inputs = &_input_tensors;
+  size_t next = 0;
+  while (getResultCond(cond_output_tensor.get()))
+  {
+    const auto &body_outputs = temp_outputs[next];
 
-  const auto body_execute_with_body_outputs = [&]() {
     VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_output_tensors, temp_outputs, options);
+    body_exec->execute(*body_inputs, body_outputs, options);
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
-  };
 
-  std::function<void()> body_execute = body_execute_with_op_inputs;
-  const auto cond_execute = [&]() {
     VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-    cond_exec->execute(_output_tensors, {cond_output_tensor.get()}, options);
+    cond_exec->execute(body_outputs, {cond_output_tensor.get()}, options);
     VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
-  };
 
-  // Loop while Cond subgraph's output is true
-  while (getResultCond(cond_output_tensor.get()))
-  {
-    body_execute();
-    copy_body_outputs_to_op_outputs.run();
-    cond_execute();
-    body_execute = body_execute_with_body_outputs;
+    body_inputs = &body_outputs;
+    next = 1 - next;
   }
 
+  // Copy the body outputs of the last iteration to op outputs only once
+  std::vector<ITensor *> body_outputs(body_inputs->begin(), body_inputs->end());
+  PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, permute_types,
+                                               _external_context};
+  copy_body_outputs_to_op_outputs.run();
+
   // Clean-up the temp tensors
   _dyn_memory_manager->deallocate(cond_output_tensor.get());
-  for (auto &&tensor : temp_outputs)
+  for (auto &&tensor : temp_outputs_o)
   {
-    _dyn_memory_manager->deallocate(tensor);
+    _dyn_memory_manager->deallocate(tensor.get());
   }
 }
 
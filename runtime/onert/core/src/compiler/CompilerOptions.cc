@@ -78,6 +78,9 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
 {
   auto o = std::make_unique<CompilerOptions>();
   o->backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
+  o->search_order = util::getConfigBool(util::config::SEARCH_ORDER);
+  o->train_recompute_budget = util::getConfigInt(util::config::TRAIN_RECOMPUTE_BUDGET);
+  o->train_num_replicas = util::getConfigInt(util::config::TRAIN_NUM_REPLICAS);
   o->graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   o->executor = util::getConfigString(util::config::EXECUTOR);
   o->he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
@@ -131,6 +134,9 @@ void CompilerOptions::verboseOptions()
   VERBOSE(Compiler) << std::boolalpha << "==== Compiler Options ====" << std::endl;
   VERBOSE(Compiler) << "backend_list             : "
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
+  VERBOSE(Compiler) << "search_order             : " << search_order << std::endl;
+  VERBOSE(Compiler) << "train_recompute_budget   : " << train_recompute_budget << std::endl;
+  VERBOSE(Compiler) << "train_num_replicas       : " << train_num_replicas << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
   VERBOSE(Compiler) << "manual backend_for_all   : " << manual_scheduler_options.backend_for_all
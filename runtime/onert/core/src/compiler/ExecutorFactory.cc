@@ -30,6 +30,7 @@
 #include "../exec/ParallelExecutor.h"
 #include "../exec/train/TrainableExecutor.h"
 #include "../ir/OperationCloner.h"
+#include "train/RecomputePlanner.h"
 
 #include <backend/IPortableTensor.h>
 #include <backend/train/TrainableBackendContext.h>
@@ -38,8 +39,10 @@
 #include <compiler/ExecutionBuilder.h>
 #include <util/TracingCtx.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <unordered_set>
 
 namespace onert
 {
@@ -144,8 +147,10 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 }
 
 backend::BackendContexts
-createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
-                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder)
+createBackendContexts(compiler::ILoweredGraph &lgraph,
+                      const std::vector<ir::OperationIndex> &whole_op_order, bool linear_executor,
+                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder,
+                      uint32_t num_workers = 1)
 {
   backend::BackendContexts contexts;
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
@@ -216,7 +221,6 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
     });
 
   // Create contexts
-  auto whole_op_order = lgraph.graph().topolSortOperations();
   for (auto &&[backend, data] : context_data_map)
   {
     auto graph = data.graph.get();
@@ -241,6 +245,7 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
     std::copy_if(whole_op_order.begin(), whole_op_order.end(), std::back_inserter(op_order),
                  [&](const auto &ind) { return graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
+    data.num_workers = num_workers;
     data.custom_kernel_builder = custom_kernel_builder;
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
@@ -388,8 +393,14 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto custom_kernel_builder = args.custom_kernel_builder;
   auto &graph = lowered_graph->graph();
 
+  // linearize
+  // Backends plan tensors in the same order, so search an order that lowers their peak memory
+  auto order = options->search_order ? Linear::linearizeForMemory(*lowered_graph)
+                                     : Linear::linearize(*lowered_graph);
+  Linear::dump(*lowered_graph, order);
+
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, order, true, custom_kernel_builder);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -398,10 +409,6 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize
-  auto order = Linear::linearize(*lowered_graph);
-  Linear::dump(*lowered_graph, order);
-
   for (auto &&pair : backend_contexts)
   {
     pair.second->genTensors();
@@ -495,6 +502,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
                                        order,
                                        tracing_ctx};
 
+  exec->addObserver(std::make_unique<exec::StatsObserver>(exec->graph()));
   if (!options->workspace_dir.empty())
   {
     exec->addObserver(
@@ -516,8 +524,10 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   const auto tracing_ctx = args.tracing_ctx;
   auto custom_kernel_builder = args.custom_kernel_builder;
 
+  const uint32_t num_workers = parallel ? exec::ParallelExecutor::numWorkers() : 1;
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, lowered_graph->graph().topolSortOperations(), false,
+                          custom_kernel_builder, num_workers);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -583,6 +593,7 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
     exec = dataflow_exec;
   }
 
+  exec->addObserver(std::make_unique<exec::StatsObserver>(exec->graph()));
   if (!options->workspace_dir.empty())
   {
     exec->addObserver(
@@ -657,10 +668,46 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     }
   });
 
+  // linearize for forwarding
+  auto order = Linear::linearize(*lowered_graph);
+  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
+  Linear::dump(*lowered_graph, order);
+
+  // linearize for backwarding
+  auto backward_order = lowered_graph->trainable_graph().essentialBackwardOrder();
+  VERBOSE(ExecutorFactory) << "Linearize for backwarding order" << std::endl;
+  Linear::dump(*lowered_graph, backward_order);
+
+  // Choose segments whose activations are recomputed in backwarding
+  std::vector<std::vector<ir::OperationIndex>> recompute_segments;
+  std::vector<std::vector<ir::OperandIndex>> recompute_activations;
+  if (options->train_recompute_budget >= 0)
+  {
+    const train::RecomputePlanner planner{lowered_graph->trainable_graph(), order, backward_order};
+    const auto segments =
+      planner.plan(static_cast<uint64_t>(options->train_recompute_budget) * 1024);
+    recompute_activations = planner.innerActivations(segments);
+
+    // The last segment is not recomputed since its activations are still alive after forwarding
+    const std::unordered_set<ir::OperationIndex> backward_ops(backward_order.begin(),
+                                                              backward_order.end());
+    for (size_t s = 0; s + 1 < segments.size(); ++s)
+    {
+      const auto &segment = segments[s];
+      if (recompute_activations[s].empty() ||
+          std::none_of(segment.begin(), segment.end(),
+                       [&](const auto &op_index) { return backward_ops.count(op_index) > 0; }))
+        continue;
+      recompute_segments.emplace_back(segment);
+    }
+    VERBOSE(ExecutorFactory) << "Recompute " << recompute_segments.size() << " of "
+                             << segments.size() << " segments in backwarding" << std::endl;
+  }
+
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
   backend::BackendContexts base_backend_contexts =
-    createBackendContexts(*lowered_graph, true, custom_kernel_builder);
+    createBackendContexts(*lowered_graph, order, true, custom_kernel_builder);
 
   // Replace BackendContext with TrainbleBackendContext
   for (auto &&pair : base_backend_contexts)
@@ -720,6 +767,12 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     tdata.custom_kernel_builder = std::move(data.custom_kernel_builder);
     tdata.is_linear_executor = data.is_linear_executor;
     tdata.optim_info = training_info.optimizerInfo();
+    tdata.recompute_segments = recompute_segments;
+    tdata.recompute_activations = recompute_activations;
+    // Gradients of replicas are reduced after backwarding before being applied
+    tdata.keep_gradients = options->train_num_replicas > 1;
+    // Replicas use trainable tensors and optimizer variables of the entry executor
+    tdata.share_trainable_tensors = args.share_trainable_tensors;
 
     // TODO Remove dynamic_cast
     const auto tbackend = dynamic_cast<const backend::train::ITrainableBackend *>(backend);
@@ -739,16 +792,6 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize for forwarding
-  auto order = Linear::linearize(*lowered_graph);
-  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
-  Linear::dump(*lowered_graph, order);
-
-  // linearize for backwarding
-  auto backward_order = lowered_graph->trainable_graph().essentialBackwardOrder();
-  VERBOSE(ExecutorFactory) << "Linearize for backwarding order" << std::endl;
-  Linear::dump(*lowered_graph, backward_order);
-
   train::TrainableCodeMap code_map;
   // Generate tensors and kernels
   for (auto &&[backend, context] : tbackend_contexts)
@@ -876,6 +919,7 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
                                                  std::move(code_map),
                                                  order,
                                                  backward_order,
+                                                 recompute_segments,
                                                  tracing_ctx,
                                                  training_info.lossInfo()};
 
@@ -41,6 +41,8 @@ struct ExecutorFactoryArgs
   const compiler::CompilerOptions *options;
   ir::ModelIndex model_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
+  // Only for training: trainable tensors are shared from the entry executor later
+  bool share_trainable_tensors = false;
 };
 
 class ExecutorFactory
@@ -16,6 +16,7 @@
 
 #include "Linear.h"
 
+#include "OrderSearch.h"
 #include "../dumper/text/GraphDumper.h"
 
 #include "util/logging.h"
@@ -33,6 +34,18 @@ std::vector<ir::OperationIndex> Linear::linearize(const compiler::ILoweredGraph
   return lowered_graph.graph().topolSortOperations();
 }
 
+std::vector<ir::OperationIndex>
+Linear::linearizeForMemory(const compiler::ILoweredGraph &lowered_graph)
+{
+  const auto order = linearize(lowered_graph);
+  const OrderSearch search{lowered_graph.graph()};
+  auto searched = search.search(order);
+
+  VERBOSE(Linearize) << "Peak memory of operands: " << search.peakMemory(order) << " -> "
+                     << search.peakMemory(searched) << " bytes" << std::endl;
+  return searched;
+}
+
 // TODO(easy) Change the LoweredGraph param to Graph
 void Linear::dump(const compiler::ILoweredGraph &lowered_graph,
                   const std::vector<ir::OperationIndex> &order)
@@ -32,6 +32,13 @@ class Linear
 {
 public:
   static std::vector<ir::OperationIndex> linearize(const compiler::ILoweredGraph &lowered_graph);
+  /**
+   * @brief Linearize in an order searched to lower peak memory of operands
+   *
+   * The topological order of linearize() is kept if no order has lower peak memory.
+   */
+  static std::vector<ir::OperationIndex>
+  linearizeForMemory(const compiler::ILoweredGraph &lowered_graph);
   static void dump(const compiler::ILoweredGraph &lowered_graph,
                    const std::vector<ir::OperationIndex> &order);
 };
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OrderSearch.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace onert
+{
+namespace compiler
+{
+
+namespace
+{
+
+// Upper bound of work of a search, to keep compilation time of large graphs reasonable
+constexpr uint64_t kMaxWork = 1ull << 26;
+
+/**
+ * @brief Operations and counted operands of a graph as positions in a given order
+ */
+struct Problem
+{
+  Problem(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order)
+  {
+    std::unordered_map<ir::OperationIndex, uint32_t> positions;
+    for (uint32_t pos = 0; pos < order.size(); ++pos)
+      positions.emplace(order[pos], pos);
+    if (positions.size() != graph.operations().size())
+      throw std::runtime_error{"OrderSearch: Order does not have all operations"};
+
+    std::unordered_map<ir::OperandIndex, uint32_t> tensors;
+    auto tensor = [&](const ir::OperandIndex &index) -> int64_t {
+      const auto &operand = graph.operands().at(index);
+      if (operand.isConstant() || operand.info().isDynamic() ||
+          graph.getInputs().contains(index) || graph.getOutputs().contains(index))
+        return -1;
+
+      auto it = tensors.find(index);
+      if (it == tensors.end())
+      {
+        it = tensors.emplace(index, sizes.size()).first;
+        sizes.emplace_back(operand.info().total_size());
+        uses.emplace_back(0);
+        defined.emplace_back(false);
+      }
+      return it->second;
+    };
+
+    preds.resize(order.size());
+    succs.resize(order.size());
+    inputs.resize(order.size());
+    outputs.resize(order.size());
+    for (uint32_t pos = 0; pos < order.size(); ++pos)
+    {
+      const auto &op = graph.operations().at(order[pos]);
+      for (const auto &index : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      {
+        const auto &def = graph.operands().at(index).getDef();
+        if (def.valid())
+        {
+          const auto pred = positions.at(def);
+          if (std::find(preds[pos].begin(), preds[pos].end(), pred) == preds[pos].end())
+          {
+            preds[pos].emplace_back(pred);
+            succs[pred].emplace_back(pos);
+          }
+        }
+
+        const auto t = tensor(index);
+        if (t >= 0)
+        {
+          inputs[pos].emplace_back(t);
+          uses[t]++;
+        }
+      }
+
+      for (const auto &index : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      {
+        const auto t = tensor(index);
+        if (t >= 0)
+        {
+          outputs[pos].emplace_back(t);
+          defined[t] = true;
+        }
+      }
+    }
+  }
+
+  // Memory alive before any operation runs
+  uint64_t initialLive() const
+  {
+    uint64_t live = 0;
+    for (size_t t = 0; t < sizes.size(); ++t)
+    {
+      if (!defined[t])
+        live += sizes[t];
+    }
+    return live;
+  }
+
+  std::vector<std::vector<uint32_t>> preds;
+  std::vector<std::vector<uint32_t>> succs;
+  std::vector<std::vector<uint32_t>> inputs;
+  std::vector<std::vector<uint32_t>> outputs;
+  std::vector<uint64_t> sizes;
+  std::vector<uint32_t> uses;
+  std::vector<bool> defined;
+};
+
+struct State
+{
+  // Remaining uses of each tensor
+  std::vector<uint32_t> remaining_uses;
+  // Number of predecessors not run yet of each operation, or UINT32_MAX if it has run
+  std::vector<uint32_t> missing_preds;
+  // Operations whose predecessors have all run
+  std::vector<uint32_t> ready;
+  uint64_t live = 0;
+  uint64_t peak = 0;
+  uint64_t hash = 0;
+  std::vector<uint32_t> order;
+};
+
+struct Candidate
+{
+  uint64_t peak;
+  uint64_t live;
+  uint32_t pos;
+  size_t state;
+  uint64_t hash;
+
+  bool operator<(const Candidate &other) const
+  {
+    if (peak != other.peak)
+      return peak < other.peak;
+    if (live != other.live)
+      return live < other.live;
+    if (state != other.state)
+      return state < other.state;
+    return pos < other.pos;
+  }
+};
+
+constexpr uint32_t kDone = std::numeric_limits<uint32_t>::max();
+
+// Memory after running an operation at pos and the peak while running it
+std::pair<uint64_t, uint64_t> evaluate(const Problem &problem, const State &state, uint32_t pos)
+{
+  uint64_t live = state.live;
+  for (const auto t : problem.outputs[pos])
+    live += problem.sizes[t];
+  const uint64_t peak = std::max(state.peak, live);
+
+  for (const auto t : problem.inputs[pos])
+  {
+    if (state.remaining_uses[t] == 1)
+      live -= problem.sizes[t];
+  }
+  for (const auto t : problem.outputs[pos])
+  {
+    if (problem.uses[t] == 0)
+      live -= problem.sizes[t];
+  }
+  return {live, peak};
+}
+
+void run(const Problem &problem, State &state, uint32_t pos)
+{
+  const auto [live, peak] = evaluate(problem, state, pos);
+  state.live = live;
+  state.peak = peak;
+  for (const auto t : problem.inputs[pos])
+    state.remaining_uses[t]--;
+  for (const auto succ : problem.succs[pos])
+  {
+    if (--state.missing_preds[succ] == 0)
+      state.ready.emplace_back(succ);
+  }
+  state.missing_preds[pos] = kDone;
+  state.order.emplace_back(pos);
+
+  auto it = std::find(state.ready.begin(), state.ready.end(), pos);
+  if (it != state.ready.end())
+  {
+    *it = state.ready.back();
+    state.ready.pop_back();
+  }
+}
+
+State initialState(const Problem &problem)
+{
+  State state;
+  state.remaining_uses = problem.uses;
+  for (uint32_t pos = 0; pos < problem.preds.size(); ++pos)
+  {
+    state.missing_preds.emplace_back(problem.preds[pos].size());
+    if (problem.preds[pos].empty())
+      state.ready.emplace_back(pos);
+  }
+  state.live = problem.initialLive();
+  state.peak = state.live;
+  return state;
+}
+
+} // namespace
+
+OrderSearch::OrderSearch(const ir::Graph &graph, uint32_t beam_width)
+  : _graph{graph}, _beam_width{std::max(beam_width, 1u)}
+{
+}
+
+uint64_t OrderSearch::peakMemory(const std::vector<ir::OperationIndex> &order) const
+{
+  const Problem problem{_graph, order};
+  auto state = initialState(problem);
+  for (uint32_t pos = 0; pos < order.size(); ++pos)
+  {
+    if (state.missing_preds[pos] != 0)
+      throw std::runtime_error{"OrderSearch: Order is not topological"};
+    run(problem, state, pos);
+  }
+  return state.peak;
+}
+
+std::vector<ir::OperationIndex>
+OrderSearch::search(const std::vector<ir::OperationIndex> &order) const
+{
+  const Problem problem{_graph, order};
+  const uint64_t num_ops = order.size();
+  if (num_ops == 0)
+    return order;
+
+  // Each step copies states of size about (operations + tensors)
+  const uint64_t state_size = num_ops + problem.sizes.size();
+  const auto beam_width = static_cast<size_t>(
+    std::max<uint64_t>(1, std::min<uint64_t>(_beam_width, kMaxWork / (num_ops * state_size))));
+
+  // Hash of the set of operations that have run, to drop duplicated partial orders
+  std::mt19937_64 random{0};
+  std::vector<uint64_t> keys(num_ops);
+  for (auto &&key : keys)
+    key = random();
+
+  std::vector<State> beam{initialState(problem)};
+  for (uint64_t step = 0; step < num_ops; ++step)
+  {
+    std::vector<Candidate> candidates;
+    for (size_t s = 0; s < beam.size(); ++s)
+    {
+      const auto &state = beam[s];
+      for (const auto pos : state.ready)
+      {
+        const auto [live, peak] = evaluate(problem, state, pos);
+        candidates.push_back({peak, live, pos, s, state.hash ^ keys[pos]});
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<State> next;
+    std::unordered_set<uint64_t> hashes;
+    for (const auto &candidate : candidates)
+    {
+      if (next.size() == beam_width)
+        break;
+      if (!hashes.insert(candidate.hash).second)
+        continue;
+
+      next.emplace_back(beam[candidate.state]);
+      run(problem, next.back(), candidate.pos);
+      next.back().hash = candidate.hash;
+    }
+    beam = std::move(next);
+  }
+
+  // States are sorted by peak memory
+  const auto &best = beam.front();
+  const auto initial_peak = peakMemory(order);
+  if (best.peak >= initial_peak)
+    return order;
+
+  std::vector<ir::OperationIndex> searched;
+  for (const auto pos : best.order)
+    searched.emplace_back(order[pos]);
+  return searched;
+}
+
+} // namespace compiler
+} // namespace onert
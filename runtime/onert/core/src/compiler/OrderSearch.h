@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_ORDER_SEARCH_H__
+#define __ONERT_COMPILER_ORDER_SEARCH_H__
+
+#include "ir/Graph.h"
+#include "ir/Index.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to search an operation order with low peak memory of operands
+ *
+ * An operand is alive from when its defining operation starts until the last operation using it
+ * ends. Constants and model inputs/outputs are not counted since they are not planned by
+ * backends. Beam search is run over the sets of operations that are ready to run, keeping the
+ * partial orders with the lowest peak and current memory at each step.
+ */
+class OrderSearch
+{
+public:
+  /**
+   * @param graph      Graph whose operations are ordered
+   * @param beam_width Number of partial orders kept at each step
+   */
+  OrderSearch(const ir::Graph &graph, uint32_t beam_width = 8);
+
+public:
+  /**
+   * @brief     Search an order of operations
+   * @param[in] order Topological order of all operations, used to break ties
+   * @return    Searched order, or @c order itself if no order has lower peak memory
+   */
+  std::vector<ir::OperationIndex> search(const std::vector<ir::OperationIndex> &order) const;
+
+  /**
+   * @brief Get peak memory of operands in bytes when operations run in the given order
+   */
+  uint64_t peakMemory(const std::vector<ir::OperationIndex> &order) const;
+
+private:
+  const ir::Graph &_graph;
+  uint32_t _beam_width;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_ORDER_SEARCH_H__
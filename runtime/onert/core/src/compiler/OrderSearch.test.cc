@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OrderSearch.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace onert::ir;
+using namespace onert::compiler;
+
+namespace
+{
+
+/**
+ * @brief Two branches that define a large operand and reduce it to a small one
+ *
+ *          -[EA]-> (large 0) -[EA]-> (small 0)
+ *         /                                   \
+ * (input)                                      [Add] -> (output)
+ *         \                                   /
+ *          -[EA]-> (large 1) -[EA]-> (small 1)
+ */
+class Branches
+{
+public:
+  Branches()
+  {
+    TypeInfo type{DataType::FLOAT32};
+    Shape large_shape{1, 10, 10, 1};
+    Shape small_shape{1, 1, 1, 1};
+
+    auto input = graph.addOperand(small_shape, type);
+    auto output = graph.addOperand(small_shape, type);
+    graph.addInput(input);
+    graph.addOutput(output);
+
+    OperandIndex smalls[2];
+    for (int b = 0; b < 2; ++b)
+    {
+      auto large = graph.addOperand(large_shape, type);
+      smalls[b] = graph.addOperand(small_shape, type);
+      large_ops[b] = addActivation(input, large);
+      small_ops[b] = addActivation(large, smalls[b]);
+    }
+
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = Activation::NONE;
+    add_op = graph.addOperation(
+      std::make_unique<operation::BinaryArithmetic>(OperandIndexSequence{smalls[0], smalls[1]},
+                                                    OperandIndexSequence{output}, param));
+  }
+
+  OperationIndex addActivation(OperandIndex input, OperandIndex output)
+  {
+    operation::ElementwiseActivation::Param param;
+    param.op_type = operation::ElementwiseActivation::Type::RELU;
+    return graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+      OperandIndexSequence{input}, OperandIndexSequence{output}, param));
+  }
+
+public:
+  Graph graph;
+  OperationIndex large_ops[2];
+  OperationIndex small_ops[2];
+  OperationIndex add_op;
+};
+
+constexpr uint64_t kLargeSize = 400;
+constexpr uint64_t kSmallSize = 4;
+
+bool isTopological(const Graph &graph, const std::vector<OperationIndex> &order)
+{
+  std::vector<OperationIndex> done;
+  for (const auto &index : order)
+  {
+    for (const auto &input : graph.operations().at(index).getInputs())
+    {
+      const auto &def = graph.operands().at(input).getDef();
+      if (def.valid() && std::find(done.begin(), done.end(), def) == done.end())
+        return false;
+    }
+    done.emplace_back(index);
+  }
+  return done.size() == graph.operations().size();
+}
+
+} // namespace
+
+TEST(OrderSearch, peak_memory)
+{
+  Branches branches;
+  OrderSearch search{branches.graph};
+
+  // Both large operands are alive while the second small operand is defined
+  std::vector<OperationIndex> breadth_first{branches.large_ops[0], branches.large_ops[1],
+                                            branches.small_ops[0], branches.small_ops[1],
+                                            branches.add_op};
+  EXPECT_EQ(search.peakMemory(breadth_first), 2 * kLargeSize + kSmallSize);
+
+  std::vector<OperationIndex> depth_first{branches.large_ops[0], branches.small_ops[0],
+                                          branches.large_ops[1], branches.small_ops[1],
+                                          branches.add_op};
+  EXPECT_EQ(search.peakMemory(depth_first), kLargeSize + 2 * kSmallSize);
+}
+
+TEST(OrderSearch, search_lower_peak)
+{
+  Branches branches;
+  OrderSearch search{branches.graph};
+
+  std::vector<OperationIndex> breadth_first{branches.large_ops[0], branches.large_ops[1],
+                                            branches.small_ops[0], branches.small_ops[1],
+                                            branches.add_op};
+  const auto order = search.search(breadth_first);
+  EXPECT_TRUE(isTopological(branches.graph, order));
+  EXPECT_EQ(search.peakMemory(order), kLargeSize + 2 * kSmallSize);
+
+  // Greedy search with the narrowest beam finds it too
+  OrderSearch greedy{branches.graph, 1};
+  EXPECT_EQ(greedy.peakMemory(greedy.search(breadth_first)), kLargeSize + 2 * kSmallSize);
+}
+
+TEST(OrderSearch, keep_best_order)
+{
+  Branches branches;
+  OrderSearch search{branches.graph};
+
+  const auto topol = branches.graph.topolSortOperations();
+  const auto order = search.search(topol);
+  EXPECT_LE(search.peakMemory(order), search.peakMemory(topol));
+  if (search.peakMemory(order) == search.peakMemory(topol))
+    EXPECT_EQ(order, topol);
+}
+
+TEST(OrderSearch, neg_invalid_order)
+{
+  Branches branches;
+  OrderSearch search{branches.graph};
+
+  std::vector<OperationIndex> not_topological{branches.small_ops[0], branches.large_ops[0],
+                                              branches.large_ops[1], branches.small_ops[1],
+                                              branches.add_op};
+  EXPECT_ANY_THROW(search.peakMemory(not_topological));
+
+  std::vector<OperationIndex> missing{branches.large_ops[0], branches.small_ops[0]};
+  EXPECT_ANY_THROW(search.search(missing));
+}
@@ -245,6 +245,39 @@ void ShapeValidator::visit(const ir::operation::InstanceNorm &node)
   OP_REQUIRES(operands.at(beta_index).shape().rank() == 1);
 }
 
+void ShapeValidator::visit(const ir::operation::RmsNorm &node)
+{
+  const auto &operands = _graph.operands();
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (operands.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::RmsNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::RmsNorm::Input::BETA)};
+
+  OP_REQUIRES(operands.at(ifm_index).shape() == operands.at(ofm_index).shape());
+  OP_REQUIRES(operands.at(gamma_index).shape().rank() == 1);
+  OP_REQUIRES(operands.at(beta_index).shape().rank() == 1);
+}
+
+void ShapeValidator::visit(const ir::operation::RoPE &node)
+{
+  const auto &operands = _graph.operands();
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (operands.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::RoPE::Input::INPUT)};
+  const auto sin_index{node.getInputs().at(ir::operation::RoPE::Input::SIN_TABLE)};
+  const auto cos_index{node.getInputs().at(ir::operation::RoPE::Input::COS_TABLE)};
+
+  const auto &ifm_shape = operands.at(ifm_index).shape();
+  OP_REQUIRES(ifm_shape == operands.at(ofm_index).shape());
+  OP_REQUIRES(ifm_shape.dim(ifm_shape.rank() - 1) % 2 == 0);
+  OP_REQUIRES(operands.at(sin_index).shape() == operands.at(cos_index).shape());
+}
+
 void ShapeValidator::visit(const ir::operation::Pool2D &node)
 {
   const auto &operands = _graph.operands();
@@ -63,7 +63,9 @@ public:
   void visit(const ir::operation::Pool2D &node) override;
   void visit(const ir::operation::Reduce &node) override;
   void visit(const ir::operation::Transpose &node) override;
+  void visit(const ir::operation::RmsNorm &node) override;
   void visit(const ir::operation::RNN &node) override;
+  void visit(const ir::operation::RoPE &node) override;
   void visit(const ir::operation::SpaceToBatchND &node) override;
   void visit(const ir::operation::SpaceToDepth &node) override;
   void visit(const ir::operation::ElementwiseActivation &node) override;
@@ -1057,6 +1057,16 @@ void StaticShapeInferer::visit(const ir::operation::Reverse &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::RmsNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::RmsNorm::Input::INPUT));
+}
+
+void StaticShapeInferer::visit(const ir::operation::RoPE &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::RoPE::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::Select &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputePlanner.h"
+
+#include "util/logging.h"
+#include "util/Set.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+RecomputePlanner::RecomputePlanner(const ir::train::TrainableGraph &tgraph,
+                                   const std::vector<ir::OperationIndex> &forward_order,
+                                   const std::vector<ir::OperationIndex> &backward_order)
+  : _tgraph{tgraph}, _forward_order{forward_order}, _backward_order{backward_order}
+{
+  // DO NOTHING
+}
+
+RecomputePlanner::Segments RecomputePlanner::plan(uint64_t budget) const
+{
+  if (_forward_order.empty())
+    return {};
+
+  uint64_t total_size = 0;
+  for (const auto &op_index : _forward_order)
+  {
+    const auto &op = _tgraph.operation(op_index);
+    for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+      total_size += activationSize(output);
+  }
+
+  // Try to halve capacity of segments until each operation becomes a segment
+  Segments best;
+  uint64_t best_estimate = std::numeric_limits<uint64_t>::max();
+  size_t prev_count = 0;
+  for (uint64_t capacity = std::max<uint64_t>(total_size, 1);; capacity /= 2)
+  {
+    auto segments = mergeForBackward(split(capacity));
+    if (segments.size() != prev_count)
+    {
+      prev_count = segments.size();
+      const auto segments_estimate = estimate(segments);
+      VERBOSE(RecomputePlanner) << segments.size() << " segments : " << segments_estimate
+                                << " bytes" << std::endl;
+      if (budget != 0 && segments_estimate <= budget)
+      {
+        best = std::move(segments);
+        best_estimate = segments_estimate;
+        break;
+      }
+      if (segments_estimate < best_estimate)
+      {
+        best = std::move(segments);
+        best_estimate = segments_estimate;
+      }
+    }
+    if (capacity <= 1 || prev_count == _forward_order.size())
+      break;
+  }
+
+  if (budget != 0 && best_estimate > budget)
+    VERBOSE(RecomputePlanner) << "Activations do not fit in the budget " << budget << " bytes"
+                              << std::endl;
+
+  // A single segment is the same as keeping all activations
+  if (best.size() <= 1)
+    return {};
+  return best;
+}
+
+uint64_t RecomputePlanner::estimate(const Segments &segments) const
+{
+  const auto inner_activations = innerActivations(segments);
+
+  util::Set<ir::OperandIndex> inner_set;
+  uint64_t max_inner_size = 0;
+  for (const auto &activations : inner_activations)
+  {
+    uint64_t inner_size = 0;
+    for (const auto &index : activations)
+    {
+      inner_size += activationSize(index);
+      inner_set.add(index);
+    }
+    max_inner_size = std::max(max_inner_size, inner_size);
+  }
+
+  uint64_t kept_size = 0;
+  _tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &) {
+    if (!inner_set.contains(index))
+      kept_size += activationSize(index);
+  });
+
+  return kept_size + max_inner_size;
+}
+
+RecomputePlanner::Activations RecomputePlanner::innerActivations(const Segments &segments) const
+{
+  std::unordered_map<ir::OperationIndex, size_t> segment_of;
+  for (size_t s = 0; s < segments.size(); ++s)
+    for (const auto &op_index : segments[s])
+      segment_of[op_index] = s;
+
+  Activations activations(segments.size());
+  _tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (activationSize(index) == 0)
+      return;
+
+    const auto def_it = segment_of.find(operand.getDef());
+    bool is_inner = def_it != segment_of.end() && operand.getUses().size() != 0 &&
+                    !_tgraph.getOutputs().contains(index);
+    for (const auto &use : operand.getUses())
+    {
+      if (!is_inner)
+        break;
+      const auto use_it = segment_of.find(use);
+      is_inner = use_it != segment_of.end() && use_it->second == def_it->second;
+    }
+
+    if (is_inner)
+      activations[def_it->second].emplace_back(index);
+  });
+  return activations;
+}
+
+RecomputePlanner::Segments RecomputePlanner::split(uint64_t capacity) const
+{
+  Segments segments(1);
+  uint64_t size = 0;
+  for (const auto &op_index : _forward_order)
+  {
+    const auto &op = _tgraph.operation(op_index);
+    uint64_t op_size = 0;
+    for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+      op_size += activationSize(output);
+
+    if (!segments.back().empty() && size + op_size > capacity)
+    {
+      segments.emplace_back();
+      size = 0;
+    }
+    segments.back().emplace_back(op_index);
+    size += op_size;
+  }
+  return segments;
+}
+
+RecomputePlanner::Segments RecomputePlanner::mergeForBackward(Segments segments) const
+{
+  // Segments should appear in reverse order in backwarding, e.g. a segment cannot be revisited
+  // after backwarding its previous segment. Merge all segments between such two segments.
+  bool merged = true;
+  while (merged)
+  {
+    merged = false;
+
+    std::unordered_map<ir::OperationIndex, size_t> segment_of;
+    for (size_t s = 0; s < segments.size(); ++s)
+      for (const auto &op_index : segments[s])
+        segment_of[op_index] = s;
+
+    size_t prev = std::numeric_limits<size_t>::max();
+    for (const auto &op_index : _backward_order)
+    {
+      const auto it = segment_of.find(op_index);
+      if (it == segment_of.end())
+        continue;
+
+      const auto cur = it->second;
+      if (prev != std::numeric_limits<size_t>::max() && cur > prev)
+      {
+        for (size_t s = prev + 1; s <= cur; ++s)
+          segments[prev].insert(segments[prev].end(), segments[s].begin(), segments[s].end());
+        segments.erase(segments.begin() + prev + 1, segments.begin() + cur + 1);
+        merged = true;
+        break;
+      }
+      prev = cur;
+    }
+  }
+  return segments;
+}
+
+uint64_t RecomputePlanner::activationSize(const ir::OperandIndex &index) const
+{
+  const auto &operand = _tgraph.operands().at(index);
+  if (operand.isConstant() || _tgraph.getInputs().contains(index))
+    return 0;
+  return operand.info().total_size();
+}
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_TRAIN_RECOMPUTE_PLANNER_H__
+#define __ONERT_COMPILER_TRAIN_RECOMPUTE_PLANNER_H__
+
+#include "ir/train/TrainableGraph.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+/**
+ * @brief Class to split forward order into segments for activation recomputation
+ *
+ * Activations used only inside a segment are not kept until backwarding. Instead, the segment is
+ * run again from the activations kept at its boundary just before its backwarding. So only one
+ * segment holds its inner activations at a time.
+ */
+class RecomputePlanner
+{
+public:
+  using Segments = std::vector<std::vector<ir::OperationIndex>>;
+  using Activations = std::vector<std::vector<ir::OperandIndex>>;
+
+public:
+  /**
+   * @param tgraph         Trainable graph
+   * @param forward_order  Order of operations run in forwarding
+   * @param backward_order Order of operations run in backwarding
+   */
+  RecomputePlanner(const ir::train::TrainableGraph &tgraph,
+                   const std::vector<ir::OperationIndex> &forward_order,
+                   const std::vector<ir::OperationIndex> &backward_order);
+
+public:
+  /**
+   * @brief Choose segments against activation memory budget
+   *
+   * The fewest segments estimated to fit in the budget are chosen. If no segments fit or budget is
+   * 0, segments with the least estimated memory are chosen.
+   *
+   * @param budget Budget of activation memory in bytes, or 0 to minimize memory
+   * @return Segments in forward order, or empty if recomputation does not reduce memory
+   */
+  Segments plan(uint64_t budget) const;
+
+  /**
+   * @brief Estimate peak memory of activations, which is the sum of activations kept until
+   *        backwarding and the largest sum of activations inside a segment
+   */
+  uint64_t estimate(const Segments &segments) const;
+
+  /**
+   * @brief Get activations defined and used only inside each segment
+   *
+   * @return Activations of each segment, in the same order as segments
+   */
+  Activations innerActivations(const Segments &segments) const;
+
+private:
+  // Split forward order so that activations defined in a segment do not exceed capacity
+  Segments split(uint64_t capacity) const;
+  // Merge segments so that each segment runs contiguously in backwarding
+  Segments mergeForBackward(Segments segments) const;
+  uint64_t activationSize(const ir::OperandIndex &index) const;
+
+private:
+  const ir::train::TrainableGraph &_tgraph;
+  const std::vector<ir::OperationIndex> &_forward_order;
+  const std::vector<ir::OperationIndex> &_backward_order;
+};
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_TRAIN_RECOMPUTE_PLANNER_H__
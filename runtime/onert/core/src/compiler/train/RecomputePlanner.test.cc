@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputePlanner.h"
+
+#include "ir/train/operation/ElementwiseActivation.h"
+#include "ir/train/operation/Loss.h"
+#include "ir/train/LossInfo.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+using namespace onert::compiler::train;
+
+namespace
+{
+
+/**
+ * @brief Chain of ElementwiseActivation operations followed by Loss
+ *
+ * (input) -[EA]-> (act 0) -[EA]-> ... -[EA]-> (act N-1) -[Loss]-> (output)
+ *                                                       /
+ *                                               (y_true)
+ */
+class RecomputeChain
+{
+public:
+  explicit RecomputeChain(int num_activations)
+  {
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+
+    auto input = tgraph.addOperand(shape, type);
+    auto y_true = tgraph.addOperand(shape, type);
+    auto output = tgraph.addOperand(shape, type);
+    tgraph.addInput(input);
+    tgraph.addInput(y_true);
+    tgraph.addOutput(output);
+
+    auto prev = input;
+    for (int i = 0; i < num_activations; ++i)
+    {
+      auto act = tgraph.addOperand(shape, type);
+      operation::ElementwiseActivation::Param param;
+      auto ea_op = operation::ElementwiseActivation({prev}, {act}, param);
+      forward_order.emplace_back(
+        tgraph.addOperation(std::make_unique<train::operation::ElementwiseActivation>(ea_op)));
+      prev = act;
+    }
+
+    auto loss_op = operation::Loss({prev, y_true}, {output});
+    forward_order.emplace_back(
+      tgraph.addOperation(std::make_unique<train::operation::Loss>(loss_op, train::LossInfo{})));
+
+    backward_order.assign(forward_order.rbegin(), forward_order.rend());
+  }
+
+public:
+  train::TrainableGraph tgraph;
+  std::vector<OperationIndex> forward_order;
+  std::vector<OperationIndex> backward_order;
+};
+
+// Size of each activation in bytes
+constexpr uint64_t kActSize = 16;
+
+void verifySegments(const RecomputePlanner::Segments &segments,
+                    const std::vector<OperationIndex> &forward_order)
+{
+  std::vector<OperationIndex> ops;
+  for (const auto &segment : segments)
+  {
+    EXPECT_FALSE(segment.empty());
+    ops.insert(ops.end(), segment.begin(), segment.end());
+  }
+  EXPECT_EQ(ops, forward_order);
+}
+
+} // namespace
+
+TEST(RecomputePlanner, estimate)
+{
+  RecomputeChain chain(4);
+  RecomputePlanner planner{chain.tgraph, chain.forward_order, chain.backward_order};
+  const auto &ops = chain.forward_order;
+
+  // All activations are kept
+  EXPECT_EQ(planner.estimate({{ops[0]}, {ops[1]}, {ops[2]}, {ops[3]}, {ops[4]}}), 5 * kActSize);
+
+  // act 0 and act 2 are inner activations of each segment
+  EXPECT_EQ(planner.estimate({{ops[0], ops[1]}, {ops[2], ops[3]}, {ops[4]}}),
+            3 * kActSize + kActSize);
+
+  // act 0, 1 and 3 are inner activations of the first segment
+  EXPECT_EQ(planner.estimate({{ops[0], ops[1], ops[2]}, {ops[3], ops[4]}}),
+            2 * kActSize + 2 * kActSize);
+}
+
+TEST(RecomputePlanner, innerActivations)
+{
+  RecomputeChain chain(4);
+  RecomputePlanner planner{chain.tgraph, chain.forward_order, chain.backward_order};
+  const auto &ops = chain.forward_order;
+
+  const auto activations = planner.innerActivations({{ops[0], ops[1], ops[2]}, {ops[3], ops[4]}});
+  ASSERT_EQ(activations.size(), 2);
+  // act 0 and act 1
+  EXPECT_EQ(activations[0].size(), 2);
+  for (const auto &index : activations[0])
+  {
+    const auto def = chain.tgraph.operands().at(index).getDef();
+    EXPECT_TRUE(def == ops[0] || def == ops[1]);
+  }
+  // act 3 is used by Loss in the same segment
+  ASSERT_EQ(activations[1].size(), 1);
+  EXPECT_EQ(chain.tgraph.operands().at(activations[1][0]).getDef(), ops[3]);
+}
+
+TEST(RecomputePlanner, plan_minimize)
+{
+  RecomputeChain chain(16);
+  RecomputePlanner planner{chain.tgraph, chain.forward_order, chain.backward_order};
+
+  const auto segments = planner.plan(0);
+  ASSERT_GT(segments.size(), 1);
+  verifySegments(segments, chain.forward_order);
+
+  const auto all_kept = planner.estimate({chain.forward_order});
+  EXPECT_EQ(all_kept, 17 * kActSize);
+  EXPECT_LT(planner.estimate(segments), all_kept / 2);
+}
+
+TEST(RecomputePlanner, plan_budget)
+{
+  RecomputeChain chain(16);
+  RecomputePlanner planner{chain.tgraph, chain.forward_order, chain.backward_order};
+
+  // Everything fits, no need to recompute
+  EXPECT_TRUE(planner.plan(17 * kActSize).empty());
+
+  const auto min_segments = planner.plan(0);
+  const auto min_estimate = planner.estimate(min_segments);
+
+  // Budget between the minimum and keeping all activations
+  const uint64_t budget = 12 * kActSize;
+  ASSERT_LT(min_estimate, budget);
+  const auto segments = planner.plan(budget);
+  ASSERT_GT(segments.size(), 1);
+  verifySegments(segments, chain.forward_order);
+  EXPECT_LE(planner.estimate(segments), budget);
+  EXPECT_LE(segments.size(), min_segments.size());
+}
+
+TEST(RecomputePlanner, plan_backward_contiguous)
+{
+  RecomputeChain chain(8);
+  // Backwarding of op 3 comes between ops 5 and 4
+  const auto &ops = chain.forward_order;
+  std::vector<OperationIndex> backward_order{ops[8], ops[7], ops[6], ops[5], ops[3],
+                                             ops[4], ops[2], ops[1], ops[0]};
+  RecomputePlanner planner{chain.tgraph, chain.forward_order, backward_order};
+
+  const auto segments = planner.plan(0);
+  ASSERT_GT(segments.size(), 1);
+  verifySegments(segments, chain.forward_order);
+
+  // ops 3, 4 and 5 should be in the same segment
+  for (const auto &segment : segments)
+  {
+    const auto count = std::count_if(segment.begin(), segment.end(), [&](const auto &op) {
+      return op == ops[3] || op == ops[4] || op == ops[5];
+    });
+    EXPECT_TRUE(count == 0 || count == 3);
+  }
+}
+
+TEST(RecomputePlanner, neg_plan_over_budget)
+{
+  RecomputeChain chain(8);
+  RecomputePlanner planner{chain.tgraph, chain.forward_order, chain.backward_order};
+
+  // The budget cannot be met, choose the least memory anyway
+  const auto segments = planner.plan(1);
+  EXPECT_EQ(segments, planner.plan(0));
+}
+
+TEST(RecomputePlanner, neg_plan_empty)
+{
+  train::TrainableGraph tgraph;
+  std::vector<OperationIndex> order;
+  RecomputePlanner planner{tgraph, order, order};
+
+  EXPECT_TRUE(planner.plan(0).empty());
+  EXPECT_EQ(planner.estimate({}), 0);
+}
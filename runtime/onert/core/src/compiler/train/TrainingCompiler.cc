@@ -38,6 +38,8 @@
 #include <misc/polymorphic_downcast.h>
 #include <misc/string_helpers.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace compiler
@@ -56,6 +58,114 @@ TrainingCompiler::TrainingCompiler(const std::shared_ptr<ir::NNPkg> &nnpkg, Comp
     throw std::runtime_error("TrainingCompiler does not support multiple subgraphs yet");
 }
 
+void TrainingCompiler::createExecutors(
+  const std::unordered_map<ir::SubgraphIndex, std::shared_ptr<ir::train::TrainableGraph>>
+    &trainable_subgraphs,
+  const std::shared_ptr<exec::train::TrainableExecutors> &executors,
+  util::TracingCtx *tracing_ctx,
+  const std::shared_ptr<backend::custom::IKernelBuilder> &custom_kernel_builder,
+  dumper::dot::DotDumper &dot_dumper, bool replica)
+{
+  // Lower: Assign backend
+  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::train::LoweredTrainableGraph>>
+    lowered_subgs;
+  {
+    for (auto &&[subg_index, trainable_subg] : trainable_subgraphs)
+    {
+      // Lower: Assign backend
+      lowered_subgs[subg_index] =
+        std::make_unique<compiler::train::LoweredTrainableGraph>(*trainable_subg, *_options);
+      // Set tracing_ctx for copied graph
+      tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
+    }
+  }
+
+  for (const auto &[subg_index, lowered_subg] : lowered_subgs)
+  {
+    dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
+  }
+
+  // Set operands' info for back propagation as default tensor info
+  for (const auto &pair : lowered_subgs)
+  {
+    auto lowered_subg = pair.second.get();
+    auto &tgraph = lowered_subg->trainable_graph();
+    tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
+      if (!obj.isConstant())
+      {
+        auto bwd_operand = std::make_unique<ir::Operand>(obj);
+        const auto gen_index = tgraph.addBackwardOperand(index, std::move(bwd_operand));
+        assert(gen_index == index);
+        UNUSED_RELEASE(gen_index);
+      }
+    });
+  }
+
+  // Shape inference.
+  {
+    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
+    // recursively
+    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
+      createStaticShapeInferers(lowered_subgs);
+
+    const auto primary_subg_idx = ir::SubgraphIndex{0};
+    inferers.at(primary_subg_idx)->infer();
+
+    for (const auto &pair_inferer : inferers)
+    {
+      const auto inferer = pair_inferer.second.get();
+      inferer->dump();
+    }
+
+    // NOTE StaticBackwardShapeInferer is allocated for each subgraph,
+    //      so it does not support models that have controlflow operations yet.
+    for (auto &&pair : lowered_subgs)
+    {
+      auto &lowered_subg = pair.second;
+      auto inferer = std::make_unique<StaticBackwardShapeInferer>(lowered_subg.get());
+      inferer->infer();
+      inferer->dump();
+    }
+  }
+
+  // Shape validation
+  for (const auto &pair : lowered_subgs)
+  {
+    auto &lowered_subg = pair.second;
+    compiler::ShapeValidator{lowered_subg->graph()}();
+  }
+
+  // TODO Validate shapes of the tensors for back propagation
+
+  /*************************************************************
+   *  Backend independent analysis & optimization phase finished
+   *************************************************************/
+  for (auto &&[subg_index, lowered_subg] : lowered_subgs)
+  {
+    auto const model_index = ir::ModelIndex{0};
+    auto const indexed_ranks = lowered_subg->indexed_ranks();
+
+    ir::OperationDumper dumper("Executor generation of Subgraph " +
+                               std::to_string(subg_index.value()));
+    lowered_subg->graph().operations().iterate(
+      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
+
+    ExecutorFactoryArgs args;
+    args.tracing_ctx = tracing_ctx;
+    args.options = _options;
+    args.model_index = model_index;
+    args.custom_kernel_builder = custom_kernel_builder;
+    args.share_trainable_tensors = replica;
+    auto executor = std::unique_ptr<exec::IExecutor>{
+      ExecutorFactory::get().create(std::move(lowered_subg), executors, args, _training_info)};
+    executor->setIndexedRanks(indexed_ranks);
+    if (replica)
+      executors->emplaceReplica(std::move(executor));
+    else
+      executors->emplace(model_index, subg_index, std::move(executor));
+  }
+}
+
 std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
 {
   /***************************************************
@@ -175,6 +285,15 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
                     nnfw::misc::str("after_initializing_training_usedefs-", subg_index.value()));
   }
 
+  // Split a batch over replicas
+  const auto num_replicas = std::max(_options->train_num_replicas, 1);
+  if (_training_info.batchSize() % num_replicas != 0)
+    throw std::runtime_error("TrainingCompiler: batch size " +
+                             std::to_string(_training_info.batchSize()) +
+                             " is not divisible by the number of replicas " +
+                             std::to_string(num_replicas));
+  const auto replica_batch_size = _training_info.batchSize() / num_replicas;
+
   // Change input shape according to batch_size
   for (auto &&pair : trainable_subgraphs)
   {
@@ -187,7 +306,7 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
       // TODO Consider batch size index
       if (new_shape.dim(0) != 1)
         throw std::runtime_error("the first dim is not 1. It is not supported yet.");
-      new_shape.dim(0) = _training_info.batchSize();
+      new_shape.dim(0) = replica_batch_size;
       input.info().shape(new_shape);
     }
   }
@@ -198,100 +317,16 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
   // Tracing context
   auto tracing_ctx = std::make_unique<util::TracingCtx>();
 
-  // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::train::LoweredTrainableGraph>>
-    lowered_subgs;
-  {
-    for (auto &&[subg_index, trainable_subg] : trainable_subgraphs)
-    {
-      // Lower: Assign backend
-      lowered_subgs[subg_index] =
-        std::make_unique<compiler::train::LoweredTrainableGraph>(*trainable_subg, *_options);
-      // Set tracing_ctx for copied graph
-      tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
-    }
-  }
-
-  for (const auto &[subg_index, lowered_subg] : lowered_subgs)
-  {
-    dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
-  }
-
-  // Set operands' info for back propagation as default tensor info
-  for (const auto &pair : lowered_subgs)
-  {
-    auto lowered_subg = pair.second.get();
-    auto &tgraph = lowered_subg->trainable_graph();
-    tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
-      if (!obj.isConstant())
-      {
-        auto bwd_operand = std::make_unique<ir::Operand>(obj);
-        const auto gen_index = tgraph.addBackwardOperand(index, std::move(bwd_operand));
-        assert(gen_index == index);
-        UNUSED_RELEASE(gen_index);
-      }
-    });
-  }
-
-  // Shape inference.
-  {
-    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
-    // recursively
-    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
-      createStaticShapeInferers(lowered_subgs);
-
-    const auto primary_subg_idx = ir::SubgraphIndex{0};
-    inferers.at(primary_subg_idx)->infer();
-
-    for (const auto &pair_inferer : inferers)
-    {
-      const auto inferer = pair_inferer.second.get();
-      inferer->dump();
-    }
-
-    // NOTE StaticBackwardShapeInferer is allocated for each subgraph,
-    //      so it does not support models that have controlflow operations yet.
-    for (auto &&pair : lowered_subgs)
-    {
-      auto &lowered_subg = pair.second;
-      auto inferer = std::make_unique<StaticBackwardShapeInferer>(lowered_subg.get());
-      inferer->infer();
-      inferer->dump();
-    }
-  }
-
-  // Shape validation
-  for (const auto &pair : lowered_subgs)
-  {
-    auto &lowered_subg = pair.second;
-    compiler::ShapeValidator{lowered_subg->graph()}();
-  }
-
-  // TODO Validate shapes of the tensors for back propagation
-
-  /*************************************************************
-   *  Backend independent analysis & optimization phase finished
-   *************************************************************/
   auto executors = std::make_shared<exec::train::TrainableExecutors>();
-  for (auto &&[subg_index, lowered_subg] : lowered_subgs)
-  {
-    auto const model_index = ir::ModelIndex{0};
-    auto const indexed_ranks = lowered_subg->indexed_ranks();
+  createExecutors(trainable_subgraphs, executors, tracing_ctx.get(), custom_kernel_builder,
+                  dot_dumper, false);
 
-    ir::OperationDumper dumper("Executor generation of Subgraph " +
-                               std::to_string(subg_index.value()));
-    lowered_subg->graph().operations().iterate(
-      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
-
-    ExecutorFactoryArgs args;
-    args.tracing_ctx = tracing_ctx.get();
-    args.options = _options;
-    args.model_index = model_index;
-    args.custom_kernel_builder = custom_kernel_builder;
-    auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_subg), executors, args, _training_info)};
-    executor->setIndexedRanks(indexed_ranks);
-    executors->emplace(model_index, subg_index, std::move(executor));
+  // Replicas train the other parts of a batch with the same weights
+  onert::dumper::dot::DotDumper replica_dot_dumper(dumper::dot::DotDumper::Level::OFF);
+  for (int32_t r = 1; r < num_replicas; ++r)
+  {
+    createExecutors(trainable_subgraphs, executors, tracing_ctx.get(), custom_kernel_builder,
+                    replica_dot_dumper, true);
   }
 
   /********************************
@@ -22,10 +22,16 @@
 #ifndef __ONERT_COMPILER_TRAIN_TRAINING_COMPILER_H_
 #define __ONERT_COMPILER_TRAIN_TRAINING_COMPILER_H_
 
+#include "../../dumper/dot/DotDumper.h"
+#include "../../exec/train/TrainableExecutors.h"
 #include "compiler/CompilerOptions.h"
 #include "compiler/ICompiler.h"
 #include "ir/NNPkg.h"
+#include "ir/train/TrainableGraph.h"
 #include "ir/train/TrainingInfo.h"
+#include "util/TracingCtx.h"
+
+#include <unordered_map>
 
 namespace onert
 {
@@ -68,6 +74,20 @@ public:
    */
   std::shared_ptr<CompilerArtifact> compile(void);
 
+private:
+  /**
+   * @brief Lower trainable subgraphs and emplace their executors
+   *
+   * @param replica If true, executors are emplaced as replicas of the entry executor
+   */
+  void createExecutors(
+    const std::unordered_map<ir::SubgraphIndex, std::shared_ptr<ir::train::TrainableGraph>>
+      &trainable_subgraphs,
+    const std::shared_ptr<exec::train::TrainableExecutors> &executors,
+    util::TracingCtx *tracing_ctx,
+    const std::shared_ptr<backend::custom::IKernelBuilder> &custom_kernel_builder,
+    dumper::dot::DotDumper &dot_dumper, bool replica);
+
 private:
   std::shared_ptr<ir::Model> _model;
   CompilerOptions *_options;
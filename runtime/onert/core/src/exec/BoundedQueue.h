@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_BOUNDED_QUEUE_H__
+#define __ONERT_EXEC_BOUNDED_QUEUE_H__
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Blocking FIFO queue with fixed capacity
+ *
+ * push() blocks while the queue is full and pop() blocks while the queue is empty.
+ * After close(), push() is rejected and pop() drains remaining items then returns false.
+ */
+template <typename T> class BoundedQueue
+{
+public:
+  explicit BoundedQueue(size_t capacity) : _capacity{capacity} { assert(capacity > 0); }
+
+public:
+  /**
+   * @brief Push an item, waiting for a free place
+   *
+   * @return false if the queue is closed, otherwise true
+   */
+  bool push(T item)
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _cv_not_full.wait(lock, [&] { return _closed || _items.size() < _capacity; });
+    if (_closed)
+      return false;
+    _items.emplace_back(std::move(item));
+    _cv_not_empty.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Pop an item, waiting for an item to be pushed
+   *
+   * @return false if the queue is closed and empty, otherwise true
+   */
+  bool pop(T &item)
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _cv_not_empty.wait(lock, [&] { return _closed || !_items.empty(); });
+    if (_items.empty())
+      return false;
+    item = std::move(_items.front());
+    _items.pop_front();
+    _cv_not_full.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Reject further pushes and wake up all waiters
+   */
+  void close()
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _closed = true;
+    _cv_not_empty.notify_all();
+    _cv_not_full.notify_all();
+  }
+
+private:
+  const size_t _capacity;
+  std::deque<T> _items;
+  bool _closed{false};
+  std::mutex _mu;
+  std::condition_variable _cv_not_empty;
+  std::condition_variable _cv_not_full;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_BOUNDED_QUEUE_H__
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BoundedQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace onert::exec;
+
+TEST(BoundedQueue, fifo)
+{
+  BoundedQueue<int> queue{3};
+  ASSERT_TRUE(queue.push(1));
+  ASSERT_TRUE(queue.push(2));
+  ASSERT_TRUE(queue.push(3));
+
+  int value = 0;
+  ASSERT_TRUE(queue.pop(value));
+  ASSERT_EQ(value, 1);
+  ASSERT_TRUE(queue.pop(value));
+  ASSERT_EQ(value, 2);
+  ASSERT_TRUE(queue.pop(value));
+  ASSERT_EQ(value, 3);
+}
+
+TEST(BoundedQueue, producer_consumer)
+{
+  BoundedQueue<int> queue{2};
+  std::thread producer([&] {
+    for (int i = 0; i < 100; ++i)
+      queue.push(i);
+    queue.close();
+  });
+
+  int value = 0;
+  int expected = 0;
+  while (queue.pop(value))
+  {
+    ASSERT_EQ(value, expected);
+    expected++;
+  }
+  producer.join();
+  ASSERT_EQ(expected, 100);
+}
+
+TEST(BoundedQueue, drain_after_close)
+{
+  BoundedQueue<int> queue{2};
+  ASSERT_TRUE(queue.push(7));
+  queue.close();
+
+  int value = 0;
+  ASSERT_TRUE(queue.pop(value));
+  ASSERT_EQ(value, 7);
+  ASSERT_FALSE(queue.pop(value));
+}
+
+TEST(BoundedQueue, neg_push_after_close)
+{
+  BoundedQueue<int> queue{2};
+  queue.close();
+  ASSERT_FALSE(queue.push(1));
+}
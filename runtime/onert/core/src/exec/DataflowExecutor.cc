@@ -52,10 +52,17 @@ int64_t DataflowExecutor::calculateRank(const std::vector<ir::OperationIndex> &o
 
 void DataflowExecutor::emplaceToReadyJobs(const uint32_t &id)
 {
-  auto &job = _waiting_jobs[id];
-  assert(job != nullptr);
-  auto rank = calculateRank({_job_to_op[job->index()]});
-  _ready_jobs.emplace(rank, std::move(job));
+  assert(_waiting_jobs[id] != nullptr);
+  _ready_jobs.push(_job_ranks[id], id);
+}
+
+std::unique_ptr<Job> DataflowExecutor::popReadyJob()
+{
+  auto id = _ready_jobs.pop();
+  assert(_waiting_jobs[id] != nullptr);
+  assert(_num_waiting_jobs > 0);
+  --_num_waiting_jobs;
+  return std::move(_waiting_jobs[id]);
 }
 
 void DataflowExecutor::notify(uint32_t finished_job_id)
@@ -70,11 +77,8 @@ void DataflowExecutor::notify(uint32_t finished_job_id)
     }
   }
 }
-bool DataflowExecutor::noWaitingJobs()
-{
-  return std::all_of(_waiting_jobs.begin(), _waiting_jobs.end(),
-                     [](const std::unique_ptr<Job> &job) { return job == nullptr; });
-}
+
+bool DataflowExecutor::noWaitingJobs() { return _num_waiting_jobs == 0; }
 
 DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                                    backend::BackendContexts &&backend_contexts,
@@ -121,16 +125,30 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
     _job_to_op.emplace(job_ind, op_ind);
 
   _input_info = _initial_input_info;
+  _ready_jobs.reserve(next_job_index);
 }
 
-void DataflowExecutor::executeImpl(const ExecutionObservee &subject)
+void DataflowExecutor::prepareJobs()
 {
   assert(noWaitingJobs());
 
+  if (_job_ranks.empty())
+  {
+    _job_ranks.resize(_finished_jobs.size());
+    for (uint32_t i = 0; i < _job_ranks.size(); ++i)
+      _job_ranks[i] = calculateRank({_job_to_op[i]});
+  }
+
+  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  _num_waiting_jobs = _waiting_jobs.size();
+}
+
+void DataflowExecutor::executeImpl(const ExecutionObservee &subject)
+{
   bool dynamic_input_exists = hasDynamicInput();
 
   // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  prepareJobs();
 
   for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
   {
@@ -147,8 +165,7 @@ void DataflowExecutor::executeImpl(const ExecutionObservee &subject)
 
   while (!_ready_jobs.empty())
   {
-    auto job = std::move((_ready_jobs.begin())->second);
-    _ready_jobs.erase(_ready_jobs.begin());
+    auto job = popReadyJob();
     auto job_index = job->index();
     VERBOSE(DataflowExecutor) << "Run job " << job_index << std::endl;
 
@@ -19,13 +19,13 @@
 
 #include "ExecutorBase.h"
 #include "Job.h"
+#include "ReadyJobQueue.h"
 
 #include "compiler/CodeMap.h"
 #include "ir/OperandIndexSequence.h"
 #include "util/TracingCtx.h"
 
 #include <list>
-#include <map>
 #include <memory>
 #include <unordered_map>
 
@@ -58,7 +58,9 @@ public:
 
 protected:
   int64_t calculateRank(const std::vector<ir::OperationIndex> &operations);
+  void prepareJobs();
   void emplaceToReadyJobs(const uint32_t &id);
+  std::unique_ptr<Job> popReadyJob();
 
 protected:
   compiler::CodeMap _code_map;
@@ -70,8 +72,13 @@ protected:
   /**
    * @brief A vector of waiting jobs for current execution
    *        All the jobs are moved from #_finished_jobs to it when start a run
+   *        A job stays here until it is popped from #_ready_jobs
    */
   std::vector<std::unique_ptr<Job>> _waiting_jobs;
+  /**
+   * @brief Number of jobs in #_waiting_jobs
+   */
+  uint32_t _num_waiting_jobs{0};
   /**
    * @brief Jobs' output info
    *        Used for notifying after finishing a job
@@ -80,11 +87,16 @@ protected:
   std::vector<uint32_t> _initial_input_info;
   std::vector<uint32_t> _input_info;
   /**
-   * @brief A collection of jobs that are ready for execution
+   * @brief Ranks of jobs from `_indexed_ranks`
+   *        It is calculated on the first run because ranks are set after construction
+   */
+  std::vector<int64_t> _job_ranks;
+  /**
+   * @brief Indices of jobs that are ready for execution
    *        Jobs in it are ready to be scheduled.
-   *        Ordered by priority from `_indexed_ranks`
+   *        Ordered by priority from `_job_ranks`
    */
-  std::multimap<int64_t, std::unique_ptr<Job>, std::greater<int64_t>> _ready_jobs;
+  ReadyJobQueue _ready_jobs;
 
   /// @brief Which job runs which op and function.
   std::unordered_map<uint32_t, ir::OperationIndex> _job_to_op;
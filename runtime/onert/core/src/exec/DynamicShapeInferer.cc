@@ -942,6 +942,16 @@ void DynamicShapeInferer::visit(const ir::operation::Reverse &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::RmsNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::RmsNorm::INPUT));
+}
+
+void DynamicShapeInferer::visit(const ir::operation::RoPE &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::RoPE::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Select &op)
 {
   const auto input_cond_idx = op.getInputs().at(ir::operation::Select::Input::CONDITION);
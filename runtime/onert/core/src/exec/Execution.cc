@@ -16,6 +16,8 @@
 
 #include "exec/Execution.h"
 
+#include "MultiModelExecutors.h"
+#include "MultiModelPipeline.h"
 #include "ir/DataType.h"
 #include "train/TrainableExecutors.h"
 #include "util/logging.h"
@@ -44,6 +46,8 @@ Execution::Execution(const std::shared_ptr<IExecutors> &executors) : _executors{
   ExecutionOptions::fromGlobalConfig(_ctx.options);
 }
 
+Execution::~Execution() = default;
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This will be used later to set input tensor dynamic
@@ -54,6 +58,7 @@ void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_
   {
     input_desc->info.shape(new_shape);
     _ctx.shape_updated = true;
+    entryExecutor()->reserveForInputShape(index, new_shape);
 
     VERBOSE(Execution) << "Model input shape will be changed at the start of execute()"
                        << "(index: " << index << ")" << std::endl;
@@ -196,6 +201,62 @@ void Execution::iterateTrainableTensors(
   execs->iterateTrainableTensors(fn);
 }
 
+void Execution::startPipeline(uint32_t depth)
+{
+  if (_pipeline)
+    throw std::runtime_error{"Pipeline is already started"};
+
+  // Outputs of the previous pipeline that are not popped are discarded
+  _finished_pipeline.reset();
+
+  auto execs = dynamic_cast<exec::MultiModelExecutors *>(_executors.get());
+  if (!execs)
+  {
+    throw std::runtime_error{"Supported only MultiModelExecutors"};
+  }
+
+  // Let every stage be busy while one more request is being pushed or popped
+  if (depth == 0)
+    depth = execs->modelCount() + 1;
+
+  _pipeline = std::make_unique<MultiModelPipeline>(*execs, _ctx.options, depth);
+}
+
+void Execution::pushPipelineInput(const std::vector<const void *> &inputs,
+                                  const std::vector<size_t> &lengths)
+{
+  if (!_pipeline)
+    throw std::runtime_error{"Pipeline is not started"};
+
+  _pipeline->push(inputs, lengths);
+}
+
+bool Execution::popPipelineOutput(std::vector<void *> &outputs)
+{
+  if (_pipeline)
+    return _pipeline->pop(outputs);
+
+  if (!_finished_pipeline)
+    throw std::runtime_error{"Pipeline is not started"};
+
+  if (_finished_pipeline->pop(outputs))
+    return true;
+
+  // All outputs are popped
+  _finished_pipeline.reset();
+  return false;
+}
+
+void Execution::finishPipeline()
+{
+  if (!_pipeline)
+    throw std::runtime_error{"Pipeline is not started"};
+
+  _pipeline->close();
+  _pipeline->join();
+  _finished_pipeline = std::move(_pipeline);
+}
+
 ir::Shape Execution::getInputShape(ir::IOIndex ind) const
 {
   return _ctx.desc.inputs.at(ind.value())->info.shape();
@@ -18,6 +18,8 @@
 
 #include "util/ConfigSource.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
@@ -28,6 +30,7 @@ void ExecutionOptions::fromGlobalConfig(ExecutionOptions &options)
   options.dump_minmax = util::getConfigBool(util::config::MINMAX_DUMP);
   options.trace = util::getConfigBool(util::config::TRACING_MODE);
   options.profile = util::getConfigBool(util::config::PROFILING_MODE);
+  options.stats_sampling = std::max(util::getConfigInt(util::config::STATS_SAMPLING), 0);
 }
 
 } // namespace exec
@@ -52,6 +52,14 @@ ExecutionObservee::ExecutionObservee(const ExecObservers &observers,
 
     _observers.emplace_back(observer);
   }
+
+  // Not an error without the observer, as this option is meant to be left on for any executor
+  if (options.stats_sampling > 0)
+  {
+    auto observer = static_cast<StatsObserver *>(observers.get(ObserverType::STATS));
+    if (observer && observer->stats().sample(options.stats_sampling))
+      _observers.emplace_back(observer);
+  }
 }
 
 void ExecutionObservee::notifySubgraphBegin(ir::SubgraphIndex ind) const
@@ -22,6 +22,8 @@
 
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <sstream>
 
@@ -175,6 +177,38 @@ void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
     EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END, subg_ind.value()});
 }
 
+StatsObserver::StatsObserver(const ir::Graph &graph) : _stats{graph}, _run_begin{0}
+{
+  uint32_t num_operations = 0;
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &) {
+    num_operations = std::max(num_operations, index.value() + 1);
+  });
+  _job_begins.resize(num_operations);
+}
+
+uint64_t StatsObserver::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+void StatsObserver::handleSubgraphBegin(ir::SubgraphIndex) { _run_begin = now(); }
+
+void StatsObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                   const backend::Backend *)
+{
+  _job_begins[op_ind.value()] = now();
+}
+
+void StatsObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                 const backend::Backend *backend)
+{
+  _stats.recordOperation(op_ind, backend, now() - _job_begins[op_ind.value()]);
+}
+
+void StatsObserver::handleSubgraphEnd(ir::SubgraphIndex) { _stats.recordRun(now() - _run_begin); }
+
 } // namespace exec
 
 } // namespace onert
@@ -23,6 +23,7 @@
 #include "../util/EventWriter.h"
 
 #include "exec/IExecutor.h"
+#include "exec/LatencyStats.h"
 #include "ir/Index.h"
 #include "ir/IOperation.h"
 #include "util/ITimer.h"
@@ -38,6 +39,7 @@ enum class ObserverType
   PROFILE,
   TRACING,
   MINMAX_DUMP,
+  STATS,
 };
 
 class IExecutionObserver
@@ -123,6 +125,36 @@ private:
   bool _triggered;
 };
 
+/**
+ * @brief Observer recording latencies of sampled executions into histograms
+ *
+ * It is added to executors regardless of options, as it costs nothing until an execution is
+ * sampled. Only sampled executions are notified to this observer by ExecutionObservee.
+ */
+class StatsObserver : public IExecutionObserver
+{
+public:
+  explicit StatsObserver(const ir::Graph &graph);
+  void handleSubgraphBegin(ir::SubgraphIndex) override;
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+  ObserverType type() const override { return ObserverType::STATS; }
+
+  LatencyStats &stats() { return _stats; }
+
+private:
+  static uint64_t now();
+
+private:
+  LatencyStats _stats;
+  uint64_t _run_begin;
+  // Begin time of each operation, written and read by the thread running the operation
+  std::vector<uint64_t> _job_begins;
+};
+
 } // namespace exec
 } // namespace onert
 
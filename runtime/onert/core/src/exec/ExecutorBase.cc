@@ -16,9 +16,13 @@
 
 #include "ExecutorBase.h"
 
+#include "backend/basic/MemoryManager.h"
+#include "backend/basic/Tensor.h"
 #include "util/ConfigSource.h"
 #include <misc/polymorphic_downcast.h>
 
+#include <unordered_map>
+
 namespace onert
 {
 namespace exec
@@ -84,6 +88,41 @@ void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs
   executeImpl(subject);
 }
 
+void ExecutorBase::reserveForInputShape(const ir::IOIndex &index, const ir::Shape &shape)
+{
+  // Only outputs of operations reading the input are given memory, if they were compiled to the
+  // input shape, e.g. of elementwise operations. They are likely to take the new shape as well,
+  // and tensors farther from the input are left to be allocated while running.
+  const auto &input = _graph.operands().at(_graph.getInputs().at(index));
+  std::unordered_map<backend::basic::DynamicMemoryManager *, std::vector<size_t>> sizes;
+  for (const auto &op_ind : input.getUses())
+  {
+    for (const auto &ind : _graph.operations().at(op_ind).getOutputs() | ir::Remove::UNDEFINED)
+    {
+      if (_graph.operands().at(ind).shape() != input.shape())
+        continue;
+
+      for (const auto &pair : _backend_contexts)
+      {
+        const auto &tensor_reg = pair.second->tensor_registry;
+        if (tensor_reg == nullptr)
+          continue;
+        auto tensor = dynamic_cast<backend::basic::Tensor *>(tensor_reg->getNativeITensor(ind));
+        if (tensor == nullptr || tensor->dynamic_mem_mgr() == nullptr)
+          continue;
+        const auto info = ir::OperandInfo::createStaticInfo(shape, tensor->get_info().typeInfo());
+        // Static buffer is kept for a shape that fits it
+        if (!tensor->is_dynamic() && info.total_size() <= tensor->total_size())
+          continue;
+        sizes[tensor->dynamic_mem_mgr()].push_back(info.total_size());
+      }
+    }
+  }
+
+  for (const auto &[mem_mgr, tensor_sizes] : sizes)
+    mem_mgr->reserve(tensor_sizes);
+}
+
 bool ExecutorBase::hasDynamicInput()
 {
   for (auto &&tensor : _input_tensors)
@@ -92,6 +92,14 @@ public:
 
   const ExecutionOptions &currentOptions() const override { return _current_options; }
 
+  const LatencyStats *latencyStats() const override
+  {
+    auto observer = static_cast<StatsObserver *>(_observers.get(ObserverType::STATS));
+    return observer ? &observer->stats() : nullptr;
+  }
+
+  void reserveForInputShape(const ir::IOIndex &index, const ir::Shape &shape) override;
+
 protected:
   /**
    * @brief Returns @c true if any input tensor is dynamic; @c false if all are static tensors
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/LatencyStats.h"
+
+#include "backend/IConfig.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace onert
+{
+namespace exec
+{
+
+uint32_t LatencyHistogram::bucket(uint64_t ns)
+{
+  if (ns < SUB_BUCKETS)
+    return ns;
+
+  const uint32_t msb = std::min<uint32_t>(63 - __builtin_clzll(ns), MAX_EXPONENT);
+  const uint32_t shift = msb - SUB_BUCKET_BITS;
+  const uint32_t sub = std::min<uint64_t>(ns >> shift, 2 * SUB_BUCKETS - 1) - SUB_BUCKETS;
+  return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::upperBound(uint32_t bucket)
+{
+  if (bucket < SUB_BUCKETS)
+    return bucket;
+
+  const uint32_t shift = bucket / SUB_BUCKETS - 1;
+  const uint64_t sub = bucket % SUB_BUCKETS;
+  return ((SUB_BUCKETS + sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t ns)
+{
+  _buckets[bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+  _count.fetch_add(1, std::memory_order_relaxed);
+  _total.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+  for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    const auto n = other._buckets[i].load(std::memory_order_relaxed);
+    if (n != 0)
+      _buckets[i].fetch_add(n, std::memory_order_relaxed);
+  }
+  _count.fetch_add(other.count(), std::memory_order_relaxed);
+  _total.fetch_add(other.total(), std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::percentile(double ratio) const
+{
+  // Take a snapshot of buckets, as records can be added while reading
+  std::array<uint64_t, NUM_BUCKETS> snapshot;
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    snapshot[i] = _buckets[i].load(std::memory_order_relaxed);
+    count += snapshot[i];
+  }
+  if (count == 0)
+    return 0;
+
+  const auto rank = std::max<uint64_t>(1, std::ceil(std::clamp(ratio, 0.0, 1.0) * count));
+  uint64_t seen = 0;
+  for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    seen += snapshot[i];
+    if (seen >= rank)
+      return upperBound(i);
+  }
+  return upperBound(NUM_BUCKETS - 1);
+}
+
+LatencyStats::LatencyStats(const ir::Graph &graph) : _num_operations{0}
+{
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &) {
+    _num_operations = std::max(_num_operations, index.value() + 1);
+  });
+}
+
+bool LatencyStats::sample(uint32_t interval)
+{
+  if (interval == 0)
+    return false;
+
+  if (_num_runs.fetch_add(1, std::memory_order_relaxed) % interval != 0)
+    return false;
+
+  std::call_once(_allocated, [&]() {
+    _operations = std::vector<LatencyHistogram>(_num_operations);
+    _backends = std::vector<std::atomic<const backend::Backend *>>(_num_operations);
+    _ready.store(true, std::memory_order_release);
+  });
+  return true;
+}
+
+void LatencyStats::recordRun(uint64_t ns) { _run.record(ns); }
+
+void LatencyStats::recordOperation(ir::OperationIndex index, const backend::Backend *backend,
+                                   uint64_t ns)
+{
+  assert(_ready.load(std::memory_order_relaxed));
+  assert(index.value() < _num_operations);
+  _operations[index.value()].record(ns);
+  _backends[index.value()].store(backend, std::memory_order_relaxed);
+}
+
+const LatencyHistogram *LatencyStats::operation(ir::OperationIndex index) const
+{
+  if (!_ready.load(std::memory_order_acquire) || !index.valid() ||
+      index.value() >= _num_operations)
+    return nullptr;
+
+  return &_operations[index.value()];
+}
+
+void LatencyStats::backend(const std::string &id, LatencyHistogram &hist) const
+{
+  if (!_ready.load(std::memory_order_acquire))
+    return;
+
+  for (uint32_t i = 0; i < _num_operations; ++i)
+  {
+    const auto backend = _backends[i].load(std::memory_order_relaxed);
+    if (backend && backend->config()->id() == id)
+      hist.merge(_operations[i]);
+  }
+}
+
+} // namespace exec
+} // namespace onert
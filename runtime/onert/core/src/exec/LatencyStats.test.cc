@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/LatencyStats.h"
+
+#include "backend/IConfig.h"
+#include "ir/operation/ElementwiseActivation.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+
+struct MockConfig : public backend::IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+  std::string _id;
+};
+
+struct MockBackend : public backend::Backend
+{
+  MockBackend(const std::string &id) : _config{std::make_shared<MockConfig>(id)} {}
+  std::shared_ptr<backend::IConfig> config() const override { return _config; }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+  std::shared_ptr<backend::IConfig> _config;
+};
+
+// Graph of relu operations in a row
+void buildGraph(ir::Graph &graph, uint32_t num_operations)
+{
+  ir::Shape shape{1, 4};
+  ir::TypeInfo type{ir::DataType::FLOAT32};
+  auto input = graph.addOperand(shape, type);
+  for (uint32_t i = 0; i < num_operations; ++i)
+  {
+    auto output = graph.addOperand(shape, type);
+    ir::operation::ElementwiseActivation::Param param;
+    param.op_type = ir::operation::ElementwiseActivation::Type::RELU;
+    graph.addOperation(std::make_unique<ir::operation::ElementwiseActivation>(
+      ir::OperandIndexSequence{input}, ir::OperandIndexSequence{output}, param));
+    input = output;
+  }
+}
+
+} // namespace
+
+TEST(LatencyHistogram, bucket)
+{
+  // Buckets are continuous and each contains values up to its upper bound
+  uint64_t lower = 0;
+  for (uint32_t b = 0; b < LatencyHistogram::NUM_BUCKETS - 1; ++b)
+  {
+    const auto upper = LatencyHistogram::upperBound(b);
+    ASSERT_GE(upper, lower);
+    EXPECT_EQ(LatencyHistogram::bucket(lower), b);
+    EXPECT_EQ(LatencyHistogram::bucket(upper), b);
+    lower = upper + 1;
+  }
+
+  // Error of upper bound is at most 25%
+  for (uint64_t ns : {5ull, 100ull, 12345ull, 1000000007ull})
+  {
+    const auto upper = LatencyHistogram::upperBound(LatencyHistogram::bucket(ns));
+    EXPECT_GE(upper, ns);
+    EXPECT_LE(upper, ns + ns / 4);
+  }
+
+  // Too long latencies are counted in the last bucket
+  EXPECT_EQ(LatencyHistogram::bucket(UINT64_MAX), LatencyHistogram::NUM_BUCKETS - 1);
+}
+
+TEST(LatencyHistogram, percentile)
+{
+  LatencyHistogram hist;
+  EXPECT_EQ(hist.percentile(0.5), 0);
+
+  for (uint64_t ns = 1; ns <= 100; ++ns)
+    hist.record(ns * 1000);
+
+  EXPECT_EQ(hist.count(), 100);
+  EXPECT_EQ(hist.total(), 5050 * 1000);
+  EXPECT_GE(hist.percentile(0.5), 50000);
+  EXPECT_LE(hist.percentile(0.5), 50000 * 5 / 4);
+  EXPECT_GE(hist.percentile(0.99), 99000);
+  EXPECT_LE(hist.percentile(0.99), 99000 * 5 / 4);
+  EXPECT_GE(hist.percentile(1.0), 100000);
+}
+
+TEST(LatencyHistogram, concurrent_record)
+{
+  LatencyHistogram hist;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&]() {
+      for (uint64_t i = 0; i < 10000; ++i)
+        hist.record(i);
+    });
+  for (auto &thread : threads)
+    thread.join();
+
+  EXPECT_EQ(hist.count(), 40000);
+  EXPECT_EQ(hist.total(), 4 * (9999 * 10000 / 2));
+}
+
+TEST(LatencyStats, sample)
+{
+  ir::Graph graph;
+  buildGraph(graph, 2);
+  LatencyStats stats{graph};
+
+  uint32_t sampled = 0;
+  for (int i = 0; i < 10; ++i)
+    sampled += stats.sample(3);
+  EXPECT_EQ(sampled, 4);
+
+  EXPECT_FALSE(stats.sample(0));
+}
+
+TEST(LatencyStats, operation_backend)
+{
+  ir::Graph graph;
+  buildGraph(graph, 3);
+  LatencyStats stats{graph};
+  MockBackend cpu{"cpu"};
+  MockBackend other{"other"};
+
+  // Nothing is recorded before sampled
+  EXPECT_EQ(stats.operation(ir::OperationIndex{0}), nullptr);
+
+  ASSERT_TRUE(stats.sample(1));
+  stats.recordOperation(ir::OperationIndex{0}, &cpu, 100);
+  stats.recordOperation(ir::OperationIndex{1}, &other, 200);
+  stats.recordOperation(ir::OperationIndex{2}, &cpu, 300);
+  stats.recordRun(600);
+
+  EXPECT_EQ(stats.run().count(), 1);
+  EXPECT_EQ(stats.run().total(), 600);
+  ASSERT_NE(stats.operation(ir::OperationIndex{1}), nullptr);
+  EXPECT_EQ(stats.operation(ir::OperationIndex{1})->total(), 200);
+
+  LatencyHistogram hist;
+  stats.backend("cpu", hist);
+  EXPECT_EQ(hist.count(), 2);
+  EXPECT_EQ(hist.total(), 400);
+}
+
+TEST(LatencyStats, neg_operation)
+{
+  ir::Graph graph;
+  buildGraph(graph, 1);
+  LatencyStats stats{graph};
+  ASSERT_TRUE(stats.sample(1));
+
+  EXPECT_EQ(stats.operation(ir::OperationIndex{1}), nullptr);
+  EXPECT_EQ(stats.operation(ir::OperationIndex{}), nullptr);
+
+  LatencyHistogram hist;
+  stats.backend("none", hist);
+  EXPECT_EQ(hist.count(), 0);
+}
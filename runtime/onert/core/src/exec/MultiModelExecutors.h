@@ -81,12 +81,16 @@ public:
 
   void execute(const ExecutionContext &ctx) override;
 
-private:
+  const ir::ModelEdges &modelEdges() const { return *_model_edges; }
+
   void checkSupportedMultimodel() const;
+
+  uint16_t modelCount() const;
+
+private:
   void createEdgeQuantLayers();
   void CreatePkgIOTensors(const IODescription &desc);
   void createPkgIOQuantLayers(const IODescription &desc);
-  uint16_t modelCount() const;
 
 private:
   std::unordered_map<std::pair<ir::ModelIndex, ir::SubgraphIndex>, std::unique_ptr<IExecutor>>
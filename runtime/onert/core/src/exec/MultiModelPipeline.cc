@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiModelPipeline.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace onert
+{
+namespace exec
+{
+
+MultiModelPipeline::MultiModelPipeline(MultiModelExecutors &executors,
+                                       const ExecutionOptions &options, uint32_t depth)
+  : _model_edges{executors.modelEdges()}, _options{options}, _stages{}, _requests{},
+    _free{depth}, _queues{}, _threads{}
+{
+  if (depth == 0)
+    throw std::runtime_error{"Pipeline depth must be positive"};
+
+  // Pipeline stages follow model order, so the edge set must satisfy the same assumption as
+  // sequential multi model execution (m1 < m2 for all edges)
+  executors.checkSupportedMultimodel();
+
+  const auto model_count = executors.modelCount();
+  for (auto model_index = ir::ModelIndex{0}; model_index.value() < model_count; model_index++)
+    _stages.emplace_back(executors.at(model_index, ir::SubgraphIndex{0}));
+
+  // Allocate all request buffers in advance: no allocation on push/pop except user outputs
+  for (uint32_t i = 0; i < depth; ++i)
+  {
+    _requests.emplace_back(createRequest());
+    _free.push(_requests.back().get());
+  }
+
+  // Every request is either free or in one of queues, so queues never block on push
+  for (uint32_t i = 0; i <= stageCount(); ++i)
+    _queues.emplace_back(std::make_unique<BoundedQueue<Request *>>(depth));
+
+  for (uint32_t i = 0; i < stageCount(); ++i)
+    _threads.emplace_back(&MultiModelPipeline::runStage, this, i);
+
+  VERBOSE(MultiModelPipeline) << "Pipeline is started with " << stageCount() << " stages, depth "
+                              << depth << std::endl;
+}
+
+MultiModelPipeline::~MultiModelPipeline()
+{
+  close();
+  join();
+}
+
+std::unique_ptr<MultiModelPipeline::Request> MultiModelPipeline::createRequest() const
+{
+  auto request = std::make_unique<Request>();
+  request->stage_inputs.resize(stageCount());
+  request->stage_outputs.resize(stageCount());
+
+  auto find_from = [&](const ir::IODesc &to) {
+    for (const auto &edge : _model_edges.edges)
+    {
+      if (edge.to == to)
+        return edge.from;
+    }
+
+    throw std::runtime_error{"Cannot find edge for model input"};
+  };
+
+  for (uint32_t stage = 0; stage < stageCount(); ++stage)
+  {
+    const auto executor = _stages[stage];
+    const auto model_index = ir::ModelIndex{static_cast<uint16_t>(stage)};
+
+    // Inputs: `from` tensors are always created already because m1 < m2
+    std::vector<backend::ITensor *> src_tensors;
+    std::vector<backend::ITensor *> dst_tensors;
+    std::vector<ir::PermuteType> permute_types;
+    for (uint32_t i = 0; i < executor->inputSize(); ++i)
+    {
+      const auto to_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      const auto &to_info = executor->inputInfo(i);
+      const auto to_layout = executor->inputLayout(i);
+
+      if (std::find(_model_edges.pkg_inputs.begin(), _model_edges.pkg_inputs.end(), to_iodesc) !=
+          _model_edges.pkg_inputs.end())
+      {
+        auto tensor = std::make_unique<EdgeTensor>(to_info, to_layout);
+        tensor->allocate_buffer();
+        request->stage_inputs[stage].emplace_back(tensor.get());
+        request->input_tensors[to_iodesc] = std::move(tensor);
+        continue;
+      }
+
+      const auto from_iodesc = find_from(to_iodesc);
+      const auto from_tensor = request->output_tensors.at(from_iodesc).get();
+      if (from_tensor->data_type() == to_info.typeInfo().type())
+      {
+        request->stage_inputs[stage].emplace_back(from_tensor);
+        continue;
+      }
+
+      auto type_aware_quant_tensor = std::make_unique<EdgeTensor>(to_info, to_layout);
+      type_aware_quant_tensor->allocate_buffer();
+      src_tensors.emplace_back(from_tensor);
+      dst_tensors.emplace_back(type_aware_quant_tensor.get());
+      // No layout change on edge
+      permute_types.emplace_back(ir::PermuteType::COPY);
+      request->stage_inputs[stage].emplace_back(type_aware_quant_tensor.get());
+      request->input_tensors[to_iodesc] = std::move(type_aware_quant_tensor);
+    }
+
+    auto layer = std::make_unique<PermuteLayer>(src_tensors, dst_tensors, permute_types);
+    layer->prepare();
+    request->stage_quant_layers.emplace_back(std::move(layer));
+
+    // Outputs: edge sources and nnpkg outputs
+    for (uint32_t i = 0; i < executor->outputSize(); ++i)
+    {
+      const auto from_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      auto tensor =
+        std::make_unique<EdgeTensor>(executor->outputInfo(i), executor->outputLayout(i));
+      tensor->allocate_buffer();
+      request->stage_outputs[stage].emplace_back(tensor.get());
+      request->output_tensors[from_iodesc] = std::move(tensor);
+    }
+  }
+
+  return request;
+}
+
+void MultiModelPipeline::runStage(uint32_t stage)
+{
+  auto executor = _stages[stage];
+  auto &in_queue = *_queues[stage];
+  auto &out_queue = *_queues[stage + 1];
+
+  Request *request = nullptr;
+  while (in_queue.pop(request))
+  {
+    // Failed request passes through remaining stages to keep request order
+    if (!request->error)
+    {
+      try
+      {
+        request->stage_quant_layers[stage]->run();
+        executor->execute(request->stage_inputs[stage], request->stage_outputs[stage], _options);
+      }
+      catch (...)
+      {
+        request->error = std::current_exception();
+      }
+    }
+
+    out_queue.push(request);
+  }
+
+  // Input queue is closed and drained: propagate termination to next stage
+  out_queue.close();
+}
+
+void MultiModelPipeline::push(const std::vector<const void *> &inputs,
+                              const std::vector<size_t> &lengths)
+{
+  const auto &pkg_inputs = _model_edges.pkg_inputs;
+  if (inputs.size() != pkg_inputs.size() || lengths.size() != pkg_inputs.size())
+    throw std::runtime_error{"Pipeline input count mismatch"};
+
+  Request *request = nullptr;
+  if (!_free.pop(request))
+    throw std::runtime_error{"Pipeline is closed"};
+
+  for (size_t i = 0; i < pkg_inputs.size(); ++i)
+  {
+    auto tensor = request->input_tensors.at(pkg_inputs[i]).get();
+    const auto size = tensor->total_size();
+    if (inputs[i] == nullptr || lengths[i] < size)
+    {
+      _free.push(request);
+      throw std::runtime_error{"Too small input buffer length"};
+    }
+    std::memcpy(tensor->buffer(), inputs[i], size);
+  }
+
+  request->error = nullptr;
+  if (!_queues.front()->push(request))
+  {
+    _free.push(request);
+    throw std::runtime_error{"Pipeline is closed"};
+  }
+}
+
+bool MultiModelPipeline::pop(std::vector<void *> &outputs)
+{
+  Request *request = nullptr;
+  if (!_queues.back()->pop(request))
+    return false;
+
+  if (request->error)
+  {
+    auto error = request->error;
+    request->error = nullptr;
+    _free.push(request);
+    std::rethrow_exception(error);
+  }
+
+  for (const auto &pkg_output : _model_edges.pkg_outputs)
+  {
+    const auto tensor = request->output_tensors.at(pkg_output).get();
+    const auto size = tensor->total_size();
+    auto buffer = new uint8_t[size];
+    std::memcpy(buffer, tensor->buffer(), size);
+    outputs.emplace_back(buffer);
+  }
+
+  _free.push(request);
+  return true;
+}
+
+void MultiModelPipeline::close()
+{
+  _queues.front()->close();
+  _free.close();
+}
+
+void MultiModelPipeline::join()
+{
+  for (auto &&thread : _threads)
+  {
+    if (thread.joinable())
+      thread.join();
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_MULTI_MODEL_PIPELINE_H__
+#define __ONERT_EXEC_MULTI_MODEL_PIPELINE_H__
+
+#include "BoundedQueue.h"
+#include "EdgeTensor.h"
+#include "IPermuteFunction.h"
+#include "MultiModelExecutors.h"
+
+#include <exception>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Streaming executor running each model of multi-model nnpackage as a pipeline stage
+ *
+ * Every stage (model) runs on its own thread. Stages are joined by bounded queues of in-flight
+ * requests, and each request owns its own set of EdgeTensor buffers. So request N+1 can enter
+ * stage 1 while request N is still in stage 2, and throughput approaches the slowest stage.
+ *
+ * The number of in-flight requests is bounded by @c depth. push() blocks until a request slot is
+ * released by pop().
+ */
+class MultiModelPipeline
+{
+public:
+  MultiModelPipeline(MultiModelExecutors &executors, const ExecutionOptions &options,
+                     uint32_t depth);
+  MultiModelPipeline(const MultiModelPipeline &) = delete;
+  MultiModelPipeline &operator=(const MultiModelPipeline &) = delete;
+  ~MultiModelPipeline();
+
+public:
+  /**
+   * @brief     Copy nnpackage inputs into a free request slot and send it to the first stage
+   * @param[in] inputs  Input buffers in nnpackage input order
+   * @param[in] lengths Byte size of each input buffer
+   */
+  void push(const std::vector<const void *> &inputs, const std::vector<size_t> &lengths);
+
+  /**
+   * @brief      Wait for the oldest request to finish and copy nnpackage outputs
+   * @param[out] outputs Newly allocated (new uint8_t[]) output buffers are appended.
+   *                     Caller takes ownership of them.
+   * @return     false if pipeline is closed and there is no remaining request, otherwise true
+   */
+  bool pop(std::vector<void *> &outputs);
+
+  /**
+   * @brief Stop accepting new requests. Requests already pushed are still processed.
+   */
+  void close();
+
+  /**
+   * @brief Wait for all stage threads to finish. It should be called after close().
+   */
+  void join();
+
+  uint32_t stageCount() const { return static_cast<uint32_t>(_stages.size()); }
+
+private:
+  /**
+   * @brief Buffers and layers for one in-flight inference
+   */
+  struct Request
+  {
+    // Model output tensors, Key: `from` IODesc (edge source or nnpkg output)
+    std::unordered_map<ir::IODesc, std::unique_ptr<EdgeTensor>> output_tensors;
+    // Model input tensors owned by request, Key: `to` IODesc
+    // (nnpkg input or type-aware quantized edge destination)
+    std::unordered_map<ir::IODesc, std::unique_ptr<EdgeTensor>> input_tensors;
+    // Executor I/O tensors for each stage
+    std::vector<std::vector<backend::IPortableTensor *>> stage_inputs;
+    std::vector<std::vector<backend::IPortableTensor *>> stage_outputs;
+    // Type-aware quantization layers for edges, run before each stage
+    std::vector<std::unique_ptr<PermuteLayer>> stage_quant_layers;
+    // Exception thrown by a stage, rethrown on pop()
+    std::exception_ptr error;
+  };
+
+  std::unique_ptr<Request> createRequest() const;
+  void runStage(uint32_t stage);
+
+private:
+  const ir::ModelEdges &_model_edges;
+  const ExecutionOptions _options;
+  std::vector<IExecutor *> _stages;
+  std::vector<std::unique_ptr<Request>> _requests;
+  // Released request slots
+  BoundedQueue<Request *> _free;
+  // _queues[i] feeds stage i, and the last one holds finished requests
+  std::vector<std::unique_ptr<BoundedQueue<Request *>>> _queues;
+  std::vector<std::thread> _threads;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MULTI_MODEL_PIPELINE_H__
@@ -16,8 +16,10 @@
 
 #include "ParallelExecutor.h"
 
+#include <algorithm>
 #include <cassert>
 
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "exec/IFunction.h"
 
@@ -53,10 +55,14 @@ void ParallelExecutor::notify(uint32_t finished_job_id)
 {
   std::unique_lock<std::mutex> lock{_mu_jobs};
 
+  const auto num_ready_jobs = _ready_jobs.size();
   DataflowExecutor::notify(finished_job_id);
 
+  // Only the executor thread waits for jobs. Wake it up if it has something to do.
+  const bool wake_up = _ready_jobs.size() > num_ready_jobs;
   lock.unlock();
-  _cv_jobs.notify_all();
+  if (wake_up)
+    _cv_jobs.notify_one();
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
@@ -70,22 +76,30 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
 }
 
+uint32_t ParallelExecutor::numWorkers()
+{
+  // NUM_THREADS is -1 by default, which runs a single worker for each backend
+  const int num_threads = util::getConfigInt(util::config::NUM_THREADS);
+  return static_cast<uint32_t>(std::max(num_threads, 1));
+}
+
 void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
 {
   bool dynamic_input_exists = hasDynamicInput();
 
-  // Init scheduler
-  // TODO Consider to have distinct backend set in GraphLowerInfo
-  BackendSet backends;
-  for (const auto &[idx, backend] : _lowered_graph->lower_info().operation)
-    backends.add(backend);
-
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  // Init scheduler once, and keep its workers for later executions
+  if (_scheduler == nullptr)
+  {
+    // TODO Consider to have distinct backend set in GraphLowerInfo
+    BackendSet backends;
+    for (const auto &[idx, backend] : _lowered_graph->lower_info().operation)
+      backends.add(backend);
 
-  assert(noWaitingJobs());
+    _scheduler = std::make_unique<ParallelScheduler>(backends, numWorkers());
+  }
 
   // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  prepareJobs();
 
   for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
   {
@@ -117,8 +131,7 @@ void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
       }
     }
 
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
+    auto job = popReadyJob();
 
     lock.unlock();
 
@@ -52,6 +52,13 @@ public:
 
   void executeImpl(const ExecutionObservee &subject) override;
 
+  /**
+   * @brief Get the number of workers running kernels of each backend at once
+   *
+   * @return Number of workers
+   */
+  static uint32_t numWorkers();
+
 private:
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
@@ -26,13 +26,15 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const BackendSet &backends, uint32_t num_threads)
 {
   assert(!backends.empty());
 
   for (auto &&backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    // Workers of a backend steal jobs from each other. Backend-wide resources that are not
+    // thread-safe, such as ruy::Context of ExternalContext, are kept per worker index.
+    _thread_pools[backend] = std::make_unique<ThreadPool>(num_threads);
   }
 }
 
@@ -47,7 +49,7 @@ void ParallelScheduler::finish()
 {
   for (auto &&itr : _thread_pools)
   {
-    itr.second->finish();
+    itr.second->wait();
   }
 }
 
@@ -36,8 +36,9 @@ public:
    * @brief Constructs ParallelScheduler object
    *
    * @param backends Backend set
+   * @param num_threads Number of workers for each backend
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends, uint32_t num_threads);
   /**
    * @brief Assign a task to the given backend
    *
@@ -46,7 +47,7 @@ public:
    */
   void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
   /**
-   * @brief Block until all jobs are finished
+   * @brief Block until all jobs are finished. Workers are kept for next execution.
    */
   void finish();
 
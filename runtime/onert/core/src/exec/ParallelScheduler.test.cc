@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelScheduler.h"
+
+#include "backend/Backend.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace onert;
+using namespace onert::exec;
+
+namespace
+{
+
+struct MockBackend : public backend::Backend
+{
+  std::shared_ptr<backend::IConfig> config() const override { return nullptr; }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+};
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(const std::function<void()> &fn) : _fn{fn} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
+TEST(ParallelScheduler, steal_within_backend)
+{
+  MockBackend backend;
+  BackendSet backends;
+  backends.add(&backend);
+  ParallelScheduler scheduler{backends, 2};
+
+  // Jobs are queued to both workers in round-robin, and the first worker is blocked until all
+  // the others are done. So the jobs behind the blocking job finish only if they are stolen.
+  constexpr int num_jobs = 10;
+  std::atomic<int> count{0};
+  std::thread::id blocked_thread;
+  std::set<std::thread::id> threads;
+  std::mutex mu;
+  scheduler.assign(std::make_unique<LambdaFunction>([&] {
+                     {
+                       std::lock_guard<std::mutex> lock{mu};
+                       blocked_thread = std::this_thread::get_id();
+                     }
+                     while (count.load() < num_jobs)
+                       std::this_thread::yield();
+                   }),
+                   &backend);
+  for (int i = 0; i < num_jobs; ++i)
+  {
+    scheduler.assign(std::make_unique<LambdaFunction>([&] {
+                       std::lock_guard<std::mutex> lock{mu};
+                       threads.insert(std::this_thread::get_id());
+                       count++;
+                     }),
+                     &backend);
+  }
+  scheduler.finish();
+
+  ASSERT_EQ(count.load(), num_jobs);
+  ASSERT_EQ(threads.size(), 1);
+  ASSERT_EQ(threads.count(blocked_thread), 0);
+}
+
+TEST(ParallelScheduler, keep_workers_across_finish)
+{
+  MockBackend backend;
+  BackendSet backends;
+  backends.add(&backend);
+  ParallelScheduler scheduler{backends, 1};
+
+  std::thread::id first;
+  std::thread::id second;
+  scheduler.assign(std::make_unique<LambdaFunction>([&] { first = std::this_thread::get_id(); }),
+                   &backend);
+  scheduler.finish();
+  scheduler.assign(std::make_unique<LambdaFunction>([&] { second = std::this_thread::get_id(); }),
+                   &backend);
+  scheduler.finish();
+
+  ASSERT_EQ(first, second);
+}
+
+TEST(ParallelScheduler, worker_per_backend)
+{
+  MockBackend backend1;
+  MockBackend backend2;
+  BackendSet backends;
+  backends.add(&backend1);
+  backends.add(&backend2);
+  ParallelScheduler scheduler{backends, 1};
+
+  // Each backend has its own worker, so a job of backend2 runs while backend1 is blocked
+  std::atomic<bool> done{false};
+  scheduler.assign(std::make_unique<LambdaFunction>([&] {
+                     while (!done.load())
+                       std::this_thread::yield();
+                   }),
+                   &backend1);
+  scheduler.assign(std::make_unique<LambdaFunction>([&] { done = true; }), &backend2);
+  scheduler.finish();
+
+  ASSERT_TRUE(done.load());
+}
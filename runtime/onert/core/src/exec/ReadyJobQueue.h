@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_READY_JOB_QUEUE_H__
+#define __ONERT_EXEC_READY_JOB_QUEUE_H__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Priority queue of ready job indices
+ *
+ * A job with higher rank is popped first, and jobs with the same rank are popped in push order.
+ * It is a binary heap on a vector. Once reserved for all the jobs, push() and pop() don't
+ * allocate memory.
+ */
+class ReadyJobQueue
+{
+public:
+  void reserve(size_t capacity) { _heap.reserve(capacity); }
+  bool empty() const { return _heap.empty(); }
+  size_t size() const { return _heap.size(); }
+
+  void push(int64_t rank, uint32_t job_index)
+  {
+    _heap.emplace_back(Entry{rank, _next_seq++, job_index});
+    std::push_heap(_heap.begin(), _heap.end(), lowerPriority);
+  }
+
+  uint32_t pop()
+  {
+    assert(!_heap.empty());
+    std::pop_heap(_heap.begin(), _heap.end(), lowerPriority);
+    const auto job_index = _heap.back().job_index;
+    _heap.pop_back();
+    if (_heap.empty())
+      _next_seq = 0;
+    return job_index;
+  }
+
+private:
+  struct Entry
+  {
+    int64_t rank;
+    uint32_t seq;
+    uint32_t job_index;
+  };
+
+  static bool lowerPriority(const Entry &lhs, const Entry &rhs)
+  {
+    if (lhs.rank != rhs.rank)
+      return lhs.rank < rhs.rank;
+    return lhs.seq > rhs.seq;
+  }
+
+private:
+  std::vector<Entry> _heap;
+  uint32_t _next_seq{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_READY_JOB_QUEUE_H__
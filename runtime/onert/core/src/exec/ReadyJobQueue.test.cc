@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReadyJobQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace onert::exec;
+
+TEST(ReadyJobQueue, rank_order)
+{
+  ReadyJobQueue queue;
+  queue.reserve(4);
+  queue.push(1, 0);
+  queue.push(5, 1);
+  queue.push(3, 2);
+  queue.push(std::numeric_limits<int64_t>::max(), 3);
+  ASSERT_EQ(queue.size(), 4);
+
+  ASSERT_EQ(queue.pop(), 3);
+  ASSERT_EQ(queue.pop(), 1);
+  ASSERT_EQ(queue.pop(), 2);
+  ASSERT_EQ(queue.pop(), 0);
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(ReadyJobQueue, same_rank_in_push_order)
+{
+  ReadyJobQueue queue;
+  for (uint32_t i = 0; i < 10; ++i)
+    queue.push(0, i);
+  queue.push(1, 10);
+
+  ASSERT_EQ(queue.pop(), 10);
+  for (uint32_t i = 0; i < 10; ++i)
+    ASSERT_EQ(queue.pop(), i);
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(ReadyJobQueue, interleaved)
+{
+  ReadyJobQueue queue;
+  queue.push(2, 0);
+  queue.push(2, 1);
+  ASSERT_EQ(queue.pop(), 0);
+  queue.push(7, 2);
+  queue.push(2, 3);
+  ASSERT_EQ(queue.pop(), 2);
+  ASSERT_EQ(queue.pop(), 1);
+  ASSERT_EQ(queue.pop(), 3);
+  ASSERT_TRUE(queue.empty());
+}
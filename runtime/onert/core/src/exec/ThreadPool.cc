@@ -16,6 +16,8 @@
 
 #include "ThreadPool.h"
 
+#include "exec/WorkerIndex.h"
+
 #include <cassert>
 
 namespace onert
@@ -29,7 +31,12 @@ ThreadPool::ThreadPool(uint32_t num_threads)
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _queues.emplace_back(std::make_unique<WorkQueue>());
+  }
+
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back(&ThreadPool::work, this, i);
   }
 }
 
@@ -37,14 +44,88 @@ ThreadPool::~ThreadPool()
 {
   if (!_threads.empty())
   {
-    _worker.terminate();
+    setState(State::FORCE_FINISHING);
     join();
   }
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn)
+{
+  const auto queue = _next_queue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+  // Count the job before it becomes visible, or a worker stealing it may decrement _num_jobs first
+  _num_unfinished.fetch_add(1);
+  _num_jobs.fetch_add(1);
+  _queues[queue]->push(std::move(fn));
+
+  // Sleeping worker registers itself in _num_idle before it checks _num_jobs. So if no worker is
+  // found here, every worker is going to see the new job without wake-up.
+  if (_num_idle.load() > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+    }
+    _cv.notify_one();
+  }
+}
+
+uint32_t ThreadPool::numJobsInQueue() { return _num_jobs.load(); }
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+std::unique_ptr<IFunction> ThreadPool::take(uint32_t worker)
+{
+  auto fn = _queues[worker]->pop();
+  for (uint32_t i = 1; fn == nullptr && i < _queues.size(); i++)
+  {
+    fn = _queues[(worker + i) % _queues.size()]->steal();
+  }
+  return fn;
+}
+
+void ThreadPool::work(uint32_t worker)
+{
+  setWorkerIndex(worker);
+
+  while (true)
+  {
+    auto fn = take(worker);
+    if (fn)
+    {
+      _num_jobs.fetch_sub(1);
+      fn->run();
+      if (_num_unfinished.fetch_sub(1) == 1)
+      {
+        {
+          std::lock_guard<std::mutex> lock{_mu};
+        }
+        _cv_done.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{_mu};
+    _num_idle.fetch_add(1);
+    _cv.wait(lock, [this] { return _state != State::ONLINE || _num_jobs.load() > 0; });
+    _num_idle.fetch_sub(1);
+
+    if (_state == State::FORCE_FINISHING)
+    {
+      assert(_num_jobs.load() == 0 && "Terminating with unfinished jobs");
+      return;
+    }
+    else if (_state == State::FINISHING && _num_jobs.load() == 0)
+    {
+      return;
+    }
+  }
+}
+
+void ThreadPool::setState(State state)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _state = state;
+  }
+  _cv.notify_all();
+}
 
 void ThreadPool::join()
 {
@@ -55,9 +136,15 @@ void ThreadPool::join()
   _threads.clear();
 }
 
+void ThreadPool::wait()
+{
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_done.wait(lock, [this] { return _num_unfinished.load() == 0; });
+}
+
 void ThreadPool::finish()
 {
-  _worker.finish();
+  setState(State::FINISHING);
   join();
 }
 
@@ -17,6 +17,9 @@
 #ifndef __ONERT_EXEC_THREAD_POOL_H__
 #define __ONERT_EXEC_THREAD_POOL_H__
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <memory>
 #include <vector>
@@ -28,8 +31,23 @@ namespace onert
 namespace exec
 {
 
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Each worker has its own WorkQueue, and enqueued jobs are distributed over them in round-robin.
+ * A worker runs jobs from its own queue first, and steals from other workers' queues when it is
+ * empty. Workers sleep only when there is no job in any queue.
+ */
 class ThreadPool
 {
+public:
+  enum class State
+  {
+    ONLINE,
+    FINISHING,
+    FORCE_FINISHING
+  };
+
 public:
   /**
    * @brief Coustruct ThreadPool object
@@ -54,17 +72,36 @@ public:
    */
   uint32_t numJobsInQueue();
 
+  /**
+   * @brief Block until all enqueued jobs are finished. Workers stay alive for next jobs.
+   */
+  void wait();
+
   /**
    * @brief Block until all jobs are finished
    */
   void finish();
 
 private:
+  void work(uint32_t worker);
+  std::unique_ptr<IFunction> take(uint32_t worker);
+  void setState(State state);
   void join();
 
 private:
-  WorkQueue _worker;
+  std::vector<std::unique_ptr<WorkQueue>> _queues;
   std::vector<std::thread> _threads;
+  std::atomic<uint32_t> _next_queue{0};
+  // Number of jobs in all the queues
+  std::atomic<uint32_t> _num_jobs{0};
+  // Number of jobs enqueued but not finished yet
+  std::atomic<uint32_t> _num_unfinished{0};
+  // Number of workers sleeping or about to sleep on _cv
+  std::atomic<uint32_t> _num_idle{0};
+  State _state{State::ONLINE};
+  std::mutex _mu;
+  std::condition_variable _cv;
+  std::condition_variable _cv_done;
 };
 
 } // namespace exec
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+
+using namespace onert::exec;
+
+namespace
+{
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(const std::function<void()> &fn) : _fn{fn} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
+TEST(ThreadPool, run_all_jobs)
+{
+  std::atomic<int> count{0};
+  ThreadPool pool{4};
+  for (int i = 0; i < 1000; ++i)
+    pool.enqueue(std::make_unique<LambdaFunction>([&] { count++; }));
+  pool.finish();
+
+  ASSERT_EQ(count.load(), 1000);
+  ASSERT_EQ(pool.numJobsInQueue(), 0);
+}
+
+TEST(ThreadPool, steal_behind_blocked_job)
+{
+  // Half of the jobs are queued behind the blocking job in round-robin. They can finish only when
+  // the other worker steals them.
+  constexpr int num_jobs = 100;
+  std::atomic<int> count{0};
+  ThreadPool pool{2};
+  pool.enqueue(std::make_unique<LambdaFunction>([&] {
+    while (count.load() < num_jobs)
+      std::this_thread::yield();
+  }));
+  for (int i = 0; i < num_jobs; ++i)
+    pool.enqueue(std::make_unique<LambdaFunction>([&] { count++; }));
+  pool.finish();
+
+  ASSERT_EQ(count.load(), num_jobs);
+}
+
+TEST(ThreadPool, enqueue_to_idle_pool)
+{
+  std::atomic<int> count{0};
+  ThreadPool pool{3};
+  for (int i = 0; i < 10; ++i)
+  {
+    // Let workers go to sleep between jobs
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pool.enqueue(std::make_unique<LambdaFunction>([&] { count++; }));
+  }
+  pool.finish();
+
+  ASSERT_EQ(count.load(), 10);
+}
@@ -17,10 +17,9 @@
 #ifndef __ONERT_EXEC_WORK_QUEUE_H__
 #define __ONERT_EXEC_WORK_QUEUE_H__
 
-#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 #include "exec/IFunction.h"
 
@@ -29,56 +28,48 @@ namespace onert
 namespace exec
 {
 
+/**
+ * @brief Job deque owned by one worker of ThreadPool
+ *
+ * The owner worker takes jobs from the front in submission order, and idle workers steal jobs
+ * from the back. Each deque has its own lock, so workers contend only when they touch the same
+ * deque.
+ */
 class WorkQueue
 {
-public:
-  enum class State
-  {
-    ONLINE,
-    FINISHING,
-    FORCE_FINISHING
-  };
-
 public:
   /**
    * @brief Create WorkQueue object
    */
   WorkQueue() = default;
   /**
-   * @brief Destroy WorkQueue object
-   */
-  ~WorkQueue();
-  /**
-   * @brief Thread entry function
-   */
-  void operator()();
-  /**
-   * @brief Push the given Task to the job queue
+   * @brief Push the given function to the back of the deque
    *
    * @param fn Function to be executed(a job)
    */
-  void enqueue(std::unique_ptr<IFunction> &&fn);
+  void push(std::unique_ptr<IFunction> &&fn);
   /**
-   * @brief Flag as terminating so all the worker threads can terminate
+   * @brief Take the oldest job. It is called by the owner worker.
+   *
+   * @return The job, or nullptr if the deque is empty
    */
-  void terminate();
+  std::unique_ptr<IFunction> pop();
   /**
-   * @brief Flag as terminating so all the worker threads can terminate
+   * @brief Take the newest job. It is called by other workers.
+   *
+   * @return The job, or nullptr if the deque is empty
    */
-  void finish();
+  std::unique_ptr<IFunction> steal();
   /**
-   * @brief Check if it has pending jobs. Even if this returns fals, WorkQueue threads may be still
-   * running
+   * @brief Get number of jobs in the deque
    *
-   * @return true if the job queue not empty otherwise false
+   * @return Number of jobs
    */
-  uint32_t numJobsInQueue();
+  uint32_t size();
 
 private:
-  State _state{State::ONLINE};
-  std::queue<std::unique_ptr<IFunction>> _functions;
+  std::deque<std::unique_ptr<IFunction>> _functions;
   std::mutex _mu;
-  std::condition_variable _cv;
 };
 
 } // namespace exec
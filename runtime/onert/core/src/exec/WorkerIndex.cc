@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/WorkerIndex.h"
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+thread_local int current_worker_index = -1;
+
+} // namespace
+
+int workerIndex() { return current_worker_index; }
+
+void setWorkerIndex(int index) { current_worker_index = index; }
+
+} // namespace exec
+} // namespace onert
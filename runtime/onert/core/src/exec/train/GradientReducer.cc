@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GradientReducer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <stdexcept>
+
+namespace onert
+{
+namespace exec
+{
+namespace train
+{
+
+namespace
+{
+
+// Parts are aligned to this number of elements so that threads do not share cache lines
+constexpr size_t kPartAlignment = 16;
+// Number of elements reduced over all replicas at once, small enough to stay in cache
+constexpr size_t kBlockSize = 1024;
+
+} // namespace
+
+GradientReducer::GradientReducer(std::vector<std::vector<float *>> gradients,
+                                 std::vector<size_t> sizes)
+  : _gradients{std::move(gradients)}, _sizes{std::move(sizes)},
+    _num_elements{std::accumulate(_sizes.begin(), _sizes.end(), size_t{0})}
+{
+  if (_gradients.empty())
+    throw std::runtime_error{"GradientReducer: No replica"};
+
+  for (const auto &replica_grads : _gradients)
+  {
+    if (replica_grads.size() != _sizes.size())
+      throw std::runtime_error{"GradientReducer: Replicas have different number of gradients"};
+  }
+}
+
+void GradientReducer::reduce(uint32_t part, uint32_t num_parts, float scale) const
+{
+  assert(part < num_parts);
+
+  const size_t min_part_size = (_num_elements + num_parts - 1) / num_parts;
+  const size_t part_size = (min_part_size + kPartAlignment - 1) / kPartAlignment * kPartAlignment;
+  const size_t part_begin = std::min(_num_elements, part * part_size);
+  const size_t part_end = std::min(_num_elements, part_begin + part_size);
+
+  // Find gradients overlapped with [part_begin, part_end)
+  size_t grad_begin = 0;
+  for (size_t i = 0; i < _sizes.size() && grad_begin < part_end; ++i)
+  {
+    const size_t grad_end = grad_begin + _sizes[i];
+    if (grad_end > part_begin)
+    {
+      const size_t begin = std::max(grad_begin, part_begin) - grad_begin;
+      const size_t end = std::min(grad_end, part_end) - grad_begin;
+      reduceRange(i, begin, end, scale);
+    }
+    grad_begin = grad_end;
+  }
+}
+
+void GradientReducer::reduceRange(size_t grad, size_t begin, size_t end, float scale) const
+{
+  float *dst = _gradients[0][grad];
+  for (size_t block = begin; block < end; block += kBlockSize)
+  {
+    const size_t block_end = std::min(end, block + kBlockSize);
+    for (size_t r = 1; r < _gradients.size(); ++r)
+    {
+      const float *src = _gradients[r][grad];
+      for (size_t e = block; e < block_end; ++e)
+        dst[e] += src[e];
+    }
+
+    if (scale != 1.f)
+    {
+      for (size_t e = block; e < block_end; ++e)
+        dst[e] *= scale;
+    }
+  }
+}
+
+} // namespace train
+} // namespace exec
+} // namespace onert
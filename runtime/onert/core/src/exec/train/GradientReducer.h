@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_TRAIN_GRADIENT_REDUCER_H__
+#define __ONERT_EXEC_TRAIN_GRADIENT_REDUCER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+namespace train
+{
+
+/**
+ * @brief Class to reduce gradients computed by replicas of a model into the first replica
+ *
+ * Elements of all gradients are regarded as one range, which is split into parts of similar
+ * size so that each part can be reduced on a different thread.
+ */
+class GradientReducer
+{
+public:
+  /**
+   * @brief     Construct a new GradientReducer object
+   * @param[in] gradients Gradient buffers of each replica. @c gradients[r][i] is the buffer of
+   *                      the i-th gradient of the r-th replica
+   * @param[in] sizes     Number of elements of each gradient
+   */
+  GradientReducer(std::vector<std::vector<float *>> gradients, std::vector<size_t> sizes);
+
+public:
+  uint32_t numReplicas() const { return _gradients.size(); }
+  size_t numElements() const { return _num_elements; }
+
+  /**
+   * @brief     Add a part of gradients of all replicas into the first replica's ones and scale
+   *            the sums
+   * @param[in] part      Index of the part to reduce, less than @c num_parts
+   * @param[in] num_parts Number of parts the gradients are split into
+   * @param[in] scale     Value multiplied to the sums
+   */
+  void reduce(uint32_t part, uint32_t num_parts, float scale) const;
+
+private:
+  void reduceRange(size_t grad, size_t begin, size_t end, float scale) const;
+
+private:
+  std::vector<std::vector<float *>> _gradients;
+  std::vector<size_t> _sizes;
+  size_t _num_elements;
+};
+
+} // namespace train
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_TRAIN_GRADIENT_REDUCER_H__
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GradientReducer.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace onert::exec::train;
+
+namespace
+{
+
+struct Replicas
+{
+  Replicas(uint32_t num_replicas, const std::vector<size_t> &sizes) : sizes{sizes}
+  {
+    for (uint32_t r = 0; r < num_replicas; ++r)
+    {
+      std::vector<std::vector<float>> grads;
+      for (size_t i = 0; i < sizes.size(); ++i)
+      {
+        std::vector<float> grad(sizes[i]);
+        for (size_t e = 0; e < sizes[i]; ++e)
+          grad[e] = static_cast<float>((r + 1) * (i + 1) + e);
+        grads.emplace_back(std::move(grad));
+      }
+      data.emplace_back(std::move(grads));
+    }
+  }
+
+  std::vector<std::vector<float *>> buffers()
+  {
+    std::vector<std::vector<float *>> ret;
+    for (auto &&grads : data)
+    {
+      std::vector<float *> ptrs;
+      for (auto &&grad : grads)
+        ptrs.emplace_back(grad.data());
+      ret.emplace_back(std::move(ptrs));
+    }
+    return ret;
+  }
+
+  float expected(size_t i, size_t e, float scale) const
+  {
+    float sum = 0;
+    for (uint32_t r = 0; r < data.size(); ++r)
+      sum += static_cast<float>((r + 1) * (i + 1) + e);
+    return sum * scale;
+  }
+
+  std::vector<size_t> sizes;
+  std::vector<std::vector<std::vector<float>>> data;
+};
+
+} // namespace
+
+TEST(GradientReducer, reduce_one_part)
+{
+  Replicas replicas{3, {5, 1, 7}};
+  GradientReducer reducer{replicas.buffers(), replicas.sizes};
+  EXPECT_EQ(reducer.numReplicas(), 3);
+  EXPECT_EQ(reducer.numElements(), 13);
+
+  reducer.reduce(0, 1, 0.5f);
+  for (size_t i = 0; i < replicas.sizes.size(); ++i)
+    for (size_t e = 0; e < replicas.sizes[i]; ++e)
+      EXPECT_FLOAT_EQ(replicas.data[0][i][e], replicas.expected(i, e, 0.5f));
+
+  // Other replicas are not changed
+  EXPECT_FLOAT_EQ(replicas.data[1][2][3], 9.f);
+}
+
+TEST(GradientReducer, reduce_parts)
+{
+  // Parts do not align with gradients and some parts are empty
+  Replicas replicas{2, {3, 40, 2000, 1}};
+  GradientReducer reducer{replicas.buffers(), replicas.sizes};
+
+  const uint32_t num_parts = 7;
+  for (uint32_t part = 0; part < num_parts; ++part)
+    reducer.reduce(part, num_parts, 1.f);
+
+  for (size_t i = 0; i < replicas.sizes.size(); ++i)
+    for (size_t e = 0; e < replicas.sizes[i]; ++e)
+      EXPECT_FLOAT_EQ(replicas.data[0][i][e], replicas.expected(i, e, 1.f));
+}
+
+TEST(GradientReducer, more_parts_than_elements)
+{
+  Replicas replicas{2, {2, 3}};
+  GradientReducer reducer{replicas.buffers(), replicas.sizes};
+
+  for (uint32_t part = 0; part < 4; ++part)
+    reducer.reduce(part, 4, 1.f);
+
+  for (size_t i = 0; i < replicas.sizes.size(); ++i)
+    for (size_t e = 0; e < replicas.sizes[i]; ++e)
+      EXPECT_FLOAT_EQ(replicas.data[0][i][e], replicas.expected(i, e, 1.f));
+}
+
+TEST(GradientReducer, neg_mismatched_replicas)
+{
+  std::vector<float> a(2), b(2);
+  EXPECT_ANY_THROW(GradientReducer({{a.data(), b.data()}, {a.data()}}, {2, 2}));
+  EXPECT_ANY_THROW(GradientReducer({}, {2}));
+}
@@ -19,8 +19,11 @@
 #include "ruy/profiler/instrumentation.h"
 #endif
 
+#include <backend/basic/train/TrainableTensor.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
@@ -34,10 +37,12 @@ TrainableExecutor::TrainableExecutor(
   const compiler::train::TensorRegistries &tensor_regs,
   compiler::train::TrainableCodeMap &&code_map,
   const std::vector<ir::OperationIndex> &forward_order,
-  const std::vector<ir::OperationIndex> &backward_order, const util::TracingCtx *tracing_ctx,
-  const ir::train::LossInfo &loss_info)
+  const std::vector<ir::OperationIndex> &backward_order,
+  const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+  const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &loss_info)
   : _code_map{std::move(code_map)}, _forward_order{std::move(forward_order)},
-    _backward_order{std::move(backward_order)}, _lowered_graph{std::move(lowered_graph)},
+    _backward_order{std::move(backward_order)}, _recompute_segments{recompute_segments},
+    _recompute_points{}, _lowered_graph{std::move(lowered_graph)},
     _backend_contexts{std::move(backend_contexts)},
     _trainable_graph{_lowered_graph->trainable_graph()}, _tensor_regs{std::move(tensor_regs)},
     _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info)
@@ -54,6 +59,18 @@ TrainableExecutor::TrainableExecutor(
   };
   build_tensor_list(_trainable_graph.getInputs(), _input_tensors);
   build_tensor_list(_trainable_graph.getOutputs(), _output_tensors);
+
+  // Each segment is recomputed just before backwarding its first operation
+  for (size_t s = 0; s < _recompute_segments.size(); ++s)
+  {
+    const auto &segment = _recompute_segments[s];
+    const auto it =
+      std::find_if(_backward_order.begin(), _backward_order.end(), [&](const auto &op) {
+        return std::find(segment.begin(), segment.end(), op) != segment.end();
+      });
+    assert(it != _backward_order.end());
+    _recompute_points[*it] = s;
+  }
 }
 
 void TrainableExecutor::forward(const std::vector<backend::IPortableTensor *> &inputs,
@@ -134,7 +151,8 @@ void TrainableExecutor::forwardImpl(const ExecutionObservee &subject, bool train
   }
 }
 
-void TrainableExecutor::backward(const ExecutionOptions &options, uint32_t training_step)
+void TrainableExecutor::backward(const ExecutionOptions &options, uint32_t training_step,
+                                 bool apply_gradients)
 {
   // For thread-safe, use mutex
   // TODO: if all used backends on this executor are thread-safe,
@@ -145,10 +163,11 @@ void TrainableExecutor::backward(const ExecutionOptions &options, uint32_t train
   // Create observee
   ExecutionObservee subject(_observers, options);
 
-  backwardImpl(subject, training_step);
+  backwardImpl(subject, training_step, apply_gradients);
 }
 
-void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t training_step)
+void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t training_step,
+                                     bool apply_gradients)
 {
   if (!subject.isEmpty() && _tracing_ctx)
   {
@@ -157,6 +176,8 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
     subject.notifySubgraphBegin(profiling_subg_index);
     for (auto &&index : _backward_order)
     {
+      recompute(index);
+
       const auto &code = _code_map.at(index);
       if (!code.op->isRequiredForBackward())
       {
@@ -170,7 +191,7 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
       subject.notifyJobBegin(this, profiling_subg_index, code.op_ind, backend);
 
       auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+      tn_seq->backward(training_step, apply_gradients && code.op->isWeightsUpdateEnabled());
 
       subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
     }
@@ -180,6 +201,8 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
   {
     for (auto &&index : _backward_order)
     {
+      recompute(index);
+
       const auto &code = _code_map.at(index);
       if (!code.op->isRequiredForBackward())
       {
@@ -190,11 +213,41 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
       ruy::profiler::ScopeLabel label(code.op->name());
 #endif
       auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+      tn_seq->backward(training_step, apply_gradients && code.op->isWeightsUpdateEnabled());
     }
   }
 }
 
+void TrainableExecutor::applyGradients(uint32_t training_step)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (auto &&index : _backward_order)
+  {
+    const auto &code = _code_map.at(index);
+    if (code.op->isRequiredForBackward() && code.op->isWeightsUpdateEnabled())
+      code.tn_seq->applyGradients(training_step);
+  }
+}
+
+void TrainableExecutor::recompute(const ir::OperationIndex &index)
+{
+  const auto it = _recompute_points.find(index);
+  if (it == _recompute_points.end())
+    return;
+
+  // Activations inside the segment were overwritten by other segments after forwarding, so run it
+  // again from the activations kept at its boundary
+  for (const auto &op_index : _recompute_segments.at(it->second))
+  {
+    const auto &code = _code_map.at(op_index);
+#ifdef RUY_PROFILER
+    ruy::profiler::ScopeLabel label(code.op->name());
+#endif
+    code.tn_seq->forward(code.op->isRequiredForBackward());
+  }
+}
+
 float TrainableExecutor::getLoss(const ir::IOIndex &pred_io_ind) const
 {
   const auto &loss_ind = _trainable_graph.getLossIndex(pred_io_ind);
@@ -213,6 +266,19 @@ float TrainableExecutor::getLoss(const ir::IOIndex &pred_io_ind) const
   return static_cast<float>(sum);
 }
 
+void TrainableExecutor::shareTrainableTensors(const TrainableExecutor &executor)
+{
+  executor.iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *tensor) {
+      auto shared = dynamic_cast<backend::basic::train::TrainableTensor *>(
+        _tensor_regs.getITensor(index));
+      if (shared == nullptr || shared->total_size() != tensor->total_size())
+        throw std::runtime_error{"TrainableExecutor: Trainable tensor " +
+                                 std::to_string(index.value()) + " cannot be shared"};
+      shared->setBuffer(tensor->buffer());
+    });
+}
+
 void TrainableExecutor::iterateTrainableTensors(
   const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)> &fn)
   const
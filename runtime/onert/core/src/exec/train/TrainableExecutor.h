@@ -44,6 +44,7 @@ public:
    * @param lowered_graph LoweredTrainableGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param recompute_segments Segments of operations run again in backwarding
    */
   TrainableExecutor(std::unique_ptr<compiler::train::LoweredTrainableGraph> lowered_graph,
                     backend::train::TrainableBackendContexts &&backend_contexts,
@@ -51,6 +52,7 @@ public:
                     compiler::train::TrainableCodeMap &&code_map,
                     const std::vector<ir::OperationIndex> &forward_order,
                     const std::vector<ir::OperationIndex> &backward_order,
+                    const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
                     const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info);
 
 public:
@@ -87,7 +89,14 @@ public:
   void forward(const std::vector<backend::IPortableTensor *> &inputs,
                const std::vector<backend::IPortableTensor *> &outputs,
                const ExecutionOptions &options, bool training);
-  void backward(const ExecutionOptions &options, uint32_t training_step);
+  /**
+   * @brief Run backwarding
+   * @param apply_gradients If false, gradients are only computed and left in gradient tensors
+   *                        to be applied later by applyGradients()
+   */
+  void backward(const ExecutionOptions &options, uint32_t training_step,
+                bool apply_gradients = true);
+  void applyGradients(uint32_t training_step);
 
   // Used only in Dataflow and Parallel Executors
   void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) final
@@ -99,22 +108,40 @@ public:
 
   float getLoss(const ir::IOIndex &pred_io_ind) const;
 
+  const ir::train::LossInfo &lossInfo() const { return _loss_info; }
+
   void iterateTrainableTensors(
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const;
 
+  backend::ITensor *getGradientTensor(const ir::OperandIndex &index) const
+  {
+    return _tensor_regs.getGradientITensor(index);
+  }
+
+  /**
+   * @brief Make trainable tensors of this executor use buffers of the given executor's ones
+   * @note  Both executors must be compiled from the same model
+   */
+  void shareTrainableTensors(const TrainableExecutor &executor);
+
   backend::train::TrainableBackendContexts &getBackendContexts() { return _backend_contexts; }
 
   const ExecutionOptions &currentOptions() const override { return _current_options; }
 
 private:
   void forwardImpl(const ExecutionObservee &subject, bool training);
-  void backwardImpl(const ExecutionObservee &subject, uint32_t training_step);
+  void backwardImpl(const ExecutionObservee &subject, uint32_t training_step,
+                    bool apply_gradients);
+  void recompute(const ir::OperationIndex &index);
 
 private:
   compiler::train::TrainableCodeMap _code_map;
   std::vector<ir::OperationIndex> _forward_order;
   std::vector<ir::OperationIndex> _backward_order;
+  std::vector<std::vector<ir::OperationIndex>> _recompute_segments;
+  // Operations in backwarding before which their segment is recomputed
+  ir::OperationIndexMap<size_t> _recompute_points;
   ExecObservers _observers;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   std::unique_ptr<compiler::train::LoweredTrainableGraph> _lowered_graph;
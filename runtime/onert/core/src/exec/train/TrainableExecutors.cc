@@ -20,6 +20,9 @@
 
 #include <misc/polymorphic_downcast.h>
 
+#include <exception>
+#include <thread>
+
 namespace onert
 {
 namespace exec
@@ -27,6 +30,61 @@ namespace exec
 namespace train
 {
 
+namespace
+{
+
+// Run fn(0) ... fn(count - 1) in parallel, fn(0) on the calling thread
+void parallelFor(uint32_t count, const std::function<void(uint32_t)> &fn)
+{
+  std::vector<std::exception_ptr> errors(count);
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < count; ++i)
+  {
+    threads.emplace_back([&, i]() {
+      try
+      {
+        fn(i);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+
+  try
+  {
+    fn(0);
+  }
+  catch (...)
+  {
+    errors[0] = std::current_exception();
+  }
+
+  for (auto &&thread : threads)
+    thread.join();
+
+  for (auto &&error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+ir::OperandInfo wholeBatchInfo(const ir::OperandInfo &info, uint32_t num_replicas)
+{
+  auto shape = info.shape();
+  if (shape.rank() == 0)
+    throw std::runtime_error{"TrainableExecutors: I/O without batch cannot be replicated"};
+  shape.dim(0) *= num_replicas;
+
+  auto whole = info;
+  whole.shape(shape);
+  return whole;
+}
+
+} // namespace
+
 void TrainableExecutors::emplace(const ir::ModelIndex &, const ir::SubgraphIndex &subg_index,
                                  std::unique_ptr<IExecutor> exec)
 {
@@ -35,6 +93,28 @@ void TrainableExecutors::emplace(const ir::ModelIndex &, const ir::SubgraphIndex
   _executors.emplace(subg_index, std::move(t_exec));
 }
 
+void TrainableExecutors::emplaceReplica(std::unique_ptr<IExecutor> exec)
+{
+  std::unique_ptr<TrainableExecutor> t_exec{
+    nnfw::misc::polymorphic_downcast<TrainableExecutor *>(exec.release())};
+  t_exec->shareTrainableTensors(*entryExecutor());
+  _replicas.emplace_back(std::move(t_exec));
+  _reducer.reset();
+
+  const auto entry = entryExecutor();
+  _input_infos.clear();
+  for (uint32_t i = 0; i < entry->inputSize(); ++i)
+    _input_infos.emplace_back(wholeBatchInfo(entry->inputInfo(i), numReplicas()));
+  _output_infos.clear();
+  for (uint32_t i = 0; i < entry->outputSize(); ++i)
+    _output_infos.emplace_back(wholeBatchInfo(entry->outputInfo(i), numReplicas()));
+}
+
+TrainableExecutor *TrainableExecutors::replica(uint32_t index) const
+{
+  return index == 0 ? entryExecutor() : _replicas.at(index - 1).get();
+}
+
 TrainableExecutor *TrainableExecutors::at(const ir::ModelIndex &,
                                           const ir::SubgraphIndex &subg_index) const
 {
@@ -47,11 +127,15 @@ uint32_t TrainableExecutors::outputSize() const { return entryExecutor()->output
 
 const ir::OperandInfo &TrainableExecutors::inputInfo(const ir::IOIndex &index) const
 {
+  if (!_replicas.empty())
+    return _input_infos.at(index.value());
   return entryExecutor()->inputInfo(index.value());
 }
 
 const ir::OperandInfo &TrainableExecutors::outputInfo(const ir::IOIndex &index) const
 {
+  if (!_replicas.empty())
+    return _output_infos.at(index.value());
   return entryExecutor()->outputInfo(index.value());
 }
 
@@ -60,11 +144,12 @@ void TrainableExecutors::execute(const ExecutionContext &ctx)
   if (_executors.size() > 1)
     throw std::runtime_error("TrainableExecutors does not support multiple executors yet");
 
-  // UserTensor for Input/Output
-  std::vector<std::unique_ptr<backend::builtin::UserTensor>> tensorpool;
+  // UserTensor for Input/Output of each replica
+  std::vector<std::vector<std::unique_ptr<backend::builtin::UserTensor>>> tensorpools(
+    numReplicas());
 
   // Allocate UserTensor and call executor forward
-  forward(ctx, tensorpool, false);
+  parallelFor(numReplicas(), [&](uint32_t r) { forward(ctx, tensorpools[r], false, r); });
 
   // TODO Support multple executors
 }
@@ -74,20 +159,47 @@ void TrainableExecutors::train(const ExecutionContext &ctx, uint32_t training_st
   if (_executors.size() > 1)
     throw std::runtime_error("TrainableExecutors does not support multiple executors yet");
 
-  // UserTensor for Input/Output
-  std::vector<std::unique_ptr<backend::builtin::UserTensor>> tensorpool;
+  if (_replicas.empty())
+  {
+    // UserTensor for Input/Output
+    std::vector<std::unique_ptr<backend::builtin::UserTensor>> tensorpool;
+
+    // Allocate UserTensor and call executor forward and backward
+    forward(ctx, tensorpool, true);
+    entryExecutor()->backward(ctx.options, training_step);
+    return;
+  }
+
+  // Compute gradients of each part of the batch on its replica
+  std::vector<std::vector<std::unique_ptr<backend::builtin::UserTensor>>> tensorpools(
+    numReplicas());
+  parallelFor(numReplicas(), [&](uint32_t r) {
+    forward(ctx, tensorpools[r], true, r);
+    replica(r)->backward(ctx.options, training_step, false);
+  });
+
+  // Reduce gradients into the entry executor's ones and update shared weights
+  if (!_reducer)
+    _reducer = createReducer();
 
-  // Allocate UserTensor and call executor forward and backward
-  forward(ctx, tensorpool, true);
-  entryExecutor()->backward(ctx.options, training_step);
+  // Gradients of SumOverBatchSize loss are averaged, since each replica computes them over
+  // its own part of the batch
+  const auto reduction_type = entryExecutor()->lossInfo().reduction_type;
+  const float scale =
+    reduction_type == ir::train::LossReductionType::SumOverBatchSize ? 1.f / numReplicas() : 1.f;
+  parallelFor(numReplicas(), [&](uint32_t part) { _reducer->reduce(part, numReplicas(), scale); });
+
+  entryExecutor()->applyGradients(training_step);
 
   // TODO Support multple executors
 }
 
 void TrainableExecutors::forward(
   const ExecutionContext &ctx,
-  std::vector<std::unique_ptr<backend::builtin::UserTensor>> &tensorpool, bool training)
+  std::vector<std::unique_ptr<backend::builtin::UserTensor>> &tensorpool, bool training,
+  uint32_t replica_index)
 {
+  auto executor = replica(replica_index);
   // Input/Output Tensor vector for executor
   std::vector<backend::IPortableTensor *> inputs(ctx.desc.inputs.size());
   std::vector<backend::IPortableTensor *> outputs(ctx.desc.outputs.size());
@@ -101,9 +213,22 @@ void TrainableExecutors::forward(
     if (desc->buffer == nullptr && (desc->size != 0 || desc->info.total_size() != 0))
       throw std::runtime_error{"Input " + std::to_string(i) + "'s buffer is not set."};
 
-    tensorpool.emplace_back(std::make_unique<backend::builtin::UserTensor>(
-      desc->info, desc->layout, const_cast<uint8_t *>(static_cast<const uint8_t *>(desc->buffer)),
-      desc->size));
+    auto buffer = const_cast<uint8_t *>(static_cast<const uint8_t *>(desc->buffer));
+    if (_replicas.empty())
+    {
+      tensorpool.emplace_back(std::make_unique<backend::builtin::UserTensor>(
+        desc->info, desc->layout, buffer, desc->size));
+    }
+    else
+    {
+      // Each replica takes its own part of the batch
+      const auto &info = executor->inputInfo(i);
+      const auto size = info.total_size();
+      if (desc->size < size * numReplicas())
+        throw std::runtime_error{"Input " + std::to_string(i) + "'s buffer is too small."};
+      tensorpool.emplace_back(std::make_unique<backend::builtin::UserTensor>(
+        info, desc->layout, buffer + size * replica_index, size));
+    }
     inputs[i] = tensorpool.back().get();
   }
 
@@ -114,20 +239,66 @@ void TrainableExecutors::forward(
 
     // If training, output buffer may not be used
     // So don't check optional
-    tensorpool.emplace_back(std::make_unique<backend::builtin::UserTensor>(
-      desc->info, desc->layout, static_cast<uint8_t *>(desc->buffer), desc->size));
+    auto buffer = static_cast<uint8_t *>(desc->buffer);
+    if (_replicas.empty())
+    {
+      tensorpool.emplace_back(std::make_unique<backend::builtin::UserTensor>(
+        desc->info, desc->layout, buffer, desc->size));
+    }
+    else
+    {
+      const auto &info = executor->outputInfo(i);
+      const auto size = info.total_size();
+      if (buffer != nullptr && desc->size < size * numReplicas())
+        throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is too small."};
+      tensorpool.emplace_back(std::make_unique<backend::builtin::UserTensor>(
+        info, desc->layout, buffer == nullptr ? nullptr : buffer + size * replica_index,
+        buffer == nullptr ? desc->size : size));
+    }
     outputs[i] = tensorpool.back().get();
   }
 
   // Call forward
-  entryExecutor()->forward(inputs, outputs, ctx.options, training);
+  executor->forward(inputs, outputs, ctx.options, training);
+}
+
+std::unique_ptr<GradientReducer> TrainableExecutors::createReducer() const
+{
+  std::vector<std::vector<float *>> gradients(numReplicas());
+  std::vector<size_t> sizes;
+  entryExecutor()->iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *) {
+      // Gradients of weights that are not updated may not exist
+      if (entryExecutor()->getGradientTensor(index) == nullptr)
+        return;
+
+      for (uint32_t r = 0; r < numReplicas(); ++r)
+      {
+        const auto gradient = replica(r)->getGradientTensor(index);
+        if (gradient == nullptr || gradient->data_type() != ir::DataType::FLOAT32)
+          throw std::runtime_error{"TrainableExecutors: Gradient " +
+                                   std::to_string(index.value()) + " cannot be reduced"};
+        gradients[r].emplace_back(reinterpret_cast<float *>(gradient->buffer()));
+      }
+      sizes.emplace_back(entryExecutor()->getGradientTensor(index)->total_size() / sizeof(float));
+    });
+
+  return std::make_unique<GradientReducer>(std::move(gradients), std::move(sizes));
 }
 
 float TrainableExecutors::getLoss(const ir::IOIndex &index) const
 {
   if (_executors.size() > 1)
     throw std::runtime_error("TrainableExecutors does not support multiple executors yet");
-  return entryExecutor()->getLoss(index);
+
+  float loss = 0.f;
+  for (uint32_t r = 0; r < numReplicas(); ++r)
+    loss += replica(r)->getLoss(index);
+
+  // Loss of each replica is already averaged over its part of the batch
+  if (entryExecutor()->lossInfo().reduction_type == ir::train::LossReductionType::SumOverBatchSize)
+    loss /= numReplicas();
+  return loss;
 }
 
 void TrainableExecutors::iterateTrainableTensors(
@@ -17,6 +17,7 @@
 #ifndef __ONERT_EXEC_TRAIN_TRAINABLE_EXECUTORS_H__
 #define __ONERT_EXEC_TRAIN_TRAINABLE_EXECUTORS_H__
 
+#include "GradientReducer.h"
 #include "TrainableExecutor.h"
 #include "exec/IExecutors.h"
 #include "ir/NNPkg.h"
@@ -59,6 +60,19 @@ public:
 
   TrainableExecutor *entryExecutor() const { return at(ir::ModelIndex{0}, ir::SubgraphIndex{0}); }
 
+  /**
+   * @brief Add a replica of the entry executor to train a part of each batch on
+   *
+   * A batch is split evenly over the entry executor and its replicas, which share trainable
+   * tensors of the entry executor. Gradients of replicas are reduced into the entry executor's
+   * ones, and then applied by the entry executor.
+   *
+   * @param exec Executor compiled from the same model as the entry executor
+   */
+  void emplaceReplica(std::unique_ptr<IExecutor> exec);
+
+  uint32_t numReplicas() const { return 1 + _replicas.size(); }
+
   uint32_t inputSize() const override;
 
   uint32_t outputSize() const override;
@@ -90,11 +104,19 @@ private:
   // tensorpool is not defined as a member variable to avoid memory access conflict between threads.
   void forward(const ExecutionContext &ctx,
                std::vector<std::unique_ptr<backend::builtin::UserTensor>> &tensorpool,
-               bool training);
+               bool training, uint32_t replica_index = 0);
+  TrainableExecutor *replica(uint32_t index) const;
+  std::unique_ptr<GradientReducer> createReducer() const;
 
 private:
   // TODO Append model index to ModelIndex
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<TrainableExecutor>> _executors;
+  // Replicas of the entry executor except itself
+  std::vector<std::unique_ptr<TrainableExecutor>> _replicas;
+  // I/O infos of a whole batch if there are replicas
+  std::vector<ir::OperandInfo> _input_infos;
+  std::vector<ir::OperandInfo> _output_infos;
+  std::unique_ptr<GradientReducer> _reducer;
 };
 
 } // namespace train
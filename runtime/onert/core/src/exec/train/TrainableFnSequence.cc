@@ -39,10 +39,15 @@ void TrainableFnSequence::backward(uint32_t training_step, bool weight_update_en
   }
   if (weight_update_enabled)
   {
-    for (const auto &applier : _appliers)
-    {
-      applier->applyGradient(training_step);
-    }
+    applyGradients(training_step);
+  }
+}
+
+void TrainableFnSequence::applyGradients(uint32_t training_step)
+{
+  for (const auto &applier : _appliers)
+  {
+    applier->applyGradient(training_step);
   }
 }
 
@@ -318,6 +318,14 @@ void OperationDumper::visit(const Reverse &node)
   dumpUnaryInputOp(node, axis);
 }
 
+void OperationDumper::visit(const RmsNorm &node)
+{
+  std::string inputs =
+    "Gamma(" + std::to_string(node.getInputs().at(RmsNorm::Input::GAMMA).value()) + ") Beta(" +
+    std::to_string(node.getInputs().at(RmsNorm::Input::BETA).value()) + ")";
+  dumpUnaryInputOp(node, inputs);
+}
+
 void OperationDumper::visit(const RNN &node)
 {
   VERBOSE(LIR) << "* RNN" << std::endl;
@@ -331,6 +339,14 @@ void OperationDumper::visit(const RNN &node)
                << std::endl;
 }
 
+void OperationDumper::visit(const RoPE &node)
+{
+  std::string inputs =
+    "Sin(" + std::to_string(node.getInputs().at(RoPE::Input::SIN_TABLE).value()) + ") Cos(" +
+    std::to_string(node.getInputs().at(RoPE::Input::COS_TABLE).value()) + ")";
+  dumpUnaryInputOp(node, inputs);
+}
+
 void OperationDumper::visit(const Range &node)
 {
   VERBOSE(LIR) << "* Range" << std::endl;
@@ -119,15 +119,20 @@ void OperationValidator::visit(const operation::BatchMatMul &node)
   const auto rhs_index(node.getInputs().at(operation::BatchMatMul::Input::RHS));
   const auto output_index(node.getOutputs().at(0));
 
-  // Constant lhs and rhs is not implemented yet
-  OP_REQUIRES(!isConstant(lhs_index) && !isConstant(rhs_index));
+  // Allow block quantized weights (lhs: float / rhs: const ggml / out: float)
+  const auto rhs_type = operandType(rhs_index);
+  const bool is_ggml_rhs =
+    rhs_type == DataType::QUANT_GGML_Q4_0 || rhs_type == DataType::QUANT_GGML_Q8_0;
+
+  // Constant lhs is not implemented yet
+  OP_REQUIRES(!isConstant(lhs_index));
 
   // Allow hybrid quantization (lhs: float / rhs: qint8 / out: float)
-  OP_REQUIRES(isValidType(
-    lhs_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  OP_REQUIRES(isValidType(lhs_index, {DataType::FLOAT32, DataType::FLOAT16,
+                                      DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
   OP_REQUIRES(isSameType(lhs_index, rhs_index) ||
               ((operandType(lhs_index) == DataType::FLOAT32) &&
-               (operandType(rhs_index) == DataType::QUANT_INT8_ASYMM)));
+               (rhs_type == DataType::QUANT_INT8_ASYMM || is_ggml_rhs)));
   OP_REQUIRES(isSameType(lhs_index, output_index));
 }
 
@@ -483,8 +488,8 @@ void OperationValidator::visit(const operation::Softmax &node)
   const auto input_index{node.getInputs().at(operation::Softmax::INPUT)};
 
   OP_REQUIRES(isSameType(input_index, output_index));
-  OP_REQUIRES(isValidType(
-    output_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  OP_REQUIRES(isValidType(output_index, {DataType::FLOAT32, DataType::FLOAT16,
+                                         DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
 }
 
 void OperationValidator::visit(const operation::SpaceToBatchND &node)
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/SharedDataStore.h"
+
+namespace onert
+{
+namespace ir
+{
+
+SharedDataStore &SharedDataStore::get()
+{
+  // Never destroyed: data held by other static objects may be released after this
+  static auto store = new SharedDataStore;
+  return *store;
+}
+
+std::shared_ptr<Data>
+SharedDataStore::getOrCreate(const Key &key, const std::function<std::unique_ptr<Data>()> &create)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _entries.find(key);
+  if (it != _entries.end())
+  {
+    if (auto data = it->second.data.lock())
+      return data;
+  }
+
+  // Create under the lock so that sessions loading the same model at the same time share data
+  auto created = create();
+  if (created == nullptr)
+    return nullptr;
+
+  const Data *raw = created.get();
+  std::shared_ptr<Data> data{created.release(), [this, key](Data *ptr) {
+                               release(key, ptr);
+                               delete ptr;
+                             }};
+  _entries[key] = Entry{data, raw};
+  _base_to_key[raw->base()] = key;
+  return data;
+}
+
+bool SharedDataStore::findKey(const uint8_t *base, Key &key) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto base_it = _base_to_key.find(base);
+  if (base_it == _base_to_key.end())
+    return false;
+
+  auto it = _entries.find(base_it->second);
+  if (it == _entries.end() || it->second.data.expired() || it->second.raw->base() != base)
+    return false;
+
+  key = base_it->second;
+  return true;
+}
+
+size_t SharedDataStore::size() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _entries.size();
+}
+
+void SharedDataStore::release(const Key &key, const Data *data)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // The entry may already be replaced by new data of the same key
+  auto it = _entries.find(key);
+  if (it != _entries.end() && it->second.raw == data)
+    _entries.erase(it);
+
+  auto base_it = _base_to_key.find(data->base());
+  if (base_it != _base_to_key.end() && !(base_it->second < key) && !(key < base_it->second))
+    _base_to_key.erase(base_it);
+}
+
+} // namespace ir
+} // namespace onert
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/SharedDataStore.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+
+namespace
+{
+
+SharedDataStore::Key makeKey(uint32_t buffer_index, const std::string &layout = "")
+{
+  SharedDataStore::Key key;
+  key.device = 1;
+  key.inode = 2;
+  key.file_size = 1024;
+  key.mtime_ns = 123456789;
+  key.buffer_index = buffer_index;
+  key.layout = layout;
+  return key;
+}
+
+} // namespace
+
+TEST(SharedDataStoreTest, share)
+{
+  auto &store = SharedDataStore::get();
+  const uint8_t value[4] = {1, 2, 3, 4};
+
+  int num_created = 0;
+  auto create = [&]() -> std::unique_ptr<Data> {
+    ++num_created;
+    return std::make_unique<CachedData>(value, sizeof(value));
+  };
+
+  auto data1 = store.getOrCreate(makeKey(0), create);
+  auto data2 = store.getOrCreate(makeKey(0), create);
+  ASSERT_EQ(num_created, 1);
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(data1->size(), sizeof(value));
+  ASSERT_EQ(data1->base()[3], 4);
+
+  auto data3 = store.getOrCreate(makeKey(1), create);
+  auto data4 = store.getOrCreate(makeKey(0, "layout"), create);
+  ASSERT_EQ(num_created, 3);
+  ASSERT_NE(data1, data3);
+  ASSERT_NE(data1, data4);
+}
+
+TEST(SharedDataStoreTest, layout_of_shape_and_type)
+{
+  auto &store = SharedDataStore::get();
+  const uint8_t value[4] = {1, 2, 3, 4};
+
+  int num_created = 0;
+  auto create = [&]() -> std::unique_ptr<Data> {
+    ++num_created;
+    return std::make_unique<CachedData>(value, sizeof(value));
+  };
+
+  // Same buffer prepared for operands of different shapes or types
+  auto key = makeKey(5, "layout");
+  key.dims = {1, 1, 1, 4};
+  auto data1 = store.getOrCreate(key, create);
+  key.dims = {1, 2, 2, 1};
+  auto data2 = store.getOrCreate(key, create);
+  key.data_type = DataType::INT32;
+  auto data3 = store.getOrCreate(key, create);
+  ASSERT_EQ(num_created, 3);
+  ASSERT_NE(data1, data2);
+  ASSERT_NE(data2, data3);
+
+  auto data4 = store.getOrCreate(key, create);
+  ASSERT_EQ(num_created, 3);
+  ASSERT_EQ(data3, data4);
+}
+
+TEST(SharedDataStoreTest, release)
+{
+  auto &store = SharedDataStore::get();
+  const auto num_data = store.size();
+  const uint8_t value[4] = {1, 2, 3, 4};
+
+  int num_created = 0;
+  auto create = [&]() -> std::unique_ptr<Data> {
+    ++num_created;
+    return std::make_unique<CachedData>(value, sizeof(value));
+  };
+
+  auto data = store.getOrCreate(makeKey(2), create);
+  ASSERT_EQ(store.size(), num_data + 1);
+
+  data.reset();
+  ASSERT_EQ(store.size(), num_data);
+
+  data = store.getOrCreate(makeKey(2), create);
+  ASSERT_EQ(num_created, 2);
+}
+
+TEST(SharedDataStoreTest, findKey)
+{
+  auto &store = SharedDataStore::get();
+  const uint8_t value[4] = {1, 2, 3, 4};
+
+  auto data = store.getOrCreate(makeKey(3, "layout"), [&]() -> std::unique_ptr<Data> {
+    return std::make_unique<CachedData>(value, sizeof(value));
+  });
+
+  SharedDataStore::Key key;
+  ASSERT_TRUE(store.findKey(data->base(), key));
+  ASSERT_EQ(key.buffer_index, 3);
+  ASSERT_EQ(key.layout, "layout");
+}
+
+TEST(SharedDataStoreTest, neg_findKey)
+{
+  auto &store = SharedDataStore::get();
+  const uint8_t value[4] = {1, 2, 3, 4};
+  SharedDataStore::Key key;
+
+  // Data not created by the store
+  CachedData external{value, sizeof(value)};
+  ASSERT_FALSE(store.findKey(external.base(), key));
+
+  // Released data
+  auto data = store.getOrCreate(makeKey(4), [&]() -> std::unique_ptr<Data> {
+    return std::make_unique<CachedData>(value, sizeof(value));
+  });
+  const auto base = data->base();
+  data.reset();
+  ASSERT_FALSE(store.findKey(base, key));
+}
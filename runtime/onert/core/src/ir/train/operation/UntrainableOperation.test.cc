@@ -412,6 +412,14 @@ operation::Reverse generateReverse()
   return operation::Reverse{OperandIndexSequence{1, 2}, OperandIndexSequence{0}};
 }
 
+operation::RmsNorm generateRmsNorm()
+{
+  operation::RmsNorm::Param param;
+  param.epsilon = 1e-6f;
+
+  return operation::RmsNorm{OperandIndexSequence{1, 2, 3}, OperandIndexSequence{0}, param};
+}
+
 operation::RNN generateRNN()
 {
   operation::RNN::Param param;
@@ -420,6 +428,14 @@ operation::RNN generateRNN()
   return operation::RNN{OperandIndexSequence{1, 2, 3, 4, 5}, OperandIndexSequence{0}, param};
 }
 
+operation::RoPE generateRoPE()
+{
+  operation::RoPE::Param param;
+  param.mode = operation::RoPE::RoPEMode::GPT_NEOX;
+
+  return operation::RoPE{OperandIndexSequence{1, 2, 3}, OperandIndexSequence{0}, param};
+}
+
 operation::Select generateSelect()
 {
   return operation::Select{OperandIndexSequence{1, 2, 3}, OperandIndexSequence{0}};
@@ -750,9 +766,15 @@ TEST(UntrainableOperation, testAllOps)
   const auto reverse = generateReverse();
   verifyOp(reverse);
 
+  const auto rms_norm = generateRmsNorm();
+  verifyOp(rms_norm);
+
   const auto rnn = generateRNN();
   verifyOp(rnn);
 
+  const auto rope = generateRoPE();
+  verifyOp(rope);
+
   const auto select = generateSelect();
   verifyOp(select);
 
@@ -1123,12 +1145,24 @@ TEST(UntrainableOperation, neg_TrainableOperationVisitor)
     EXPECT_ANY_THROW(visitor.invoke(*untrainable));
   }
 
+  {
+    const auto rms_norm = generateRmsNorm();
+    auto untrainable = generateUntrainableOperation(rms_norm);
+    EXPECT_ANY_THROW(visitor.invoke(*untrainable));
+  }
+
   {
     const auto rnn = generateRNN();
     auto untrainable = generateUntrainableOperation(rnn);
     EXPECT_ANY_THROW(visitor.invoke(*untrainable));
   }
 
+  {
+    const auto rope = generateRoPE();
+    auto untrainable = generateUntrainableOperation(rope);
+    EXPECT_ANY_THROW(visitor.invoke(*untrainable));
+  }
+
   {
     const auto select = generateSelect();
     auto untrainable = generateUntrainableOperation(select);
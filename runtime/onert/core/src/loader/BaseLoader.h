@@ -20,6 +20,7 @@
 
 #include "ir/Graph.h"
 #include "ir/Shape.h"
+#include "ir/SharedDataStore.h"
 #include "ir/Operations.Include.h"
 
 #include "flatbuffers/flexbuffers.h"
@@ -72,6 +73,7 @@ public:
     : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _model(model), _domain_model{nullptr}
   {
     _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA);
+    _share_const_data = util::getConfigBool(util::config::SHARE_CONST_DATA);
   }
 
   /**
@@ -200,6 +202,10 @@ protected:
   std::unique_ptr<Verifier> _verifier;
   // Boolean flag to use MMAPED_DATA
   bool _use_mmaped_data = false;
+  // Boolean flag to share constant data with other sessions loading the same file
+  bool _share_const_data = false;
+  // Identity of the loaded file to share constant data (buffer_index is not used)
+  ir::SharedDataStore::Key _file_key;
 
   std::unordered_map<uint32_t /* Buffer Index in circle file */, std::shared_ptr<ir::Data>>
     _buf_to_data;
@@ -221,6 +227,12 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
   }
   int size = file_stat.st_size;
 
+  _file_key.device = file_stat.st_dev;
+  _file_key.inode = file_stat.st_ino;
+  _file_key.file_size = file_stat.st_size;
+  _file_key.mtime_ns =
+    static_cast<int64_t>(file_stat.st_mtim.tv_sec) * 1000000000 + file_stat.st_mtim.tv_nsec;
+
   // Map model file into memory region
   _base = static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, _fd, 0));
   if (_base == MAP_FAILED)
@@ -419,22 +431,37 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
         // was already created. Let's reuse the Data
         data_obj = buffer_found->second;
       }
-      else if (_use_mmaped_data)
-      {
-        data_obj = std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
-                                                    unaligned_offset_start, data_size);
-        _buf_to_data[buf_idx] = data_obj;
-      }
       else
       {
-        size_t offset = unaligned_offset_start - aligned_offset_start;
-        uint8_t *mmap_base = static_cast<uint8_t *>(
-          mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
-
-        data_obj = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
+        auto create_data = [&]() -> std::unique_ptr<ir::Data> {
+          if (_use_mmaped_data)
+          {
+            return std::make_unique<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
+                                                    unaligned_offset_start, data_size);
+          }
+
+          size_t offset = unaligned_offset_start - aligned_offset_start;
+          uint8_t *mmap_base = static_cast<uint8_t *>(
+            mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
+
+          auto cached_data = std::make_unique<ir::CachedData>(mmap_base + offset, data_size);
+
+          munmap(mmap_base, mmap_size);
+          return cached_data;
+        };
+
+        if (_share_const_data)
+        {
+          // Other sessions loading the same file attach to the data instead of copying it
+          auto key = _file_key;
+          key.buffer_index = buf_idx;
+          data_obj = ir::SharedDataStore::get().getOrCreate(key, create_data);
+        }
+        else
+        {
+          data_obj = create_data();
+        }
         _buf_to_data[buf_idx] = data_obj;
-
-        munmap(mmap_base, mmap_size);
       }
     }
     subg.setOperandValue(operand_index, std::move(data_obj));
@@ -70,6 +70,8 @@ protected:
   void loadInstanceNorm(const Operator *op, ir::Graph &subg);
   void loadBCQFullyConnected(const Operator *op, ir::Graph &subg);
   void loadBCQGather(const Operator *op, ir::Graph &subg);
+  void loadRmsNorm(const Operator *op, ir::Graph &subg);
+  void loadRoPE(const Operator *op, ir::Graph &subg);
 
 public:
   using BaseLoader::BaseLoader;
@@ -150,6 +152,12 @@ private:
       case circle::BuiltinOperator::BuiltinOperator_BCQ_GATHER:
         loadBCQGather(op, subg);
         return;
+      case circle::BuiltinOperator::BuiltinOperator_RMS_NORM:
+        loadRmsNorm(op, subg);
+        return;
+      case circle::BuiltinOperator::BuiltinOperator_ROPE:
+        loadRoPE(op, subg);
+        return;
       default:
         BaseLoader::loadOperation(op, subg);
         return;
@@ -192,6 +200,50 @@ void CircleLoader::loadInstanceNorm(const Operator *op, ir::Graph &subg)
   subg.addOperation(std::move(new_op));
 }
 
+void CircleLoader::loadRmsNorm(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::RmsNorm::Param param;
+  const auto *options = op->builtin_options_as_RmsNormOptions();
+
+  // Use default value 1e-6 if value of epsilon is zero
+  param.epsilon = options->epsilon() == 0.f ? 1e-6 : options->epsilon();
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::RmsNorm(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
+void CircleLoader::loadRoPE(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::RoPE::Param param;
+  const auto *options = op->builtin_options_as_RoPEOptions();
+
+  switch (options->mode())
+  {
+    case circle::RoPEMode::RoPEMode_GPT_NEOX:
+      param.mode = ir::operation::RoPE::RoPEMode::GPT_NEOX;
+      break;
+    case circle::RoPEMode::RoPEMode_GPT_J:
+      param.mode = ir::operation::RoPE::RoPEMode::GPT_J;
+      break;
+    default:
+      throw std::runtime_error("Unsupported RoPE mode: " +
+                               std::string(circle::EnumNameRoPEMode(options->mode())));
+  }
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::RoPE(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 void CircleLoader::loadBCQGather(const Operator *op, ir::Graph &subg)
 {
   ir::OperandIndexSequence inputs;
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+
+// Two-model nnpackage: model 0 computes (in + in), and model 1 computes (in * in) of it
+class PipelineTest : public ::testing::Test
+{
+protected:
+  static constexpr uint32_t kSize = 4;
+  static constexpr uint32_t kNumInputs = 5;
+
+  void SetUp() override
+  {
+    _package_dir = ::testing::TempDir() + "pipeline_test";
+    mkdir(_package_dir.c_str(), 0755);
+    mkdir((_package_dir + "/metadata").c_str(), 0755);
+
+    writeModel("add.circle", &CircleGen::addOperatorAdd);
+    writeModel("mul.circle", &CircleGen::addOperatorMul);
+
+    std::ofstream manifest(_package_dir + "/metadata/MANIFEST");
+    manifest << R"({
+  "major-version" : "1",
+  "minor-version" : "3",
+  "patch-version" : "0",
+  "configs"       : [ ],
+  "models"        : [ "add.circle", "mul.circle" ],
+  "model-types"   : [ "circle", "circle" ],
+  "pkg-inputs"    : [ "0:0:0" ],
+  "pkg-outputs"   : [ "1:0:0" ],
+  "model-connect" : [ { "from" : "0:0:0", "to" : [ "1:0:0" ] } ]
+})";
+  }
+
+  void TearDown() override
+  {
+    std::remove((_package_dir + "/metadata/MANIFEST").c_str());
+    std::remove((_package_dir + "/metadata").c_str());
+    std::remove((_package_dir + "/add.circle").c_str());
+    std::remove((_package_dir + "/mul.circle").c_str());
+    std::remove(_package_dir.c_str());
+  }
+
+  nnfw_session *createSession()
+  {
+    nnfw_session *session = nullptr;
+    EXPECT_EQ(NNFW_STATUS_NO_ERROR, nnfw_create_session(&session));
+    EXPECT_EQ(NNFW_STATUS_NO_ERROR, nnfw_load_model_from_file(session, _package_dir.c_str()));
+    EXPECT_EQ(NNFW_STATUS_NO_ERROR, nnfw_set_available_backends(session, "cpu"));
+    return session;
+  }
+
+  static std::vector<float> input(uint32_t n)
+  {
+    std::vector<float> values(kSize);
+    for (uint32_t i = 0; i < kSize; ++i)
+      values[i] = static_cast<float>(n) - static_cast<float>(i) * 0.5f;
+    return values;
+  }
+
+  static void runSequential(nnfw_session *session, std::vector<float> &in,
+                            std::vector<float> &out)
+  {
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, in.data(),
+                                       in.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, out.data(),
+                                        out.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_run(session));
+  }
+
+private:
+  using AddOperator = uint32_t (CircleGen::*)(const CircleGen::OperatorParams &,
+                                              circle::ActivationFunctionType);
+
+  void writeModel(const std::string &name, AddOperator add_operator)
+  {
+    CircleGen cgen;
+    const int in = cgen.addTensor({{1, kSize}, circle::TensorType::TensorType_FLOAT32});
+    const int out = cgen.addTensor({{1, kSize}, circle::TensorType::TensorType_FLOAT32});
+    (cgen.*add_operator)({{in, in}, {out}}, circle::ActivationFunctionType_NONE);
+    cgen.setInputsAndOutputs({in}, {out});
+
+    auto cbuf = cgen.finish();
+    std::ofstream file(_package_dir + "/" + name, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(cbuf.buffer()), cbuf.size());
+  }
+
+private:
+  std::string _package_dir;
+};
+
+} // namespace
+
+TEST_F(PipelineTest, SameAsSequential)
+{
+  // Outputs of sequential runs
+  std::vector<std::vector<float>> expected;
+  {
+    nnfw_session *session = createSession();
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+    for (uint32_t n = 0; n < kNumInputs; ++n)
+    {
+      auto in = input(n);
+      std::vector<float> out(kSize);
+      ASSERT_NO_FATAL_FAILURE(runSequential(session, in, out));
+      for (uint32_t i = 0; i < kSize; ++i)
+        EXPECT_FLOAT_EQ((in[i] + in[i]) * (in[i] + in[i]), out[i]);
+      expected.emplace_back(out);
+    }
+    NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+  }
+
+  nnfw_session *session = createSession();
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_pipeline(session, nullptr));
+
+  std::vector<std::vector<float>> actual;
+  auto pop = [&]() {
+    std::vector<void *> outputs;
+    NNFW_ENSURE_SUCCESS(nnfw_pop_pipeline_output(session, &outputs));
+    ASSERT_EQ(1u, outputs.size());
+    const auto begin = reinterpret_cast<const float *>(outputs[0]);
+    actual.emplace_back(begin, begin + kSize);
+    delete[] reinterpret_cast<uint8_t *>(outputs[0]);
+  };
+  for (uint32_t n = 0; n < kNumInputs; ++n)
+  {
+    auto in = input(n);
+    std::vector<void *> inputs{in.data()};
+    std::vector<uint32_t> lengths{static_cast<uint32_t>(in.size() * sizeof(float))};
+    NNFW_ENSURE_SUCCESS(nnfw_push_pipeline_input(session, &inputs, &lengths));
+    // Keep at most two inferences in flight, below the default depth
+    if (n >= 1)
+      ASSERT_NO_FATAL_FAILURE(pop());
+  }
+
+  // Empty inputs finish the input stream
+  std::vector<void *> no_inputs;
+  std::vector<uint32_t> no_lengths;
+  NNFW_ENSURE_SUCCESS(nnfw_push_pipeline_input(session, &no_inputs, &no_lengths));
+  ASSERT_NO_FATAL_FAILURE(pop());
+
+  // Nothing is left after all outputs are popped
+  std::vector<void *> outputs;
+  NNFW_ENSURE_SUCCESS(nnfw_pop_pipeline_output(session, &outputs));
+  EXPECT_TRUE(outputs.empty());
+
+  ASSERT_EQ(expected.size(), actual.size());
+  for (uint32_t n = 0; n < expected.size(); ++n)
+    for (uint32_t i = 0; i < kSize; ++i)
+      EXPECT_FLOAT_EQ(expected[n][i], actual[n][i]) << "Input " << n << " #" << i;
+
+  // The session can run sequentially after the pipeline is finished
+  auto in = input(0);
+  std::vector<float> out(kSize);
+  ASSERT_NO_FATAL_FAILURE(runSequential(session, in, out));
+  for (uint32_t i = 0; i < kSize; ++i)
+    EXPECT_FLOAT_EQ(expected[0][i], out[i]);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
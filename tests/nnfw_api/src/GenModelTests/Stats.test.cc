@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <vector>
+
+namespace
+{
+
+// A model of Add and Mul on cpu, whose latencies are recorded by NNFW_RUN_CONFIG_STATS
+class StatsTest : public ::testing::Test
+{
+protected:
+  static constexpr uint32_t kSize = 4;
+  static constexpr uint32_t kNumOperations = 2;
+
+  void SetUp() override
+  {
+    CircleGen cgen;
+    int in = cgen.addTensor({{1, kSize}, circle::TensorType::TensorType_FLOAT32});
+    int add_out = cgen.addTensor({{1, kSize}, circle::TensorType::TensorType_FLOAT32});
+    int out = cgen.addTensor({{1, kSize}, circle::TensorType::TensorType_FLOAT32});
+    cgen.addOperatorAdd({{in, in}, {add_out}}, circle::ActivationFunctionType_NONE);
+    cgen.addOperatorMul({{add_out, add_out}, {out}}, circle::ActivationFunctionType_NONE);
+    cgen.setInputsAndOutputs({in}, {out});
+    _cbuf = cgen.finish();
+
+    NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session));
+    NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, _cbuf.buffer(), _cbuf.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, _input.data(),
+                                       _input.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, _output.data(),
+                                        _output.size() * sizeof(float)));
+  }
+
+  void TearDown() override { NNFW_ENSURE_SUCCESS(nnfw_close_session(_session)); }
+
+  void run(uint32_t times)
+  {
+    for (uint32_t i = 0; i < times; ++i)
+      NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  }
+
+  static void expectValid(const nnfw_latency_stats &stats)
+  {
+    EXPECT_LE(stats.p50, stats.p99);
+    EXPECT_GT(stats.total, 0);
+  }
+
+protected:
+  nnfw_session *_session = nullptr;
+
+private:
+  CircleBuffer _cbuf;
+  std::vector<float> _input = std::vector<float>(kSize, 1.f);
+  std::vector<float> _output = std::vector<float>(kSize);
+};
+
+} // namespace
+
+TEST_F(StatsTest, run_stats)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, nullptr));
+  ASSERT_NO_FATAL_FAILURE(run(3));
+
+  nnfw_latency_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_run_stats(_session, &stats));
+  EXPECT_EQ(stats.count, 3);
+  expectValid(stats);
+}
+
+TEST_F(StatsTest, operation_stats)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, "1"));
+  ASSERT_NO_FATAL_FAILURE(run(3));
+
+  for (uint32_t index = 0; index < kNumOperations; ++index)
+  {
+    nnfw_latency_stats stats;
+    NNFW_ENSURE_SUCCESS(nnfw_get_operation_stats(_session, index, &stats));
+    EXPECT_EQ(stats.count, 3) << "Operation " << index;
+    expectValid(stats);
+  }
+}
+
+TEST_F(StatsTest, backend_stats)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, "1"));
+  ASSERT_NO_FATAL_FAILURE(run(3));
+
+  // Histograms of all operations on the backend are merged
+  nnfw_latency_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_backend_stats(_session, "cpu", &stats));
+  EXPECT_EQ(stats.count, 3 * kNumOperations);
+  expectValid(stats);
+
+  NNFW_ENSURE_SUCCESS(nnfw_get_backend_stats(_session, "acl_cl", &stats));
+  EXPECT_EQ(stats.count, 0);
+}
+
+TEST_F(StatsTest, sampling)
+{
+  // Runs 0 and 2 are recorded
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, "2"));
+  ASSERT_NO_FATAL_FAILURE(run(4));
+
+  nnfw_latency_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_run_stats(_session, &stats));
+  EXPECT_EQ(stats.count, 2);
+}
+
+TEST_F(StatsTest, sampling_by_default)
+{
+  // STATS_SAMPLING records the first of every 100 runs without NNFW_RUN_CONFIG_STATS
+  ASSERT_NO_FATAL_FAILURE(run(3));
+
+  nnfw_latency_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_run_stats(_session, &stats));
+  EXPECT_EQ(stats.count, 1);
+  NNFW_ENSURE_SUCCESS(nnfw_get_operation_stats(_session, 0, &stats));
+  EXPECT_EQ(stats.count, 1);
+}
+
+TEST_F(StatsTest, neg_nothing_recorded)
+{
+  nnfw_latency_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_run_stats(_session, &stats));
+  EXPECT_EQ(stats.count, 0);
+  // Operation histograms are allocated by the first recorded run
+  EXPECT_EQ(nnfw_get_operation_stats(_session, 0, &stats), NNFW_STATUS_ERROR);
+}
+
+TEST_F(StatsTest, neg_no_such_operation)
+{
+  ASSERT_NO_FATAL_FAILURE(run(1));
+
+  nnfw_latency_stats stats;
+  EXPECT_EQ(nnfw_get_operation_stats(_session, kNumOperations, &stats), NNFW_STATUS_ERROR);
+}
+
+TEST_F(StatsTest, neg_invalid_interval)
+{
+  EXPECT_EQ(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, "0"), NNFW_STATUS_ERROR);
+  EXPECT_EQ(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, "-1"), NNFW_STATUS_ERROR);
+}
+
+TEST_F(StatsTest, neg_null_arguments)
+{
+  nnfw_latency_stats stats;
+  EXPECT_EQ(nnfw_get_run_stats(nullptr, &stats), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_run_stats(_session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_operation_stats(nullptr, 0, &stats), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_operation_stats(_session, 0, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_backend_stats(nullptr, "cpu", &stats), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_backend_stats(_session, nullptr, &stats), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_backend_stats(_session, "cpu", nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+
+using Configs = std::vector<std::pair<std::string, std::string>>;
+
+struct TrainResult
+{
+  // Loss of each epoch
+  std::vector<float> losses;
+  // Weights and biases after training, in the order of buffers
+  std::vector<std::vector<float>> params;
+};
+
+// Training with an option that only changes how training runs (e.g. recomputation, replicas) must
+// give the same losses and trained parameters as training without it. The model is a chain of
+// FullyConnected and Relu so that there are activations to recompute.
+class TrainEquivalence : public ::testing::Test
+{
+protected:
+  static constexpr int32_t kBatchSize = 2;
+  static constexpr int32_t kInput = 8;
+  static constexpr int32_t kHidden = 16;
+  static constexpr int32_t kOutput = 4;
+  static constexpr int32_t kNumLayers = 4;
+  static constexpr uint32_t kNumSteps = 2;
+  static constexpr uint32_t kNumEpochs = 3;
+
+  void SetUp() override
+  {
+    CircleGen cgen;
+
+    int prev = cgen.addTensor({{kBatchSize, kInput}, circle::TensorType::TensorType_FLOAT32});
+    const int in = prev;
+    int32_t prev_size = kInput;
+    for (int32_t layer = 0; layer < kNumLayers; ++layer)
+    {
+      const bool last = (layer == kNumLayers - 1);
+      const int32_t size = last ? kOutput : kHidden;
+
+      const uint32_t weight_buf = cgen.addBuffer(sequence(size * prev_size, layer));
+      const uint32_t bias_buf = cgen.addBuffer(sequence(size, layer + kNumLayers));
+      _param_bufs.emplace_back(weight_buf);
+      _param_bufs.emplace_back(bias_buf);
+
+      const int weight =
+        cgen.addTensor({{size, prev_size}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+      const int bias = cgen.addTensor({{size}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+      const int fc_out =
+        cgen.addTensor({{kBatchSize, size}, circle::TensorType::TensorType_FLOAT32});
+      cgen.addOperatorFullyConnected({{prev, weight, bias}, {fc_out}});
+      prev = fc_out;
+      if (!last)
+      {
+        const int relu_out =
+          cgen.addTensor({{kBatchSize, size}, circle::TensorType::TensorType_FLOAT32});
+        cgen.addOperatorRelu({{fc_out}, {relu_out}});
+        prev = relu_out;
+      }
+      prev_size = size;
+    }
+    cgen.setInputsAndOutputs({in}, {prev});
+
+    _model_path = ::testing::TempDir() + "train_equivalence.circle";
+    auto cbuf = cgen.finish();
+    std::ofstream file(_model_path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(cbuf.buffer()), cbuf.size());
+  }
+
+  void TearDown() override { std::remove(_model_path.c_str()); }
+
+  void train(const Configs &configs, TrainResult &result)
+  {
+    nnfw_session *session = nullptr;
+    NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+    NNFW_ENSURE_SUCCESS(nnfw_load_model_from_file(session, _model_path.c_str()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+    for (const auto &[key, value] : configs)
+      NNFW_ENSURE_SUCCESS(nnfw_set_config(session, key.c_str(), value.c_str()));
+
+    nnfw_train_info tri;
+    tri.learning_rate = 0.01f;
+    tri.batch_size = kBatchSize;
+    tri.loss_info.loss = NNFW_TRAIN_LOSS_MEAN_SQUARED_ERROR;
+    tri.loss_info.reduction_type = NNFW_TRAIN_LOSS_REDUCTION_SUM_OVER_BATCH_SIZE;
+    tri.opt = NNFW_TRAIN_OPTIMIZER_SGD;
+    tri.num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_ALL;
+    NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+    NNFW_ENSURE_SUCCESS(nnfw_train_prepare(session));
+
+    nnfw_tensorinfo in_info;
+    NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &in_info));
+    nnfw_tensorinfo out_info;
+    NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(session, 0, &out_info));
+
+    for (uint32_t epoch = 0; epoch < kNumEpochs; ++epoch)
+    {
+      float loss_sum = 0.f;
+      for (uint32_t step = 0; step < kNumSteps; ++step)
+      {
+        auto input = sequence(kBatchSize * kInput, 2 * kNumLayers + step);
+        auto expected = sequence(kBatchSize * kOutput, 3 * kNumLayers + step);
+        NNFW_ENSURE_SUCCESS(nnfw_train_set_input(session, 0, input.data(), &in_info));
+        NNFW_ENSURE_SUCCESS(nnfw_train_set_expected(session, 0, expected.data(), &out_info));
+        NNFW_ENSURE_SUCCESS(nnfw_train(session, true));
+
+        float loss = 0.f;
+        NNFW_ENSURE_SUCCESS(nnfw_train_get_loss(session, 0, &loss));
+        loss_sum += loss;
+      }
+      result.losses.emplace_back(loss_sum / kNumSteps);
+    }
+
+    const auto export_path = _model_path + ".trained";
+    NNFW_ENSURE_SUCCESS(nnfw_train_export_circle(session, export_path.c_str()));
+    NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+
+    std::ifstream file(export_path, std::ios::binary);
+    std::vector<char> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    std::remove(export_path.c_str());
+
+    const auto model = circle::GetModel(data.data());
+    ASSERT_NE(model, nullptr);
+    for (const auto buf_index : _param_bufs)
+    {
+      const auto buffer = model->buffers()->Get(buf_index);
+      ASSERT_NE(buffer->data(), nullptr);
+      const auto begin = reinterpret_cast<const float *>(buffer->data()->data());
+      result.params.emplace_back(begin, begin + buffer->data()->size() / sizeof(float));
+    }
+  }
+
+  static void expectSame(const TrainResult &expected, const TrainResult &actual)
+  {
+    ASSERT_EQ(expected.losses.size(), actual.losses.size());
+    for (uint32_t i = 0; i < expected.losses.size(); ++i)
+      EXPECT_NEAR(expected.losses[i], actual.losses[i], 1e-5) << "Loss of epoch " << i + 1;
+
+    ASSERT_EQ(expected.params.size(), actual.params.size());
+    for (uint32_t i = 0; i < expected.params.size(); ++i)
+    {
+      ASSERT_EQ(expected.params[i].size(), actual.params[i].size());
+      for (uint32_t j = 0; j < expected.params[i].size(); ++j)
+        EXPECT_NEAR(expected.params[i][j], actual.params[i][j], 1e-5)
+          << "Parameter " << i << " #" << j;
+    }
+  }
+
+  // Small values in [-0.25, 0.25] of both signs, varied by seed
+  static std::vector<float> sequence(int32_t size, int32_t seed)
+  {
+    std::vector<float> values(size);
+    for (int32_t i = 0; i < size; ++i)
+      values[i] = static_cast<float>((i * 7 + seed * 5) % 11 - 5) * 0.05f;
+    return values;
+  }
+
+private:
+  std::string _model_path;
+  std::vector<uint32_t> _param_bufs;
+};
+
+} // namespace
+
+TEST_F(TrainEquivalence, Recompute)
+{
+  TrainResult reference;
+  ASSERT_NO_FATAL_FAILURE(train({}, reference));
+
+  // Budget 0 splits the forward pass into as many segments as possible
+  TrainResult recomputed;
+  ASSERT_NO_FATAL_FAILURE(train({{"TRAIN_RECOMPUTE_BUDGET", "0"}}, recomputed));
+
+  expectSame(reference, recomputed);
+}
+
+TEST_F(TrainEquivalence, Replicas)
+{
+  TrainResult reference;
+  ASSERT_NO_FATAL_FAILURE(train({}, reference));
+
+  // Each replica trains one sample of the batch
+  TrainResult replicated;
+  ASSERT_NO_FATAL_FAILURE(train({{"TRAIN_NUM_REPLICAS", "2"}}, replicated));
+
+  expectSame(reference, replicated);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include "common.h"
+
+#include <memory>
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_Q4_0)
+{
+  CircleGen cgen;
+
+  // lhs [2, 2, 64] x rhs [1, 4, 64] with adj_y, where rhs is broadcast over the lhs batch.
+  // Integer rhs in [-8, 7] with -8 in each block and lhs with 127 in each block
+  // are quantized to Q4_0 (rhs) and Q8_0 (lhs) without error
+  const uint32_t batch = 2;
+  const uint32_t rows = 2;
+  const uint32_t cols = 4;
+  const uint32_t depth = 64;
+  std::vector<float> rhs_data(cols * depth);
+  for (uint32_t i = 0; i < rhs_data.size(); i++)
+    rhs_data[i] = static_cast<float>((i / depth + i) % 16) - 8;
+  std::vector<float> lhs_data(batch * rows * depth);
+  for (uint32_t i = 0; i < lhs_data.size(); i++)
+    lhs_data[i] = (i % 4 == 0) ? 127 : static_cast<float>((i / depth + i) % 7) - 3;
+  std::vector<float> output_data(batch * rows * cols, 0.f);
+  for (uint32_t m = 0; m < batch * rows; m++)
+  {
+    for (uint32_t n = 0; n < cols; n++)
+    {
+      for (uint32_t k = 0; k < depth; k++)
+        output_data[m * cols + n] += lhs_data[m * depth + k] * rhs_data[n * depth + k];
+    }
+  }
+
+  auto rhs_vector = quantData(rhs_data, circle::TensorType::TensorType_GGML_Q4_0);
+  uint32_t rhs_buf = cgen.addBuffer(rhs_vector);
+  int lhs = cgen.addTensor({{batch, rows, depth}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, cols, depth}, circle::TensorType::TensorType_GGML_Q4_0, rhs_buf});
+  int output = cgen.addTensor({{batch, rows, cols}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {output}}, false, true);
+  cgen.setInputsAndOutputs({lhs}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({lhs_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_Q8_0)
+{
+  CircleGen cgen;
+
+  // lhs [2, 1, 32] x rhs [2, 3, 32] with adj_y, batch by batch.
+  // Integer rhs and lhs with 127 in each block are quantized to Q8_0 without error
+  const uint32_t batch = 2;
+  const uint32_t cols = 3;
+  const uint32_t depth = 32;
+  std::vector<float> rhs_data(batch * cols * depth);
+  for (uint32_t i = 0; i < rhs_data.size(); i++)
+    rhs_data[i] = (i % depth == i / depth) ? 127 : static_cast<float>(i % 9) - 4;
+  std::vector<float> lhs_data(batch * depth);
+  for (uint32_t i = 0; i < lhs_data.size(); i++)
+    lhs_data[i] = (i % 8 == 0) ? 127 : static_cast<float>(i % 5) - 2;
+  std::vector<float> output_data(batch * cols, 0.f);
+  for (uint32_t b = 0; b < batch; b++)
+  {
+    for (uint32_t n = 0; n < cols; n++)
+    {
+      for (uint32_t k = 0; k < depth; k++)
+        output_data[b * cols + n] +=
+          lhs_data[b * depth + k] * rhs_data[(b * cols + n) * depth + k];
+    }
+  }
+
+  auto rhs_vector = quantData(rhs_data, circle::TensorType::TensorType_GGML_Q8_0);
+  uint32_t rhs_buf = cgen.addBuffer(rhs_vector);
+  int lhs = cgen.addTensor({{batch, 1, depth}, circle::TensorType::TensorType_FLOAT32});
+  int rhs =
+    cgen.addTensor({{batch, cols, depth}, circle::TensorType::TensorType_GGML_Q8_0, rhs_buf});
+  int output = cgen.addTensor({{batch, 1, cols}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {output}}, false, true);
+  cgen.setInputsAndOutputs({lhs}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({lhs_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_BatchMatMul_Q4_0_NoAdjY)
+{
+  CircleGen cgen;
+
+  // ggml blocks run along the last dimension of rhs, which must be the reduction axis
+  std::vector<float> rhs_data(32 * 4);
+  auto rhs_vector = quantData(rhs_data, circle::TensorType::TensorType_GGML_Q4_0);
+  uint32_t rhs_buf = cgen.addBuffer(rhs_vector);
+  int lhs = cgen.addTensor({{1, 2, 32}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, 32, 4}, circle::TensorType::TensorType_GGML_Q4_0, rhs_buf});
+  int output = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {output}}, false, false);
+  cgen.setInputsAndOutputs({lhs}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_BatchMatMul_Q4_0_InvalidLhsType)
+{
+  CircleGen cgen;
+
+  // Only float lhs is allowed with GGML rhs
+  std::vector<float> rhs_data(4 * 32);
+  auto rhs_vector = quantData(rhs_data, circle::TensorType::TensorType_GGML_Q4_0);
+  uint32_t rhs_buf = cgen.addBuffer(rhs_vector);
+  int lhs = cgen.addTensor({{1, 2, 32}, circle::TensorType::TensorType_UINT8}, 0.1, 0);
+  int rhs = cgen.addTensor({{1, 4, 32}, circle::TensorType::TensorType_GGML_Q4_0, rhs_buf});
+  int output = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_UINT8}, 0.1, 0);
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {output}}, false, true);
+  cgen.setInputsAndOutputs({lhs}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
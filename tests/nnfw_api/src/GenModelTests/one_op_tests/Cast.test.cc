@@ -136,6 +136,45 @@ TEST_F(GenModelTest, OneOp_Cast_AfterEqual)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_Cast_Float32ToFloat16)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int half = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT16});
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorCast({{in}, {half}}, circle::TensorType::TensorType_FLOAT32,
+                       circle::TensorType::TensorType_FLOAT16);
+  cgen.addOperatorCast({{half}, {out}}, circle::TensorType::TensorType_FLOAT16,
+                       circle::TensorType::TensorType_FLOAT32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // 0.1 is rounded to 0.0999755859375 in half precision
+  _context->addTestCase(uniformTCD<float>({{1, -0.5, 0.1, 1000}}, {{1, -0.5, 0.1, 1000}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Cast_Float16ToInt32)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int half = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT16});
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT32});
+  cgen.addOperatorCast({{in}, {half}}, circle::TensorType::TensorType_FLOAT32,
+                       circle::TensorType::TensorType_FLOAT16);
+  cgen.addOperatorCast({{half}, {out}}, circle::TensorType::TensorType_FLOAT16,
+                       circle::TensorType::TensorType_INT32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, neg_OneOp_Cast_InvalidInputCount0)
 {
   CircleGen cgen;
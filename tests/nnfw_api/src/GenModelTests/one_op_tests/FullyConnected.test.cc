@@ -16,6 +16,8 @@
 
 #include "GenModelTest.h"
 
+#include "common.h"
+
 #include <memory>
 
 TEST_F(GenModelTest, OneOp_FullyConnected)
@@ -178,6 +180,47 @@ TEST_F(GenModelTest, OneOp_FullyConnected_OptionalBias)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_FullyConnected_Float16)
+{
+  // nnfw API has no half precision tensor, so the half precision fully connected runs between
+  // casts
+  CircleGen cgen;
+  // clang-format off
+  std::vector<float> weight_data{ -1,  4,  0,  3,
+                                   1,  4,  0, -1,
+                                   3, -1,  0, -1,
+                                  -1,  3,  4,  4,
+                                   4,  0,  4,  0,
+                                   4,  1, -1,  1,
+                                   2,  2, -2, -1,
+                                   4, -1, -2,  3 };
+  // clang-format on
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int input = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor({{8, 4}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int half_input = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT16});
+  int half_weight = cgen.addTensor({{8, 4}, circle::TensorType::TensorType_FLOAT16});
+  int half_output = cgen.addTensor({{2, 8}, circle::TensorType::TensorType_FLOAT16});
+  int output = cgen.addTensor({{2, 8}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorCast({{input}, {half_input}}, circle::TensorType::TensorType_FLOAT32,
+                       circle::TensorType::TensorType_FLOAT16);
+  cgen.addOperatorCast({{weight}, {half_weight}}, circle::TensorType::TensorType_FLOAT32,
+                       circle::TensorType::TensorType_FLOAT16);
+  cgen.addOperatorFullyConnected(
+    {{half_input, half_weight, -1 /* Optional bias */}, {half_output}});
+  cgen.addOperatorCast({{half_output}, {output}}, circle::TensorType::TensorType_FLOAT16,
+                       circle::TensorType::TensorType_FLOAT32);
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{3, -1, -1, 1, -2, 0, -2, 1}},
+                      {{-4, -2, 9, -6, 8, 13, 5, 18, 5, -3, -7, -2, -16, -5, -1, -1}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, neg_OneOp_FullyConnected_NoBias)
 {
   CircleGen cgen;
@@ -207,3 +250,140 @@ TEST_F(GenModelTest, neg_OneOp_FullyConnected_NoBias)
 
   SUCCEED();
 }
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Q4_0)
+{
+  CircleGen cgen;
+
+  // Integer weights in [-8, 7] with -8 in each block and input with 127 in each block
+  // are quantized to Q4_0 (weights) and Q8_0 (input) without error
+  const uint32_t num_units = 4;
+  const uint32_t input_size = 64;
+  std::vector<float> weight_data(num_units * input_size);
+  for (uint32_t i = 0; i < weight_data.size(); i++)
+    weight_data[i] = static_cast<float>((i / input_size + i) % 16) - 8;
+  std::vector<float> input_data(input_size);
+  for (uint32_t i = 0; i < input_data.size(); i++)
+    input_data[i] = (i % 4 == 0) ? 127 : static_cast<float>(i % 7) - 3;
+  std::vector<float> bias_data{1, -1, 2, -2};
+  std::vector<float> output_data(num_units);
+  for (uint32_t n = 0; n < num_units; n++)
+  {
+    output_data[n] = bias_data[n];
+    for (uint32_t k = 0; k < input_size; k++)
+      output_data[n] += weight_data[n * input_size + k] * input_data[k];
+  }
+
+  auto weight_vector = quantData(weight_data, circle::TensorType::TensorType_GGML_Q4_0);
+  uint32_t weight_buf = cgen.addBuffer(weight_vector);
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, input_size}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor(
+    {{num_units, input_size}, circle::TensorType::TensorType_GGML_Q4_0, weight_buf});
+  int bias = cgen.addTensor({{num_units}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int output = cgen.addTensor({{1, num_units}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({input_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Q4_0_FlattenInput)
+{
+  CircleGen cgen;
+
+  // Input [2, 32] is flattened to [1, 64] by input size of weights
+  const uint32_t num_units = 4;
+  const uint32_t input_size = 64;
+  std::vector<float> weight_data(num_units * input_size);
+  for (uint32_t i = 0; i < weight_data.size(); i++)
+    weight_data[i] = static_cast<float>((i / input_size + i) % 16) - 8;
+  std::vector<float> input_data(input_size);
+  for (uint32_t i = 0; i < input_data.size(); i++)
+    input_data[i] = (i % 4 == 0) ? 127 : static_cast<float>(i % 7) - 3;
+  std::vector<float> output_data(num_units, 0.f);
+  for (uint32_t n = 0; n < num_units; n++)
+  {
+    for (uint32_t k = 0; k < input_size; k++)
+      output_data[n] += weight_data[n * input_size + k] * input_data[k];
+  }
+
+  auto weight_vector = quantData(weight_data, circle::TensorType::TensorType_GGML_Q4_0);
+  uint32_t weight_buf = cgen.addBuffer(weight_vector);
+  int input = cgen.addTensor({{2, input_size / 2}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor(
+    {{num_units, input_size}, circle::TensorType::TensorType_GGML_Q4_0, weight_buf});
+  int output = cgen.addTensor({{1, num_units}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{input, weight, -1 /* Optional bias */}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({input_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Q8_0)
+{
+  CircleGen cgen;
+
+  // Integer weights and input with 127 in each block are quantized to Q8_0 without error
+  const uint32_t num_units = 4;
+  const uint32_t input_size = 32;
+  std::vector<float> weight_data(num_units * input_size);
+  for (uint32_t i = 0; i < weight_data.size(); i++)
+    weight_data[i] = (i % input_size == i / input_size) ? 127 : static_cast<float>(i % 9) - 4;
+  std::vector<float> input_data(input_size);
+  for (uint32_t i = 0; i < input_data.size(); i++)
+    input_data[i] = (i % 8 == 0) ? 127 : static_cast<float>(i % 5) - 2;
+  std::vector<float> output_data(2 * num_units);
+  for (uint32_t n = 0; n < num_units; n++)
+  {
+    for (uint32_t k = 0; k < input_size; k++)
+      output_data[n] += weight_data[n * input_size + k] * input_data[k];
+    output_data[num_units + n] = -output_data[n];
+  }
+  std::vector<float> batch_input_data{input_data};
+  for (auto v : input_data)
+    batch_input_data.emplace_back(-v);
+
+  auto weight_vector = quantData(weight_data, circle::TensorType::TensorType_GGML_Q8_0);
+  uint32_t weight_buf = cgen.addBuffer(weight_vector);
+  int input = cgen.addTensor({{2, input_size}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor(
+    {{num_units, input_size}, circle::TensorType::TensorType_GGML_Q8_0, weight_buf});
+  int output = cgen.addTensor({{2, num_units}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{input, weight, -1 /* Optional bias */}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({batch_input_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_FullyConnected_Q4_0_InvalidInputType)
+{
+  CircleGen cgen;
+
+  std::vector<float> weight_data(4 * 32);
+  auto weight_vector = quantData(weight_data, circle::TensorType::TensorType_GGML_Q4_0);
+  uint32_t weight_buf = cgen.addBuffer(weight_vector);
+  int input = cgen.addTensor({{1, 32}, circle::TensorType::TensorType_UINT8}, 0.1, 0);
+  int weight = cgen.addTensor({{4, 32}, circle::TensorType::TensorType_GGML_Q4_0, weight_buf});
+  int output = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_UINT8}, 0.1, 0);
+  cgen.addOperatorFullyConnected({{input, weight, -1 /* Optional bias */}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
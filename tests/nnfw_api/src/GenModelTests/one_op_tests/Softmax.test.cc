@@ -112,6 +112,30 @@ TEST_F(GenModelTest, OneOp_Softmax)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_Softmax_Float16)
+{
+  // nnfw API has no half precision tensor, so the half precision softmax runs between casts
+  CircleGen cgen;
+  int in = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_FLOAT32});
+  int half_in = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_FLOAT16});
+  int half_out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_FLOAT16});
+  int out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorCast({{in}, {half_in}}, circle::TensorType::TensorType_FLOAT32,
+                       circle::TensorType::TensorType_FLOAT16);
+  cgen.addOperatorSoftmax({{half_in}, {half_out}}, 0.1);
+  cgen.addOperatorCast({{half_out}, {out}}, circle::TensorType::TensorType_FLOAT16,
+                       circle::TensorType::TensorType_FLOAT32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{0, -6, 2, 4, 3, -2, 10, 1}},
+                      {{.23463, .12877, .28658, .35003, .22528, .13664, .45365, .18443}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_P(SoftmaxVariation, neg_Type)
 {
   auto &param = GetParam();
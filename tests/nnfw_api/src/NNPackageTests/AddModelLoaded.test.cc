@@ -277,4 +277,15 @@ TEST_F(ValidationTestAddModelLoaded, neg_set_execute_config)
             NNFW_STATUS_INVALID_STATE);
   EXPECT_EQ(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_PROFILE, nullptr),
             NNFW_STATUS_INVALID_STATE);
+  EXPECT_EQ(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, nullptr),
+            NNFW_STATUS_INVALID_STATE);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_get_stats)
+{
+  // Call before prepare
+  nnfw_latency_stats stats;
+  EXPECT_EQ(nnfw_get_run_stats(_session, &stats), NNFW_STATUS_INVALID_STATE);
+  EXPECT_EQ(nnfw_get_operation_stats(_session, 0, &stats), NNFW_STATUS_INVALID_STATE);
+  EXPECT_EQ(nnfw_get_backend_stats(_session, "cpu", &stats), NNFW_STATUS_INVALID_STATE);
 }
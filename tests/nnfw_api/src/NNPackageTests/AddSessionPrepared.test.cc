@@ -191,6 +191,19 @@ TEST_F(ValidationTestAddSessionPrepared, neg_run_without_set_output)
   ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_ERROR);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, neg_prepare_pipeline_single_model)
+{
+  // Pipeline execution requires multi model package
+  ASSERT_EQ(nnfw_prepare_pipeline(_session, nullptr), NNFW_STATUS_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_push_pipeline_input_without_prepare_pipeline)
+{
+  std::vector<void *> inputs;
+  std::vector<uint32_t> lengths;
+  ASSERT_EQ(nnfw_push_pipeline_input(_session, &inputs, &lengths), NNFW_STATUS_INVALID_STATE);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, neg_internal_set_config)
 {
   // All arguments are valid, but the session state is wrong
@@ -215,7 +228,31 @@ TEST_F(ValidationTestAddSessionPrepared, set_execute_config)
   NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_DUMP_MINMAX, nullptr));
   NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_TRACE, nullptr));
   NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_PROFILE, nullptr));
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, nullptr));
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, "10"));
   SUCCEED();
 }
 
+TEST_F(ValidationTestAddSessionPrepared, get_stats)
+{
+  SetInOutBuffers();
+  NNFW_ENSURE_SUCCESS(nnfw_set_execute_config(_session, NNFW_RUN_CONFIG_STATS, nullptr));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  nnfw_latency_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_run_stats(_session, &stats));
+  EXPECT_EQ(stats.count, 1);
+  NNFW_ENSURE_SUCCESS(nnfw_get_operation_stats(_session, 0, &stats));
+  EXPECT_EQ(stats.count, 1);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_get_stats)
+{
+  nnfw_latency_stats stats;
+  EXPECT_EQ(nnfw_get_run_stats(_session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_operation_stats(_session, 0, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_backend_stats(_session, nullptr, &stats), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_get_backend_stats(_session, "cpu", nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 // TODO Validation check when "nnfw_run" is called without input & output tensor setting
@@ -129,11 +129,17 @@ TEST_F(ValidationTestSingleSession, neg_internal_set_config)
   ASSERT_EQ(nnfw_set_config(nullptr, "GRAPH_DOT_DUMP", "0"), NNFW_STATUS_UNEXPECTED_NULL);
 }
 
+TEST_F(ValidationTestSingleSession, neg_experimental_pipeline_session_null)
+{
+  std::vector<void *> buffers;
+  std::vector<uint32_t> lengths;
+  ASSERT_EQ(nnfw_prepare_pipeline(nullptr, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_push_pipeline_input(nullptr, &buffers, &lengths), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_pop_pipeline_output(nullptr, &buffers), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 TEST_F(ValidationTestSessionCreated, neg_deprecated_api)
 {
   EXPECT_EQ(nnfw_apply_tensorinfo(nullptr, 0, nnfw_tensorinfo{}), NNFW_STATUS_DEPRECATED_API);
-  EXPECT_EQ(nnfw_prepare_pipeline(nullptr, nullptr), NNFW_STATUS_DEPRECATED_API);
-  EXPECT_EQ(nnfw_push_pipeline_input(nullptr, nullptr, nullptr), NNFW_STATUS_DEPRECATED_API);
-  EXPECT_EQ(nnfw_pop_pipeline_output(nullptr, nullptr), NNFW_STATUS_DEPRECATED_API);
   EXPECT_EQ(nnfw_set_op_backend(nullptr, nullptr, nullptr), NNFW_STATUS_DEPRECATED_API);
 }
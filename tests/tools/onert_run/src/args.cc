@@ -251,6 +251,25 @@ void Args::Initialize(void)
     .help({"Path to export target-dependent model.",
            "If it is not set, the generated model will be exported to the same directory of the "
            "original model/package with target backend extension."});
+  _arser.add_argument("--load_sessions")
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help({"The number of sessions run concurrently to measure latency under load",
+           "Each session runs on its own thread. 0 runs a single session as usual."});
+  _arser.add_argument("--load_qps")
+    .type(arser::DataType::FLOAT)
+    .default_value(0.0f)
+    .help({"Target requests per second of '--load_sessions'",
+           "Requests arrive as a Poisson process and are run by an idle session (open loop).",
+           "0 runs each session back-to-back (closed loop)."});
+  _arser.add_argument("--load_duration")
+    .type(arser::DataType::INT32)
+    .default_value(10000)
+    .help("Duration(ms) of issuing requests with '--load_sessions'");
+  _arser.add_argument("--load_private_model")
+    .nargs(0)
+    .default_value(false)
+    .help("Do not share constant data of the model among sessions of '--load_sessions'");
 }
 
 void Args::Parse(const int argc, char **argv)
@@ -341,6 +360,16 @@ void Args::Parse(const int argc, char **argv)
     _gpumem_poll = _arser.get<bool>("--gpumem_poll");
     _mem_poll = _arser.get<bool>("--mem_poll");
     _write_report = _arser.get<bool>("--write_report");
+    _load_sessions = _arser.get<int>("--load_sessions");
+    _load_qps = _arser.get<float>("--load_qps");
+    _load_duration = _arser.get<int>("--load_duration");
+    _load_private_model = _arser.get<bool>("--load_private_model");
+    if (_load_sessions < 0 || _load_qps < 0 || _load_duration <= 0)
+    {
+      std::cerr << "'--load_sessions' and '--load_qps' must not be negative, "
+                << "and '--load_duration' must be positive" << std::endl;
+      exit(1);
+    }
 
     auto shape_prepare = _arser.get<std::string>("--shape_prepare");
     auto shape_run = _arser.get<std::string>("--shape_run");
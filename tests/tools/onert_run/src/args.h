@@ -77,6 +77,10 @@ public:
   const std::string &getQuantizedModelPath(void) const { return _quantized_model_path; }
   const std::string &getCodegen(void) const { return _codegen; }
   const std::string &getCodegenModelPath(void) const { return _codegen_model_path; }
+  const int getLoadSessions(void) const { return _load_sessions; }
+  const float getLoadQps(void) const { return _load_qps; }
+  const int getLoadDuration(void) const { return _load_duration; }
+  const bool getLoadPrivateModel(void) const { return _load_private_model; }
 
 private:
   void Initialize();
@@ -115,6 +119,10 @@ private:
   std::string _quantized_model_path;
   std::string _codegen;
   std::string _codegen_model_path;
+  int _load_sessions = 0;
+  float _load_qps = 0.0f;
+  int _load_duration = 0;
+  bool _load_private_model = false;
 };
 
 } // end of namespace onert_run
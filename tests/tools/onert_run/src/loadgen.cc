@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+#include "benchmark/CsvWriter.h"
+#include "benchmark/MemoryInfo.h"
+#include "nnfw_internal.h"
+#include "nnfw_util.h"
+#include "randomgen.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+
+struct CoreTime
+{
+  uint64_t busy = 0;
+  uint64_t total = 0;
+};
+
+// Read accumulated time of each core from /proc/stat
+std::vector<CoreTime> readCoreTimes()
+{
+  std::vector<CoreTime> times;
+  std::ifstream ifs("/proc/stat");
+  std::string line;
+  while (std::getline(ifs, line))
+  {
+    // Skip the aggregated "cpu" line and stop at the first non-cpu line
+    if (line.compare(0, 3, "cpu") != 0)
+      break;
+    if (line.size() < 4 || !std::isdigit(line[3]))
+      continue;
+
+    std::istringstream iss(line);
+    std::string name;
+    iss >> name;
+
+    // user nice system idle iowait irq softirq steal ...
+    CoreTime time;
+    uint64_t val;
+    for (uint32_t i = 0; iss >> val; ++i)
+    {
+      // guest and guest_nice are already counted in user and nice
+      if (i >= 8)
+        break;
+      time.total += val;
+      if (i != 3 && i != 4)
+        time.busy += val;
+    }
+    times.emplace_back(time);
+  }
+  return times;
+}
+
+std::vector<double> coreUtilization(const std::vector<CoreTime> &before,
+                                    const std::vector<CoreTime> &after)
+{
+  std::vector<double> utilization;
+  for (size_t i = 0; i < std::min(before.size(), after.size()); ++i)
+  {
+    const auto total = after[i].total - before[i].total;
+    const auto busy = after[i].busy - before[i].busy;
+    utilization.emplace_back(total == 0 ? 0.0 : 100.0 * busy / total);
+  }
+  return utilization;
+}
+
+// Nearest-rank percentile of sorted latencies in ms
+double percentileMs(const std::vector<uint64_t> &sorted, double ratio)
+{
+  if (sorted.empty())
+    return 0.0;
+  auto rank = static_cast<size_t>(std::ceil(ratio * sorted.size()));
+  rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+  return sorted[rank - 1] / 1e6;
+}
+
+void setInputShapes(nnfw_session *session, const onert_run::TensorShapeMap &shape_map)
+{
+  for (const auto &[index, shape] : shape_map)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, index, &ti));
+    ti.rank = shape.size();
+    for (int i = 0; i < ti.rank; i++)
+      ti.dims[i] = shape.at(i);
+    NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, index, &ti));
+  }
+}
+
+} // namespace
+
+namespace onert_run
+{
+
+LoadGenerator::LoadGenerator(Args &args)
+  : _qps{args.getLoadQps()}, _duration_ms{args.getLoadDuration()},
+    _warmup_runs{args.getWarmupRuns()}
+{
+  // Sessions loading the same model file share constant data unless it is disabled
+  if (args.getLoadPrivateModel())
+    setenv("SHARE_CONST_DATA", "0", 1);
+
+  const char *available_backends = std::getenv("BACKENDS");
+  RandomGenerator random_generator;
+
+  for (int n = 0; n < args.getLoadSessions(); ++n)
+  {
+    auto s = std::make_unique<Session>();
+    NNPR_ENSURE_STATUS(nnfw_create_session(&s->session));
+    auto session = s->session;
+    _sessions.emplace_back(std::move(s));
+
+    if (args.useSingleModel())
+      NNPR_ENSURE_STATUS(nnfw_load_model_from_modelfile(session, args.getModelFilename().c_str()));
+    else
+      NNPR_ENSURE_STATUS(nnfw_load_model_from_file(session, args.getPackageFilename().c_str()));
+
+    if (available_backends)
+      NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, available_backends));
+
+    setInputShapes(session, args.getShapeMapForPrepare());
+    NNPR_ENSURE_STATUS(nnfw_prepare(session));
+    setInputShapes(session, args.getShapeMapForRun());
+
+    auto &inputs = _sessions.back()->inputs;
+    auto &outputs = _sessions.back()->outputs;
+
+    uint32_t num_inputs;
+    NNPR_ENSURE_STATUS(nnfw_input_size(session, &num_inputs));
+    inputs = std::vector<Allocation>(num_inputs);
+    for (uint32_t i = 0; i < num_inputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
+      if (args.getForceFloat())
+        ti.dtype = NNFW_TYPE_TENSOR_FLOAT32;
+      auto input_size_in_bytes = bufsize_for(&ti);
+      inputs[i].alloc(input_size_in_bytes, ti.dtype);
+      NNPR_ENSURE_STATUS(
+        nnfw_set_input(session, i, ti.dtype, inputs[i].data(), input_size_in_bytes));
+      NNPR_ENSURE_STATUS(nnfw_set_input_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    }
+    random_generator.generate(inputs);
+
+    uint32_t num_outputs;
+    NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
+    outputs = std::vector<Allocation>(num_outputs);
+    for (uint32_t i = 0; i < num_outputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+      if (args.getForceFloat())
+        ti.dtype = NNFW_TYPE_TENSOR_FLOAT32;
+      uint64_t output_size_in_bytes = bufsize_for(&ti);
+      outputs[i].alloc(output_size_in_bytes, ti.dtype);
+      NNPR_ENSURE_STATUS(
+        nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
+      NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    }
+  }
+}
+
+LoadGenerator::~LoadGenerator()
+{
+  for (auto &s : _sessions)
+    nnfw_close_session(s->session);
+}
+
+void LoadGenerator::runClosedLoop(Session &s, Clock::time_point deadline)
+{
+  while (Clock::now() < deadline)
+  {
+    const auto begin = Clock::now();
+    NNPR_ENSURE_STATUS(nnfw_run(s.session));
+    const auto end = Clock::now();
+    s.latencies.emplace_back(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+  }
+}
+
+void LoadGenerator::serveOpenLoop(Session &s)
+{
+  while (true)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return !_arrivals.empty() || _closed; });
+    // Requests arrived before closing are all served
+    if (_arrivals.empty())
+      return;
+    const auto arrival = _arrivals.front();
+    _arrivals.pop_front();
+    lock.unlock();
+
+    NNPR_ENSURE_STATUS(nnfw_run(s.session));
+    const auto end = Clock::now();
+    s.latencies.emplace_back(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - arrival).count());
+  }
+}
+
+LoadResult LoadGenerator::run()
+{
+  // Warm up each session before the measurement
+  for (auto &s : _sessions)
+    for (int i = 0; i < _warmup_runs; ++i)
+      NNPR_ENSURE_STATUS(nnfw_run(s->session));
+
+  const auto core_times_before = readCoreTimes();
+  const auto start = Clock::now();
+  const auto deadline = start + std::chrono::milliseconds(_duration_ms);
+
+  std::vector<std::thread> workers;
+  if (_qps > 0)
+  {
+    _closed = false;
+    for (auto &s : _sessions)
+      workers.emplace_back([this, &s] { serveOpenLoop(*s); });
+
+    // Fixed seed to issue the same arrivals on every run
+    std::mt19937_64 rng(1);
+    std::exponential_distribution<double> interval(_qps);
+    auto arrival = start;
+    while (arrival < deadline)
+    {
+      std::this_thread::sleep_until(arrival);
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _arrivals.emplace_back(arrival);
+      }
+      _cv.notify_one();
+      arrival += std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(interval(rng)));
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _closed = true;
+    }
+    _cv.notify_all();
+  }
+  else
+  {
+    for (auto &s : _sessions)
+      workers.emplace_back([this, &s, deadline] { runClosedLoop(*s, deadline); });
+  }
+
+  for (auto &worker : workers)
+    worker.join();
+
+  const auto end = Clock::now();
+  const auto core_times_after = readCoreTimes();
+
+  LoadResult result;
+  result.num_sessions = _sessions.size();
+  result.target_qps = _qps;
+  result.elapsed_sec = std::chrono::duration<double>(end - start).count();
+
+  std::vector<uint64_t> latencies;
+  for (auto &s : _sessions)
+  {
+    latencies.insert(latencies.end(), s->latencies.begin(), s->latencies.end());
+    s->latencies.clear();
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  result.num_requests = latencies.size();
+  if (result.elapsed_sec > 0)
+    result.throughput = result.num_requests / result.elapsed_sec;
+  if (!latencies.empty())
+  {
+    const double sum = std::accumulate(latencies.begin(), latencies.end(), 0.0);
+    result.mean = sum / latencies.size() / 1e6;
+    result.max = latencies.back() / 1e6;
+  }
+  result.p50 = percentileMs(latencies, 0.5);
+  result.p90 = percentileMs(latencies, 0.9);
+  result.p99 = percentileMs(latencies, 0.99);
+  result.p999 = percentileMs(latencies, 0.999);
+
+  result.rss_kb = benchmark::getVmRSS();
+  result.hwm_kb = benchmark::getVmHWM();
+  result.core_utilization = coreUtilization(core_times_before, core_times_after);
+
+  return result;
+}
+
+void printLoadResult(const LoadResult &result)
+{
+  std::cout << "===================================" << std::endl;
+
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3);
+  std::cout << std::fixed;
+
+  std::cout << "Sessions   : " << result.num_sessions << std::endl;
+  if (result.target_qps > 0)
+    std::cout << "Target QPS : " << result.target_qps << " (open loop)" << std::endl;
+  else
+    std::cout << "Target QPS : - (closed loop)" << std::endl;
+  std::cout << "Requests   : " << result.num_requests << " in " << result.elapsed_sec << " s"
+            << std::endl;
+  std::cout << "Throughput : " << result.throughput << " QPS" << std::endl;
+  std::cout << "===================================" << std::endl;
+
+  std::cout << "Latency" << std::endl;
+  std::cout << "- MEAN     :  " << result.mean << " ms" << std::endl;
+  std::cout << "- P50      :  " << result.p50 << " ms" << std::endl;
+  std::cout << "- P90      :  " << result.p90 << " ms" << std::endl;
+  std::cout << "- P99      :  " << result.p99 << " ms" << std::endl;
+  std::cout << "- P99.9    :  " << result.p999 << " ms" << std::endl;
+  std::cout << "- MAX      :  " << result.max << " ms" << std::endl;
+  std::cout << "===================================" << std::endl;
+
+  std::cout << "RSS        : " << result.rss_kb << " kb" << std::endl;
+  std::cout << "HWM        : " << result.hwm_kb << " kb" << std::endl;
+  std::cout << "CPU usage" << std::endl;
+  for (size_t i = 0; i < result.core_utilization.size(); ++i)
+    std::cout << "- cpu" << std::setw(5) << std::left << i << ":  " << result.core_utilization[i]
+              << " %" << std::endl;
+
+  std::cout << std::setprecision(ss_precision);
+  std::cout << std::defaultfloat;
+
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend)
+{
+  std::string csv_filename = exec + "-" + model + "-" + backend + "-load.csv";
+
+  std::vector<std::string> header{"Model",
+                                  "Backend",
+                                  "Sessions",
+                                  "Target QPS",
+                                  "Requests",
+                                  "Elapsed(s)",
+                                  "Throughput(QPS)",
+                                  "Latency MEAN(ms)",
+                                  "Latency P50(ms)",
+                                  "Latency P90(ms)",
+                                  "Latency P99(ms)",
+                                  "Latency P99.9(ms)",
+                                  "Latency MAX(ms)",
+                                  "RSS(kb)",
+                                  "HWM(kb)"};
+  for (size_t i = 0; i < result.core_utilization.size(); ++i)
+    header.emplace_back("cpu" + std::to_string(i) + "(%)");
+
+  benchmark::CsvWriter writer(csv_filename, header);
+  writer << model << backend << result.num_sessions << static_cast<double>(result.target_qps)
+         << std::to_string(result.num_requests) << result.elapsed_sec << result.throughput;
+  writer << result.mean << result.p50 << result.p90 << result.p99 << result.p999 << result.max;
+  writer << result.rss_kb << result.hwm_kb;
+  for (auto utilization : result.core_utilization)
+    writer << utilization;
+
+  if (!writer.done())
+  {
+    std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+  }
+}
+
+} // namespace onert_run
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_RUN_LOADGEN_H__
+#define __ONERT_RUN_LOADGEN_H__
+
+#include "allocation.h"
+#include "args.h"
+#include "nnfw.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace onert_run
+{
+
+struct LoadResult
+{
+  uint32_t num_sessions = 0;
+  // Target requests per second, 0 for closed loop
+  float target_qps = 0.0f;
+  uint64_t num_requests = 0;
+  double elapsed_sec = 0.0;
+  double throughput = 0.0;
+  // Latencies in ms
+  double mean = 0.0;
+  double max = 0.0;
+  double p50 = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  double p999 = 0.0;
+  uint32_t rss_kb = 0;
+  uint32_t hwm_kb = 0;
+  // Busy ratio of each core in percent during the measurement
+  std::vector<double> core_utilization;
+};
+
+/**
+ * @brief Drive many sessions of a model concurrently and measure latency under the load
+ *
+ * Each session is run on its own thread. In closed loop, a session issues the next request as
+ * soon as the previous one completes. In open loop, requests arrive at the target QPS with
+ * exponential inter-arrival times (Poisson process) and are served by the first idle session.
+ * Latency of a request in open loop includes the time it waited for an idle session.
+ */
+class LoadGenerator
+{
+public:
+  explicit LoadGenerator(Args &args);
+  ~LoadGenerator();
+
+  LoadGenerator(const LoadGenerator &) = delete;
+  LoadGenerator &operator=(const LoadGenerator &) = delete;
+
+  LoadResult run();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Session
+  {
+    nnfw_session *session = nullptr;
+    std::vector<Allocation> inputs;
+    std::vector<Allocation> outputs;
+    // Latencies of completed requests in ns
+    std::vector<uint64_t> latencies;
+  };
+
+  void runClosedLoop(Session &session, Clock::time_point deadline);
+  void serveOpenLoop(Session &session);
+
+private:
+  std::vector<std::unique_ptr<Session>> _sessions;
+  float _qps;
+  int _duration_ms;
+  int _warmup_runs;
+
+  // Arrival times of requests not served yet in open loop
+  std::deque<Clock::time_point> _arrivals;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _closed = false;
+};
+
+void printLoadResult(const LoadResult &result);
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend);
+
+} // namespace onert_run
+
+#endif // __ONERT_RUN_LOADGEN_H__
@@ -20,6 +20,7 @@
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
 #include "h5formatter.h"
 #endif
+#include "loadgen.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
 #include "nnfw_internal.h"
@@ -100,6 +101,19 @@ std::string genQuantizedModelPathFromPackagePath(const std::string &package_path
   throw std::runtime_error{"Invalid quantization type"};
 }
 
+std::string getModelBasename(const onert_run::Args &args)
+{
+  char buf[PATH_MAX];
+  char *res = args.useSingleModel() ? realpath(args.getModelFilename().c_str(), buf)
+                                    : realpath(args.getPackageFilename().c_str(), buf);
+  if (!res)
+  {
+    std::cerr << "E: during getting realpath from nnpackage or model path." << std::endl;
+    exit(-1);
+  }
+  return basename(buf);
+}
+
 int main(const int argc, char **argv)
 {
   using namespace onert_run;
@@ -120,6 +134,26 @@ int main(const int argc, char **argv)
     ruy::profiler::ScopeProfile ruy_profile;
 #endif
 
+    // Run many sessions concurrently instead of measuring phases of a session
+    if (args.getLoadSessions() > 0)
+    {
+      LoadResult result;
+      {
+        LoadGenerator loadgen(args);
+        result = loadgen.run();
+      }
+
+      printLoadResult(result);
+
+      if (args.getWriteReport() == false)
+        return 0;
+
+      char *available_backends = std::getenv("BACKENDS");
+      std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
+      writeLoadResult(result, basename(argv[0]), getModelBasename(args), backend_name);
+      return 0;
+    }
+
     // TODO Apply verbose level to phases
     const int verbose = args.getVerboseLevel();
     benchmark::Phases phases(
@@ -484,24 +518,9 @@ int main(const int argc, char **argv)
       return 0;
 
     // prepare csv task
-    std::string exec_basename;
-    std::string nnpkg_basename;
+    std::string exec_basename = basename(argv[0]);
+    std::string nnpkg_basename = getModelBasename(args);
     std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
-    {
-      char buf[PATH_MAX];
-      char *res = args.useSingleModel() ? realpath(args.getModelFilename().c_str(), buf)
-                                        : realpath(args.getPackageFilename().c_str(), buf);
-      if (res)
-      {
-        nnpkg_basename = basename(buf);
-      }
-      else
-      {
-        std::cerr << "E: during getting realpath from nnpackage or model path." << std::endl;
-        exit(-1);
-      }
-      exec_basename = basename(argv[0]);
-    }
 
     benchmark::writeResult(result, exec_basename, nnpkg_basename, backend_name);
 
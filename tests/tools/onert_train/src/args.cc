@@ -206,6 +206,15 @@ void Args::Initialize(void)
     .help({"Number of the layers to be trained from the back of the model.",
            "\"-1\" means that all layers will be trained.",
            "\"0\" means that no layer will be trained."});
+  _arser.add_argument("--prefetch")
+    .type(arser::DataType::INT32)
+    .default_value(2)
+    .help({"Number of batches prepared ahead on worker threads while training (default: 2)",
+           "0 prepares each batch on the training thread."});
+  _arser.add_argument("--shuffle")
+    .nargs(0)
+    .default_value(false)
+    .help("Shuffle training data every epoch (default: false)");
 }
 
 void Args::Parse(const int argc, char **argv)
@@ -323,6 +332,14 @@ void Args::Parse(const int argc, char **argv)
 
     if (_arser["--num_of_trainable_ops"])
       _num_of_trainable_ops = _arser.get<int>("--num_of_trainable_ops");
+
+    _prefetch = _arser.get<int>("--prefetch");
+    if (_prefetch < 0)
+    {
+      std::cerr << "Invalid prefetch. It must not be negative." << std::endl;
+      exit(1);
+    }
+    _shuffle = _arser.get<bool>("--shuffle");
   }
   catch (const std::bad_cast &e)
   {
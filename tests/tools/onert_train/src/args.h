@@ -72,6 +72,8 @@ public:
   const int getVerboseLevel(void) const { return _verbose_level; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
   uint32_t num_of_trainable_ops(void) const { return _num_of_trainable_ops; }
+  const int getPrefetch(void) const { return _prefetch; }
+  const bool getShuffle(void) const { return _shuffle; }
 
 private:
   void Initialize();
@@ -121,6 +123,8 @@ private:
   int _verbose_level;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
   int32_t _num_of_trainable_ops;
+  int _prefetch;
+  bool _shuffle;
 };
 
 } // end of namespace onert_train
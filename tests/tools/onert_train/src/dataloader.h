@@ -23,7 +23,6 @@
 #include <functional>
 #include <vector>
 #include <tuple>
-#include <fstream>
 
 namespace onert_train
 {
@@ -43,14 +42,21 @@ public:
   }
   virtual ~DataLoader() = default;
 
+  /**
+   * @brief Load data in [from, to) of the whole data as batches
+   *
+   * @param order Order of samples in the range to read, or nullptr to read them in order.
+   *              It must hold as many samples as the range before the generator is called,
+   *              and must not be changed while the generator is running.
+   * @return Generator of batches and the number of samples in the range
+   */
   virtual std::tuple<Generator, uint32_t>
-  loadData(const uint32_t batch_size, const float from = 0.0f, const float to = 1.0f) = 0;
+  loadData(const uint32_t batch_size, const float from = 0.0f, const float to = 1.0f,
+           const std::vector<uint32_t> *order = nullptr) = 0;
 
 protected:
   std::vector<nnfw_tensorinfo> _input_infos;
   std::vector<nnfw_tensorinfo> _expected_infos;
-  std::ifstream _input_file;
-  std::ifstream _expected_file;
   uint32_t _data_length;
 };
 
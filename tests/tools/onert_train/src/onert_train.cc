@@ -27,12 +27,16 @@
 #include "dataloader.h"
 #include "rawdataloader.h"
 #include "metrics.h"
+#include "prefetcher.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <libgen.h>
+#include <numeric>
+#include <random>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -167,16 +171,14 @@ int main(const int argc, char **argv)
     std::vector<nnfw_tensorinfo> input_infos;
     std::vector<nnfw_tensorinfo> expected_infos;
 
-    // prepare data buffers
-    std::vector<Allocation> input_data(num_inputs);
-    std::vector<Allocation> expected_data(num_expecteds);
+    // prepare output buffers
+    // NOTE Input and expected buffers are owned by Prefetcher
     std::vector<Allocation> output_data(num_expecteds);
 
     for (uint32_t i = 0; i < num_inputs; ++i)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      input_data[i].alloc(bufsize_for(&ti));
       input_infos.emplace_back(std::move(ti));
     }
 
@@ -191,7 +193,6 @@ int main(const int argc, char **argv)
       NNPR_ENSURE_STATUS(
         nnfw_train_set_output(session, i, ti.dtype, output_data[i].data(), output_size_in_bytes));
 
-      expected_data[i].alloc(output_size_in_bytes);
       expected_infos.emplace_back(std::move(ti));
     }
 
@@ -200,6 +201,8 @@ int main(const int argc, char **argv)
     uint32_t vdata_length;
     Generator vdata_generator;
     std::unique_ptr<DataLoader> dataLoader;
+    // Order of training samples, shuffled every epoch if needed
+    std::vector<uint32_t> tdata_order;
 
     if (!args.getLoadRawInputFilename().empty() && !args.getLoadRawExpectedFilename().empty())
     {
@@ -208,9 +211,12 @@ int main(const int argc, char **argv)
                                                    expected_infos);
 
       auto train_to = 1.0f - args.getValidationSplit();
-      std::tie(tdata_generator, tdata_length) = dataLoader->loadData(tri.batch_size, 0.f, train_to);
+      std::tie(tdata_generator, tdata_length) = dataLoader->loadData(
+        tri.batch_size, 0.f, train_to, args.getShuffle() ? &tdata_order : nullptr);
       std::tie(vdata_generator, vdata_length) =
         dataLoader->loadData(tri.batch_size, train_to, 1.0f);
+      tdata_order.resize(tdata_length);
+      std::iota(tdata_order.begin(), tdata_order.end(), 0);
     }
     else
     {
@@ -238,6 +244,11 @@ int main(const int argc, char **argv)
       exit(-1);
     }
 
+    // Batches of the next steps are prepared while training the current step
+    Prefetcher tdata_prefetcher(tdata_generator, input_infos, expected_infos, args.getPrefetch());
+    Prefetcher vdata_prefetcher(vdata_generator, input_infos, expected_infos, args.getPrefetch());
+    std::mt19937 rng{std::random_device{}()};
+
     std::vector<float> losses(num_expecteds);
     std::vector<float> metrics(num_expecteds);
     measure.run(PhaseType::EXECUTE, [&]() {
@@ -252,31 +263,39 @@ int main(const int argc, char **argv)
         {
           std::fill(losses.begin(), losses.end(), 0);
           std::fill(metrics.begin(), metrics.end(), 0);
+          if (args.getShuffle())
+          {
+            // Workers may still be filling batches with the previous order
+            tdata_prefetcher.stop();
+            std::shuffle(tdata_order.begin(), tdata_order.end(), rng);
+          }
+          tdata_prefetcher.start(num_step);
           for (uint32_t n = 0; n < num_step; ++n)
           {
             // get batchsize data
-            if (!tdata_generator(n, input_data, expected_data))
+            const auto batch = tdata_prefetcher.next();
+            if (batch == nullptr)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch->inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
-              NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+              NNPR_ENSURE_STATUS(nnfw_train_set_expected(session, i, batch->expecteds[i].data(),
+                                                         &expected_infos[i]));
             }
 
             // train
             measure.run(epoch, n, [&]() { NNPR_ENSURE_STATUS(nnfw_train(session, true)); });
 
             // store loss
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, batch->expecteds, expected_infos);
             for (int32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
@@ -320,31 +339,33 @@ int main(const int argc, char **argv)
           std::fill(losses.begin(), losses.end(), 0);
           std::fill(metrics.begin(), metrics.end(), 0);
           const int num_valid_step = vdata_length / tri.batch_size;
+          vdata_prefetcher.start(num_valid_step);
           for (uint32_t n = 0; n < num_valid_step; ++n)
           {
             // get batchsize validation data
-            if (!vdata_generator(n, input_data, expected_data))
+            const auto batch = vdata_prefetcher.next();
+            if (batch == nullptr)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch->inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
-              NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+              NNPR_ENSURE_STATUS(nnfw_train_set_expected(session, i, batch->expecteds[i].data(),
+                                                         &expected_infos[i]));
             }
 
             // validation
             NNPR_ENSURE_STATUS(nnfw_train(session, false));
 
             // get validation loss and accuracy
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, batch->expecteds, expected_infos);
             for (int32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
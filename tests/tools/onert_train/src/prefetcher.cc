@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prefetcher.h"
+#include "nnfw_util.h"
+
+#include <algorithm>
+
+namespace onert_train
+{
+
+Prefetcher::Prefetcher(const Generator &generator, const std::vector<nnfw_tensorinfo> &input_infos,
+                       const std::vector<nnfw_tensorinfo> &expected_infos, uint32_t depth)
+  : _generator{generator}, _slots(depth + 1)
+{
+  for (auto &slot : _slots)
+  {
+    slot.batch.inputs = std::vector<Allocation>(input_infos.size());
+    for (uint32_t i = 0; i < input_infos.size(); ++i)
+      slot.batch.inputs[i].alloc(bufsize_for(&input_infos[i]));
+
+    slot.batch.expecteds = std::vector<Allocation>(expected_infos.size());
+    for (uint32_t i = 0; i < expected_infos.size(); ++i)
+      slot.batch.expecteds[i].alloc(bufsize_for(&expected_infos[i]));
+  }
+
+  // One worker per batch filled ahead
+  for (uint32_t i = 0; i < depth; ++i)
+    _workers.emplace_back([this] { work(); });
+}
+
+Prefetcher::~Prefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  for (auto &worker : _workers)
+    worker.join();
+}
+
+void Prefetcher::start(uint32_t num_batches)
+{
+  // Stop filling batches of the previous start()
+  stop();
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  for (auto &slot : _slots)
+    slot.state = State::FREE;
+  _num_batches = num_batches;
+  _num_filled = 0;
+  _num_consumed = 0;
+
+  lock.unlock();
+  _cv.notify_all();
+}
+
+void Prefetcher::stop()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _num_batches = 0;
+  _cv.wait(lock, [this] {
+    return std::none_of(_slots.begin(), _slots.end(),
+                        [](const Slot &slot) { return slot.state == State::FILLING; });
+  });
+}
+
+const Batch *Prefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // The previous batch is not used anymore
+  if (_num_consumed > 0)
+  {
+    auto &prev = _slots[(_num_consumed - 1) % _slots.size()];
+    if (prev.state == State::IN_USE)
+    {
+      prev.state = State::FREE;
+      _cv.notify_all();
+    }
+  }
+
+  if (_num_consumed >= _num_batches)
+    return nullptr;
+
+  const auto index = _num_consumed++;
+  auto &slot = _slots[index % _slots.size()];
+
+  if (_workers.empty())
+  {
+    // Fill on the caller's thread
+    slot.index = index;
+    _num_filled = index + 1;
+    lock.unlock();
+    const bool filled = _generator(index, slot.batch.inputs, slot.batch.expecteds);
+    lock.lock();
+    slot.state = filled ? State::READY : State::FAILED;
+  }
+
+  _cv.wait(lock, [&] {
+    return slot.index == index && (slot.state == State::READY || slot.state == State::FAILED);
+  });
+  if (slot.state == State::FAILED)
+  {
+    slot.state = State::FREE;
+    _num_batches = _num_consumed;
+    return nullptr;
+  }
+
+  slot.state = State::IN_USE;
+  return &slot.batch;
+}
+
+void Prefetcher::work()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true)
+  {
+    // A batch goes to the slot which held the batch of _slots.size() before
+    _cv.wait(lock, [this] {
+      if (_stop)
+        return true;
+      return _num_filled < _num_batches &&
+             _slots[_num_filled % _slots.size()].state == State::FREE;
+    });
+    if (_stop)
+      return;
+
+    const auto index = _num_filled++;
+    auto &slot = _slots[index % _slots.size()];
+    slot.state = State::FILLING;
+    slot.index = index;
+
+    lock.unlock();
+    const bool filled = _generator(index, slot.batch.inputs, slot.batch.expecteds);
+    lock.lock();
+
+    slot.state = filled ? State::READY : State::FAILED;
+    _cv.notify_all();
+  }
+}
+
+} // namespace onert_train
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TRAIN_PREFETCHER_H__
+#define __ONERT_TRAIN_PREFETCHER_H__
+
+#include "allocation.h"
+#include "dataloader.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert_train
+{
+
+struct Batch
+{
+  std::vector<Allocation> inputs;
+  std::vector<Allocation> expecteds;
+};
+
+/**
+ * @brief Fill batches ahead on worker threads while the current batch is being used
+ *
+ * Batches are filled into a fixed set of buffers allocated once, so no memory is allocated
+ * between steps. With depth 0, the batch is filled on the caller's thread in next().
+ */
+class Prefetcher
+{
+public:
+  Prefetcher(const Generator &generator, const std::vector<nnfw_tensorinfo> &input_infos,
+             const std::vector<nnfw_tensorinfo> &expected_infos, uint32_t depth);
+  ~Prefetcher();
+
+  Prefetcher(const Prefetcher &) = delete;
+  Prefetcher &operator=(const Prefetcher &) = delete;
+
+  /**
+   * @brief Start filling batches from 0 to num_batches - 1
+   * @note  The generator is not called anymore for the batches of the previous start()
+   */
+  void start(uint32_t num_batches);
+
+  /**
+   * @brief Stop filling batches and wait for the ones being filled
+   * @note  Data the generator reads (e.g. the order of samples) can be changed after this
+   */
+  void stop();
+
+  /**
+   * @brief Get the next batch, waiting for it to be filled if needed
+   * @note  The returned batch is valid until the next call of next() or start()
+   *
+   * @return The next batch, or nullptr if there are no more batches or the generator failed
+   */
+  const Batch *next();
+
+private:
+  enum class State
+  {
+    FREE,
+    FILLING,
+    READY,
+    FAILED,
+    IN_USE,
+  };
+
+  struct Slot
+  {
+    Batch batch;
+    State state = State::FREE;
+    uint32_t index = 0;
+  };
+
+  void work();
+
+private:
+  Generator _generator;
+  std::vector<Slot> _slots;
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  uint32_t _num_batches = 0;
+  uint32_t _num_filled = 0;
+  uint32_t _num_consumed = 0;
+  bool _stop = false;
+};
+
+} // namespace onert_train
+
+#endif // __ONERT_TRAIN_PREFETCHER_H__
@@ -17,10 +17,14 @@
 #include "rawdataloader.h"
 #include "nnfw_util.h"
 
-#include <iostream>
-#include <stdexcept>
-#include <numeric>
 #include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert_train
 {
@@ -38,6 +42,50 @@ uint64_t getRawTensorSize(const std::vector<nnfw_tensorinfo> &infos)
 }
 } // namespace onert_train
 
+namespace
+{
+
+// Map a whole file into memory as read-only. Returns nullptr for an empty file.
+const uint8_t *mapFile(const std::string &path, uint64_t &size)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw std::runtime_error("Failed to open " + path);
+
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+  {
+    close(fd);
+    throw std::runtime_error("Failed to get the size of " + path);
+  }
+  size = static_cast<uint64_t>(st.st_size);
+
+  void *data = nullptr;
+  if (size > 0)
+  {
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      close(fd);
+      throw std::runtime_error("Failed to map " + path);
+    }
+    // Samples may be read in shuffled order, so ask for the whole file rather than readahead
+    madvise(data, size, MADV_WILLNEED);
+  }
+  // The mapping stays valid after closing the file
+  close(fd);
+
+  return static_cast<const uint8_t *>(data);
+}
+
+void unmapFile(const uint8_t *data, uint64_t size)
+{
+  if (data != nullptr)
+    munmap(const_cast<uint8_t *>(data), size);
+}
+
+} // namespace
+
 namespace onert_train
 {
 
@@ -46,66 +94,88 @@ RawDataLoader::RawDataLoader(const std::string &input_file, const std::string &e
                              const std::vector<nnfw_tensorinfo> &expected_infos)
   : DataLoader(input_infos, expected_infos)
 {
-  _input_file = std::ifstream(input_file, std::ios::binary);
-  _expected_file = std::ifstream(expected_file, std::ios::binary);
-
-  _input_file.seekg(0, std::ios::end);
-  uint32_t input_file_size = _input_file.tellg();
-  uint32_t input_data_length = input_file_size / getRawTensorSize(_input_infos);
+  _input_data = mapFile(input_file, _input_size);
+  try
+  {
+    _expected_data = mapFile(expected_file, _expected_size);
+  }
+  catch (...)
+  {
+    unmapFile(_input_data, _input_size);
+    throw;
+  }
 
-  _expected_file.seekg(0, std::ios::end);
-  uint32_t expected_file_size = _expected_file.tellg();
-  uint32_t expected_data_length = expected_file_size / getRawTensorSize(_expected_infos);
+  uint64_t input_data_length = _input_size / getRawTensorSize(_input_infos);
+  uint64_t expected_data_length = _expected_size / getRawTensorSize(_expected_infos);
 
   if (input_data_length != expected_data_length)
   {
+    unmapFile(_input_data, _input_size);
+    unmapFile(_expected_data, _expected_size);
     throw std::runtime_error("The length of input data and expected data does not match.");
   }
 
   _data_length = input_data_length;
 }
 
+RawDataLoader::~RawDataLoader()
+{
+  unmapFile(_input_data, _input_size);
+  unmapFile(_expected_data, _expected_size);
+}
+
 std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_size, const float from,
-                                                        const float to)
+                                                        const float to,
+                                                        const std::vector<uint32_t> *order)
 {
   assert(from >= 0.f && from <= 1.f);
   assert(to >= 0.f && to <= 1.f);
   assert(from <= to);
 
-  int32_t split_size = _data_length * (to - from);
-  int32_t split_start = _data_length * from;
-  std::vector<uint32_t> input_origins(_input_infos.size());
-  uint32_t start = 0;
-  for (uint32_t i = 0; i < _input_infos.size(); ++i)
-  {
-    auto hwc_size = bufsize_for(&_input_infos[i]) / batch_size;
-    input_origins.at(i) = start + (hwc_size * split_start);
-    start += (hwc_size * _data_length);
-  }
+  uint32_t split_size = _data_length * (to - from);
+  uint32_t split_start = _data_length * from;
 
-  std::vector<uint32_t> expected_origins(_expected_infos.size());
-  start = 0;
-  for (uint32_t i = 0; i < _expected_infos.size(); ++i)
-  {
-    auto hwc_size = bufsize_for(&_expected_infos[i]) / batch_size;
-    expected_origins.at(i) = start + (hwc_size * split_start);
-    start += (hwc_size * _data_length);
-  }
+  // Each input holds data_length samples one after another
+  auto get_layout = [&](const std::vector<nnfw_tensorinfo> &infos,
+                        std::vector<uint64_t> &sample_sizes, std::vector<uint64_t> &origins) {
+    uint64_t start = 0;
+    for (uint32_t i = 0; i < infos.size(); ++i)
+    {
+      sample_sizes.at(i) = bufsize_for(&infos[i]) / batch_size;
+      origins.at(i) = start;
+      start += sample_sizes[i] * _data_length;
+    }
+  };
+
+  std::vector<uint64_t> input_sample_sizes(_input_infos.size());
+  std::vector<uint64_t> input_origins(_input_infos.size());
+  get_layout(_input_infos, input_sample_sizes, input_origins);
+
+  std::vector<uint64_t> expected_sample_sizes(_expected_infos.size());
+  std::vector<uint64_t> expected_origins(_expected_infos.size());
+  get_layout(_expected_infos, expected_sample_sizes, expected_origins);
 
   return std::make_tuple(
-    [input_origins, expected_origins, this](uint32_t idx, std::vector<Allocation> &inputs,
-                                            std::vector<Allocation> &expecteds) {
-      for (uint32_t i = 0; i < _input_infos.size(); ++i)
-      {
-        auto bufsz = bufsize_for(&_input_infos[i]);
-        _input_file.seekg(input_origins[i] + idx * bufsz, std::ios::beg);
-        _input_file.read(reinterpret_cast<char *>(inputs[i].data()), bufsz);
-      }
-      for (uint32_t i = 0; i < _expected_infos.size(); ++i)
+    [=](uint32_t idx, std::vector<Allocation> &inputs, std::vector<Allocation> &expecteds) {
+      for (uint32_t b = 0; b < batch_size; ++b)
       {
-        auto bufsz = bufsize_for(&_expected_infos[i]);
-        _expected_file.seekg(expected_origins[i] + idx * bufsz, std::ios::beg);
-        _expected_file.read(reinterpret_cast<char *>(expecteds[i].data()), bufsz);
+        const uint32_t pos = idx * batch_size + b;
+        if (pos >= split_size)
+          return false;
+        const uint64_t sample = split_start + (order != nullptr ? order->at(pos) : pos);
+
+        for (uint32_t i = 0; i < input_origins.size(); ++i)
+        {
+          const auto size = input_sample_sizes[i];
+          std::memcpy(static_cast<uint8_t *>(inputs[i].data()) + b * size,
+                      _input_data + input_origins[i] + sample * size, size);
+        }
+        for (uint32_t i = 0; i < expected_origins.size(); ++i)
+        {
+          const auto size = expected_sample_sizes[i];
+          std::memcpy(static_cast<uint8_t *>(expecteds[i].data()) + b * size,
+                      _expected_data + expected_origins[i] + sample * size, size);
+        }
       }
       return true;
     },
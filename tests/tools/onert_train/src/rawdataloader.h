@@ -19,18 +19,36 @@
 
 #include "dataloader.h"
 
+#include <string>
+
 namespace onert_train
 {
 
+/**
+ * @brief Data loader reading raw data files mapped into memory
+ *
+ * Generators only copy from the mapped files, so they can be called from several threads at once.
+ */
 class RawDataLoader : public DataLoader
 {
 public:
   RawDataLoader(const std::string &input_file, const std::string &expected_file,
                 const std::vector<nnfw_tensorinfo> &input_infos,
                 const std::vector<nnfw_tensorinfo> &expected_infos);
+  ~RawDataLoader() override;
+
+  RawDataLoader(const RawDataLoader &) = delete;
+  RawDataLoader &operator=(const RawDataLoader &) = delete;
 
   std::tuple<Generator, uint32_t> loadData(const uint32_t batch_size, const float from = 0.0f,
-                                           const float to = 1.0f) override;
+                                           const float to = 1.0f,
+                                           const std::vector<uint32_t> *order = nullptr) override;
+
+private:
+  const uint8_t *_input_data = nullptr;
+  uint64_t _input_size = 0;
+  const uint8_t *_expected_data = nullptr;
+  uint64_t _expected_size = 0;
 };
 
 } // namespace onert_train
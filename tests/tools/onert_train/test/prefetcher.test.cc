@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include "../src/prefetcher.h"
+
+namespace
+{
+using namespace onert_train;
+
+const nnfw_tensorinfo kInfo = {
+  .dtype = NNFW_TYPE_TENSOR_INT32,
+  .rank = 2,
+  .dims = {4, 2},
+};
+
+// Fill every element of a batch with its index
+Generator indexGenerator(uint32_t num_batches, std::atomic<uint32_t> &num_calls)
+{
+  return [num_batches, &num_calls](uint32_t idx, std::vector<Allocation> &inputs,
+                                   std::vector<Allocation> &expecteds) {
+    num_calls++;
+    if (idx >= num_batches)
+      return false;
+    for (auto *allocs : {&inputs, &expecteds})
+    {
+      auto data = static_cast<int32_t *>(allocs->at(0).data());
+      std::fill(data, data + 8, static_cast<int32_t>(idx));
+    }
+    return true;
+  };
+}
+
+void verifyBatches(Prefetcher &prefetcher, uint32_t num_batches)
+{
+  prefetcher.start(num_batches);
+  for (uint32_t n = 0; n < num_batches; ++n)
+  {
+    const auto batch = prefetcher.next();
+    ASSERT_NE(batch, nullptr);
+    for (const auto *allocs : {&batch->inputs, &batch->expecteds})
+    {
+      auto data = static_cast<const int32_t *>(allocs->at(0).data());
+      EXPECT_TRUE(std::all_of(data, data + 8, [&](int32_t v) { return v == n; }));
+    }
+  }
+  EXPECT_EQ(prefetcher.next(), nullptr);
+}
+
+} // namespace
+
+TEST(Prefetcher, next)
+{
+  for (uint32_t depth : {0, 1, 3})
+  {
+    std::atomic<uint32_t> num_calls{0};
+    Prefetcher prefetcher(indexGenerator(10, num_calls), {kInfo}, {kInfo}, depth);
+
+    // Run twice like epochs
+    verifyBatches(prefetcher, 10);
+    verifyBatches(prefetcher, 10);
+    EXPECT_EQ(num_calls, 20);
+  }
+}
+
+TEST(Prefetcher, restart)
+{
+  std::atomic<uint32_t> num_calls{0};
+  Prefetcher prefetcher(indexGenerator(10, num_calls), {kInfo}, {kInfo}, 2);
+
+  // Stop in the middle and start again
+  prefetcher.start(10);
+  ASSERT_NE(prefetcher.next(), nullptr);
+  verifyBatches(prefetcher, 10);
+}
+
+TEST(Prefetcher, neg_generator_fail)
+{
+  for (uint32_t depth : {0, 2})
+  {
+    std::atomic<uint32_t> num_calls{0};
+    Prefetcher prefetcher(indexGenerator(3, num_calls), {kInfo}, {kInfo}, depth);
+
+    prefetcher.start(5);
+    for (uint32_t n = 0; n < 3; ++n)
+      EXPECT_NE(prefetcher.next(), nullptr);
+    EXPECT_EQ(prefetcher.next(), nullptr);
+    EXPECT_EQ(prefetcher.next(), nullptr);
+  }
+}
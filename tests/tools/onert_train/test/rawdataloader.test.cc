@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <fstream>
 #include <numeric>
 
 #include "../src/rawdataloader.h"
@@ -225,3 +226,57 @@ TEST_F(RawDataLoaderTest, loadDatas_1)
 }
 
 } // namespace
+
+TEST_F(RawDataLoaderTest, loadDatas_order)
+{
+  const uint32_t data_length = 8;
+  const uint32_t batch_size = 2;
+
+  nnfw_tensorinfo info = {
+    .dtype = NNFW_TYPE_TENSOR_INT32,
+    .rank = 2,
+    .dims = {batch_size, 1},
+  };
+  std::vector<nnfw_tensorinfo> infos{info};
+
+  // Write the sample index as each sample
+  const std::string input_file = "order_input.bin";
+  const std::string expected_file = "order_expected.bin";
+  for (const auto &name : {input_file, expected_file})
+  {
+    std::ofstream file(name, std::ios::binary);
+    for (uint32_t i = 0; i < data_length; ++i)
+      file.write(reinterpret_cast<const char *>(&i), sizeof(i));
+  }
+
+  std::vector<uint32_t> order{7, 2, 5, 0, 3, 6, 1, 4};
+
+  {
+    RawDataLoader loader(input_file, expected_file, infos, infos);
+    Generator generator;
+    uint32_t test_data_length;
+    std::tie(generator, test_data_length) = loader.loadData(batch_size, 0.0f, 1.0f, &order);
+    EXPECT_EQ(data_length, test_data_length);
+
+    std::vector<Allocation> inputs(1);
+    inputs[0].alloc(bufsize_for(&info));
+    std::vector<Allocation> expecteds(1);
+    expecteds[0].alloc(bufsize_for(&info));
+
+    for (uint32_t i = 0; i < data_length / batch_size; ++i)
+    {
+      ASSERT_TRUE(generator(i, inputs, expecteds));
+      auto in = static_cast<const uint32_t *>(inputs[0].data());
+      auto ex = static_cast<const uint32_t *>(expecteds[0].data());
+      for (uint32_t j = 0; j < batch_size; ++j)
+      {
+        EXPECT_EQ(in[j], order[i * batch_size + j]);
+        EXPECT_EQ(ex[j], order[i * batch_size + j]);
+      }
+    }
+    EXPECT_FALSE(generator(data_length / batch_size, inputs, expecteds));
+  }
+
+  std::remove(input_file.c_str());
+  std::remove(expected_file.c_str());
+}